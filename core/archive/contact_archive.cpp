@@ -1,6 +1,7 @@
 #include "stdafx.h"
 
 #include "../log/log.h"
+#include "../tools/system.h"
 
 #include "contact_archive.h"
 #include "messages_data.h"
@@ -8,16 +9,17 @@
 #include "history_message.h"
 #include "image_cache.h"
 #include "mentions_me.h"
+#include "history_search.h"
 
 using namespace core;
 using namespace archive;
 
-contact_archive::contact_archive(const std::wstring& _archive_path, const std::string& _contact_id)
+contact_archive::contact_archive(const std::wstring& _archive_path, const std::string& _contact_id, std::function<void()> _on_images_built)
     : path_(_archive_path)
     , index_(std::make_unique<archive_index>(_archive_path + L'/' + index_filename(), _contact_id))
     , data_(std::make_unique<messages_data>(_archive_path + L'/' + db_filename()))
     , state_(std::make_unique<archive_state>(_archive_path + L'/' + dlg_state_filename(), _contact_id))
-    , images_(std::make_unique<image_cache>(_archive_path + L'/' + image_cache_filename()))
+    , images_(std::make_unique<image_cache>(_archive_path + L'/' + image_cache_filename(), std::move(_on_images_built)))
     , mentions_(std::make_unique<mentions_me>(_archive_path + L'/' + mentions_filename()))
     , local_loaded_(false)
 {
@@ -25,20 +27,31 @@ contact_archive::contact_archive(const std::wstring& _archive_path, const std::s
 
 
 contact_archive::~contact_archive()
+{
+    stop_images_thread();
+}
+
+void contact_archive::stop_images_thread()
 {
     images_->cancel_build();
     if (image_cache_thread_.joinable())
         image_cache_thread_.join();
 }
 
-void contact_archive::get_images(int64_t _from, int64_t _count, image_list& _images) const
+void contact_archive::get_images(int64_t _from, int64_t _count, uint32_t _types, image_list& _images) const
 {
-    images_->get_images(_from, _count, _images);
+    images_->get_images(_from, _count, _types, _images);
 }
 
-bool contact_archive::repair_images() const
+void contact_archive::repair_images()
 {
-    return images_->build(*this);
+    load_from_local();
+
+    // the build in progress is dropped, the new one starts from scratch anyway
+    stop_images_thread();
+    images_->reset_cancel_build();
+
+    image_cache_thread_ = std::thread(&image_cache::build, images_.get(), std::cref(*this));
 }
 
 void contact_archive::get_messages(int64_t _from, int64_t _count_early, int64_t _count_later, history_block& _messages, get_message_policy policy) const
@@ -73,10 +86,33 @@ void contact_archive::get_messages_index(int64_t _from, int64_t _count_early, in
     index_->serialize_from(_from, _count_early, _count_later, _headers);
 }
 
-bool contact_archive::get_history_file(const std::wstring& _file_name, core::tools::binary_stream& _data
-    , const std::shared_ptr<int64_t>& _offset, const std::shared_ptr<int64_t>& _remaining_size, int64_t& _cur_index, const std::shared_ptr<int64_t>& _mode)
+bool contact_archive::check_search_result(searched_msg& _msg) const
 {
-    return messages_data::get_history_archive(_file_name, _data, _offset, _remaining_size, _cur_index, _mode);
+    message_header msg_header;
+
+    if (!index_->get_header(_msg.id, Out msg_header) || msg_header.is_patch() || msg_header.is_deleted())
+        return false;
+
+    if (msg_header.is_modified() || msg_header.get_data_offset() != _msg.offset)
+    {
+        headers_list headers;
+        headers.push_back(msg_header);
+
+        history_block messages;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!data_->get_messages(headers, messages) || messages.empty())
+            return false;
+
+        _msg.message = messages.front();
+    }
+    else
+    {
+        _msg.message->apply_header_flags(msg_header);
+    }
+
+    return !_msg.message->is_deleted() && !_msg.message->is_chat_event_deleted();
 }
 
 bool contact_archive::get_messages_buddies(const std::shared_ptr<archive::msgids_list>& _ids, const std::shared_ptr<history_block>& _messages) const
@@ -253,6 +289,11 @@ int32_t contact_archive::load_from_local()
         }
     }
 
+    // the index without media types is rebuilt into the new file
+    const auto legacy_images = path_ + L"/_img3";
+    if (tools::system::is_exist(legacy_images))
+        tools::system::delete_file(legacy_images);
+
     image_cache_thread_ = std::thread(&image_cache::load_from_local, images_.get(), std::cref(*this));
 
     return 0;
@@ -332,7 +373,7 @@ std::wstring archive::dlg_state_filename()
 
 std::wstring archive::image_cache_filename()
 {
-    return L"_img3";
+    return L"_img4";
 }
 
 std::wstring archive::cache_filename()
@@ -18,6 +18,7 @@ namespace core
         class image_cache;
         class image_data;
         class mentions_me;
+        struct searched_msg;
 
         typedef std::list<image_data> image_list;
         typedef std::vector<std::shared_ptr<history_message>> history_block;
@@ -39,12 +40,15 @@ namespace core
 
             mutable std::mutex mutex_;
 
+            // loads or builds the media index, the archive thread doesn't wait for the history to be read
             std::thread image_cache_thread_;
 
+            void stop_images_thread();
+
         public:
 
-            void get_images(int64_t _from, int64_t _count, image_list& _images) const;
-            bool repair_images() const;
+            void get_images(int64_t _from, int64_t _count, uint32_t _types, image_list& _images) const;
+            void repair_images();
 
             enum class get_message_policy
             {
@@ -55,8 +59,10 @@ namespace core
             void get_messages(int64_t _from, int64_t _count_early, int64_t _count_later, history_block& _messages, get_message_policy policy) const;
             void get_messages_index(int64_t _from, int64_t _count_early, int64_t _count_later, headers_list& _headers) const;
             bool get_messages_buddies(const std::shared_ptr<archive::msgids_list>& _ids, const std::shared_ptr<history_block>& _messages) const;
-            static bool get_history_file(const std::wstring& _file_name, core::tools::binary_stream& _data
-                , const std::shared_ptr<int64_t>& _offset, const std::shared_ptr<int64_t>& _remaining_size, int64_t& _cur_index, const std::shared_ptr<int64_t>& _mode);
+
+            // false if the message found by the history search was deleted since,
+            // a copy replaced by a newer one or patched is read again
+            bool check_search_result(searched_msg& _msg) const;
 
             bool get_next_hole(int64_t _from, archive_hole& _hole, int64_t _depth) const;
             int64_t validate_hole_request(const archive_hole& _hole, const int32_t _count) const;
@@ -78,7 +84,8 @@ namespace core
 
             void delete_messages_up_to(const int64_t _up_to);
 
-            contact_archive(const std::wstring& _archive_path, const std::string& _contact_id);
+            // _on_images_built is called on the thread of the build when the media index is rebuilt
+            contact_archive(const std::wstring& _archive_path, const std::string& _contact_id, std::function<void()> _on_images_built);
             virtual ~contact_archive();
 
             void add_mention(const std::shared_ptr<archive::history_message>& _message);
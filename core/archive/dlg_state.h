@@ -155,14 +155,6 @@ namespace core
             void set_state(const dlg_state& _state, Out dlg_state_changes& _changes);
             void clear_state();
         };
-
-        struct searched_msg
-        {
-            std::string contact;
-            std::string text;
-            int64_t id;
-            std::string term;
-        };
     }
 }
 
@@ -13,7 +13,8 @@ namespace core
             end_of_file,
             file_not_exist,
             create_directory_error,
-            open_file_error
+            open_file_error,
+            checksum_mismatch
         };
     }
 }
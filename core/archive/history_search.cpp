@@ -0,0 +1,106 @@
+#include "stdafx.h"
+#include "history_search.h"
+
+using namespace core;
+using namespace archive;
+
+search_context::search_context(std::shared_ptr<coded_term> _term, size_t _limit)
+    : term_(std::move(_term))
+    , limit_(_limit)
+    , min_id_(-1)
+    , cancelled_(false)
+{
+}
+
+const coded_term& search_context::get_term() const
+{
+    return *term_;
+}
+
+void search_context::add_contact(const std::string& _contact, int64_t _last_msgid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    contacts_.emplace_back(_last_msgid, _contact);
+    std::push_heap(contacts_.begin(), contacts_.end());
+}
+
+bool search_context::pop_contact(std::string& _contact)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (cancelled_ || contacts_.empty())
+        return false;
+
+    // the rest of the contacts have only older messages
+    if (contacts_.front().first <= min_id_)
+    {
+        contacts_.clear();
+        return false;
+    }
+
+    std::pop_heap(contacts_.begin(), contacts_.end());
+
+    _contact = std::move(contacts_.back().second);
+    contacts_.pop_back();
+
+    return true;
+}
+
+int64_t search_context::get_min_id() const
+{
+    return min_id_;
+}
+
+bool search_context::add_result(std::shared_ptr<searched_msg> _msg)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (limit_ == 0 || top_ids_.count(_msg->id) != 0)
+        return false;
+
+    if (top_ids_.size() >= limit_)
+    {
+        const auto oldest = *top_ids_.begin();
+        if (_msg->id <= oldest)
+            return false;
+
+        top_ids_.erase(top_ids_.begin());
+
+        // a result which is already taken stays where it was sent to
+        new_results_.erase(
+            std::remove_if(new_results_.begin(), new_results_.end(), [oldest](const std::shared_ptr<searched_msg>& _result)
+            {
+                return _result->id == oldest;
+            }),
+            new_results_.end());
+    }
+
+    top_ids_.insert(_msg->id);
+    new_results_.push_back(std::move(_msg));
+
+    if (top_ids_.size() >= limit_)
+        min_id_ = *top_ids_.begin();
+
+    return true;
+}
+
+searched_msgs search_context::take_results()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    searched_msgs results;
+    results.swap(new_results_);
+
+    return results;
+}
+
+void search_context::cancel()
+{
+    cancelled_ = true;
+}
+
+bool search_context::is_cancelled() const
+{
+    return cancelled_;
+}
@@ -0,0 +1,89 @@
+#ifndef __HISTORY_SEARCH_H_
+#define __HISTORY_SEARCH_H_
+
+#pragma once
+
+namespace core
+{
+    namespace archive
+    {
+        class history_message;
+
+        struct coded_term
+        {
+            std::string lower_term;
+            std::vector<std::pair<std::string, int32_t>> symb_table;
+            std::string symbs;
+            std::vector<int32_t> coded_string;
+            std::vector<int32_t> prefix;
+            std::vector<int32_t> symb_indexes;
+        };
+
+        struct searched_msg
+        {
+            searched_msg()
+                : id(-1)
+                , offset(-1)
+            {
+            }
+
+            std::string contact;
+            int64_t id;
+            std::string term;
+
+            // where the message was found in the data file and what was decoded from there
+            int64_t offset;
+            std::shared_ptr<history_message> message;
+        };
+
+        typedef std::vector<std::shared_ptr<searched_msg>> searched_msgs;
+
+        // state of one history search shared by all its workers:
+        // the contacts left to scan ordered by the newest message they can contain
+        // and the best (the newest) results found so far
+        class search_context : boost::noncopyable
+        {
+        public:
+            search_context(std::shared_ptr<coded_term> _term, size_t _limit);
+
+            const coded_term& get_term() const;
+
+            void add_contact(const std::string& _contact, int64_t _last_msgid);
+
+            // false when no contact is left or none of the rest can get into the top
+            bool pop_contact(std::string& _contact);
+
+            // a result must be newer than this to get into the top, -1 while the top is not full
+            int64_t get_min_id() const;
+
+            bool add_result(std::shared_ptr<searched_msg> _msg);
+
+            // the results added since the previous call which are still in the top
+            searched_msgs take_results();
+
+            void cancel();
+            bool is_cancelled() const;
+
+        private:
+            const std::shared_ptr<coded_term> term_;
+
+            const size_t limit_;
+
+            mutable std::mutex mutex_;
+
+            // a heap by the last message id
+            std::vector<std::pair<int64_t, std::string>> contacts_;
+
+            // ids in the top, the first one is the oldest
+            std::set<int64_t> top_ids_;
+
+            searched_msgs new_results_;
+
+            std::atomic<int64_t> min_id_;
+
+            std::atomic<bool> cancelled_;
+        };
+    }
+}
+
+#endif //__HISTORY_SEARCH_H_
@@ -3,6 +3,7 @@
 #include "../../common.shared/url_parser/url_parser.h"
 
 #include "../tools/file_sharing.h"
+#include "../tools/semaphore.h"
 #include "../tools/system.h"
 
 #include "archive_index.h"
@@ -24,32 +25,65 @@ namespace
 
     const int32_t fetch_size            = 30;
 
+    // how often a build waiting for a slot checks if the archive is closed
+    const auto build_slot_wait = std::chrono::milliseconds(100);
+
     enum tlv_fields : uint32_t
     {
         tlv_img_pack                = 1,
 
         tlv_msg_id                  = 2,
         tlv_msg_url                 = 3,
-        tlv_msg_is_filesharing      = 4
+        tlv_msg_is_filesharing      = 4,
+        tlv_msg_media_type          = 5
     };
+
+    // every archive loaded after an upgrade rebuilds its index, only a few of them read the history at once
+    core::tools::semaphore& get_build_slots()
+    {
+        static core::tools::semaphore slots(std::max(2u, std::thread::hardware_concurrency() / 2));
+        return slots;
+    }
+
+    core::archive::media_type get_file_sharing_media_type(const std::string& _url)
+    {
+        auto content_type = core::file_sharing_content_type::undefined;
+        if (!core::tools::get_content_type_from_uri(_url, content_type))
+            return core::archive::media_type::file;
+
+        switch (content_type)
+        {
+        case core::file_sharing_content_type::image:
+            return core::archive::media_type::image;
+        case core::file_sharing_content_type::gif:
+            return core::archive::media_type::gif;
+        case core::file_sharing_content_type::video:
+            return core::archive::media_type::video;
+        default:
+            return core::archive::media_type::file;
+        }
+    }
 }
 
 core::archive::image_data::image_data()
     : msgid_(0)
     , is_filesharing_(false)
+    , type_(media_type::undefined)
 {
 }
 
 core::archive::image_data::image_data(int64_t _msgid)
     : msgid_(_msgid)
     , is_filesharing_(false)
+    , type_(media_type::undefined)
 {
 }
 
-core::archive::image_data::image_data(int64_t _msgid, std::string _url, bool _is_filesharing)
+core::archive::image_data::image_data(int64_t _msgid, std::string _url, bool _is_filesharing, media_type _type)
     : msgid_(_msgid)
     , url_(std::move(_url))
     , is_filesharing_(_is_filesharing)
+    , type_(_type)
 {
 }
 
@@ -83,6 +117,21 @@ void core::archive::image_data::set_is_filesharing(bool _value)
     is_filesharing_ = _value;
 }
 
+core::archive::media_type core::archive::image_data::get_type() const
+{
+    return type_;
+}
+
+void core::archive::image_data::set_type(media_type _value)
+{
+    type_ = _value;
+}
+
+bool core::archive::image_data::has_type(uint32_t _types) const
+{
+    return (static_cast<uint32_t>(type_) & _types) != 0;
+}
+
 void core::archive::image_data::serialize(core::tools::binary_stream& _data) const
 {
     core::tools::tlvpack msg_pack;
@@ -90,6 +139,7 @@ void core::archive::image_data::serialize(core::tools::binary_stream& _data) con
     msg_pack.push_child(core::tools::tlv(tlv_fields::tlv_msg_id, (int64_t) msgid_));
     msg_pack.push_child(core::tools::tlv(tlv_fields::tlv_msg_url, (std::string) url_));
     msg_pack.push_child(core::tools::tlv(tlv_fields::tlv_msg_is_filesharing, (bool) is_filesharing_));
+    msg_pack.push_child(core::tools::tlv(tlv_fields::tlv_msg_media_type, static_cast<uint32_t>(type_)));
 
     msg_pack.serialize(_data);
 }
@@ -114,6 +164,9 @@ bool core::archive::image_data::unserialize(core::tools::binary_stream& _data)
         case tlv_fields::tlv_msg_is_filesharing:
             is_filesharing_ = tlv_field->get_value<bool>();
             break;
+        case tlv_fields::tlv_msg_media_type:
+            type_ = static_cast<media_type>(tlv_field->get_value<uint32_t>());
+            break;
         default:
             assert(!"invalid field");
         }
@@ -122,12 +175,14 @@ bool core::archive::image_data::unserialize(core::tools::binary_stream& _data)
     return true;
 }
 
-core::archive::image_cache::image_cache(const std::wstring& _file_name)
+core::archive::image_cache::image_cache(const std::wstring& _file_name, std::function<void()> _on_built)
     : storage_(std::make_unique<storage>(_file_name))
     , tmp_to_add_storage_(std::make_unique<storage>(_file_name + tmp_to_add_extension))
     , tmp_to_delete_storage_(std::make_unique<storage>(_file_name + tmp_to_delete_extension))
     , building_in_progress_(false)
     , tree_is_consistent_(false)
+    , cancel_build_(false)
+    , on_built_(std::move(_on_built))
 {
 }
 
@@ -137,65 +192,51 @@ core::archive::image_cache::~image_cache()
 
 bool core::archive::image_cache::load_from_local(const contact_archive& _archive)
 {
-    const bool success = read_file(*storage_, image_by_msgid_);
-    if (success)
     {
-        tree_is_consistent_ = update_file_from_tmp_files();
-        return tree_is_consistent_;
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const bool success = read_file(*storage_, image_by_msgid_);
+        if (success)
+        {
+            tree_is_consistent_ = update_file_from_tmp_files();
+            return tree_is_consistent_;
+        }
     }
 
     // file doesn't exists or corruped so rebuild anyway
     return build(_archive);
 }
 
-void core::archive::image_cache::get_images(int64_t _from, int64_t _count, image_list& _images) const
+void core::archive::image_cache::get_images(int64_t _from, int64_t _count, uint32_t _types, image_list& _images) const
 {
-    _images.clear();
-
-    images_map_t::const_iterator it;
+    std::lock_guard<std::mutex> lock(mutex_);
 
-    {
-        std::unique_lock<std::mutex> lock(mutex_);
-
-        if (_from == -1)
-        {
-            while (building_in_progress_ && image_by_msgid_.empty())
-            {
-                data_ready_.wait(lock);
-            }
+    collect_images(_from, _count, _types, _images);
+}
 
-            it = image_by_msgid_.end();
-        }
-        else
-        {
-            it = image_by_msgid_.lower_bound(_from);
-            while (building_in_progress_ && it == image_by_msgid_.begin())
-            {
-                data_ready_.wait(lock);
-                it = image_by_msgid_.lower_bound(_from);
-            }
+void core::archive::image_cache::collect_images(int64_t _from, int64_t _count, uint32_t _types, image_list& _images) const
+{
+    _images.clear();
 
-            if (it == image_by_msgid_.end())
-            {
-                assert(!"invalid index number");
-                return;
-            }
-        }
-    }
+    auto it = (_from == -1 ? image_by_msgid_.end() : image_by_msgid_.lower_bound(_from));
 
     for (auto begin = image_by_msgid_.begin(); it != begin; )
     {
-        --it;
-
-        if (_count != -1 && _images.size() >= _count)
+        if (_count != -1 && static_cast<int64_t>(_images.size()) >= _count)
             return;
 
-        _images.emplace_front(it->second);
+        --it;
+
+        if (it->second.has_type(_types))
+            _images.emplace_front(it->second);
     }
 }
 
 bool core::archive::image_cache::update(const history_block& _block)
 {
+    // the build may be running on its own thread
+    std::lock_guard<std::mutex> lock(mutex_);
+
     if (!tree_is_consistent_)
     {
         image_vector_t to_add;
@@ -266,48 +307,72 @@ bool core::archive::image_cache::update(const history_block& _block)
 
 bool core::archive::image_cache::synchronize(const archive_index& _index)
 {
+    std::lock_guard<std::mutex> lock(mutex_);
+
     erase_deleted_from_tree(_index);
+
+    // a part of the tree is not saved, the build saves it all when it is over
+    if (building_in_progress_)
+        return true;
+
     return save_all();
 }
 
 bool core::archive::image_cache::build(const contact_archive& _archive)
 {
-    cancel_build_.clear();
+    if (cancel_build_)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        tree_is_consistent_ = false;
+        building_in_progress_ = true;
 
-    tree_is_consistent_ = false;
-    building_in_progress_ = true;
+        image_by_msgid_.clear();
+    }
+
+    // the archive may be closed while the build waits for its turn
+    auto& slots = get_build_slots();
+    while (!slots.wait_for(build_slot_wait))
+    {
+        if (cancel_build_)
+            return finish_cancelled_build();
+    }
 
-    image_by_msgid_.clear();
+    core::tools::auto_scope release_slot([&slots]{ slots.notify(); });
 
     history_block messages;
 
     int64_t from = -1;
     while (true)
     {
-        if (cancel_build_.test_and_set())
-        {
-            return false;
-        }
-
-        cancel_build_.clear();
+        if (cancel_build_)
+            return finish_cancelled_build();
 
         _archive.get_messages(from, fetch_size, -1, messages, contact_archive::get_message_policy::skip_patches_and_deleted);
         if (messages.empty())
         {
-            building_in_progress_ = false;
-            tree_is_consistent_ = true;
+            auto saved = false;
 
-            update_tree_from_tmp_files();
+            {
+                // the tmp files are not appended to in between, they are deleted once merged and saved
+                std::lock_guard<std::mutex> lock(mutex_);
 
-            data_ready_.notify_all();
+                building_in_progress_ = false;
+                tree_is_consistent_ = true;
 
-            if (save_all())
-            {
-                delete_tmp_files();
-                return true;
+                update_tree_from_tmp_files();
+
+                saved = save_all();
+                if (saved)
+                    delete_tmp_files();
             }
 
-            return false;
+            if (on_built_)
+                on_built_();
+
+            return saved;
         }
 
         from = (*messages.begin())->get_msgid();
@@ -315,18 +380,28 @@ bool core::archive::image_cache::build(const contact_archive& _archive)
         const auto images = extract_images(messages);
         if (!images.empty())
         {
-            {
-                std::lock_guard<std::mutex> lock(mutex_);
-                add_images_to_tree(images);
-            }
-            data_ready_.notify_all();
+            std::lock_guard<std::mutex> lock(mutex_);
+            add_images_to_tree(images);
         }
     }
 }
 
+bool core::archive::image_cache::finish_cancelled_build()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    building_in_progress_ = false;
+
+    return false;
+}
+
 void core::archive::image_cache::cancel_build()
 {
-    cancel_build_.test_and_set();
+    cancel_build_ = true;
+}
+
+void core::archive::image_cache::reset_cancel_build()
+{
+    cancel_build_ = false;
 }
 
 template<typename T>
@@ -440,24 +515,15 @@ void core::archive::image_cache::extract_images(int64_t _msgid, const std::strin
     {
         if (url_info.is_filesharing())
         {
-            auto content_type = core::file_sharing_content_type::undefined;
-
-            if (!tools::get_content_type_from_uri(url_info.url_, content_type))
-            {
-                continue;
-            }
-
-            if ((content_type == file_sharing_content_type::image) ||
-                (content_type == file_sharing_content_type::gif) ||
-                (content_type == file_sharing_content_type::video))
-            {
-                _images.emplace_back(_msgid, url_info.url_, url_info.is_filesharing());
-            }
+            _images.emplace_back(_msgid, url_info.url_, true, get_file_sharing_media_type(url_info.url_));
         }
-
-        if (url_info.is_image())
+        else if (url_info.is_image())
+        {
+            _images.emplace_back(_msgid, url_info.url_, false, media_type::image);
+        }
+        else if (url_info.is_site() || url_info.is_video() || url_info.is_ftp())
         {
-            _images.emplace_back(_msgid, url_info.url_, url_info.is_filesharing());
+            _images.emplace_back(_msgid, url_info.url_, false, media_type::link);
         }
     }
 }
@@ -12,16 +12,34 @@ namespace core
 
         typedef std::vector<std::shared_ptr<history_message>> history_block;
 
+        // what a media index entry points to, the values are the bits of a query mask
+        enum class media_type : uint32_t
+        {
+            undefined   = 0x00,
+
+            image       = 0x01,
+            gif         = 0x02,
+            video       = 0x04,
+            file        = 0x08,
+            link        = 0x10
+        };
+
+        // the types the gallery shows
+        constexpr uint32_t gallery_media_types = static_cast<uint32_t>(media_type::image) | static_cast<uint32_t>(media_type::gif) | static_cast<uint32_t>(media_type::video);
+
+        constexpr uint32_t all_media_types = gallery_media_types | static_cast<uint32_t>(media_type::file) | static_cast<uint32_t>(media_type::link);
+
         class image_data
         {
             int64_t msgid_;
             std::string url_;
             bool is_filesharing_;
+            media_type type_;
 
         public:
             image_data();
             explicit image_data(int64_t _msgid);
-            image_data(int64_t _msgid, std::string _url, bool _is_filesharing);
+            image_data(int64_t _msgid, std::string _url, bool _is_filesharing, media_type _type);
 
             int64_t get_msgid() const;
             void set_msgid(int64_t _value);
@@ -32,12 +50,20 @@ namespace core
             bool get_is_filesharing() const;
             void set_is_filesharing(bool _value);
 
+            media_type get_type() const;
+            void set_type(media_type _value);
+
+            bool has_type(uint32_t _types) const;
+
             void serialize(core::tools::binary_stream& _data) const;
             bool unserialize(core::tools::binary_stream& _data);
         };
 
         typedef std::list<image_data> image_list;
 
+        // the media (images, videos, files and links) of one chat ordered by message id,
+        // kept up to date with the history blocks and rebuilt from the archive when the file is lost;
+        // the rebuild runs on its own thread and calls on_built_ from there when the index is complete
         class image_cache
         {
             std::unique_ptr<storage> storage_;
@@ -48,21 +74,29 @@ namespace core
 
             typedef std::vector<image_data> image_vector_t;
 
+            // guards the tree, the files and the flags below, the build runs along with the updates
             mutable std::mutex mutex_;
-            mutable std::condition_variable data_ready_;
+            // the build goes from the newest messages, so the tree is always the newest part of the index
             bool building_in_progress_;
 
             bool tree_is_consistent_;
 
-            std::atomic_flag cancel_build_;
+            // set once the archive is closed, a cancelled build is not started again
+            std::atomic<bool> cancel_build_;
+
+            const std::function<void()> on_built_;
+
+            bool finish_cancelled_build();
 
         public:
-            explicit image_cache(const std::wstring& _file_name);
+            image_cache(const std::wstring& _file_name, std::function<void()> _on_built);
             virtual ~image_cache();
 
             bool load_from_local(const contact_archive& _archive);
 
-            void get_images(int64_t _from, int64_t _count, image_list& _images) const;
+            // the last _count entries of _types older than _from (or the newest ones if it is -1),
+            // while the tree is built the older part of them may be missing yet
+            void get_images(int64_t _from, int64_t _count, uint32_t _types, image_list& _images) const;
 
             bool update(const history_block& _block);
 
@@ -70,6 +104,7 @@ namespace core
 
             bool build(const contact_archive& _archive);
             void cancel_build();
+            void reset_cancel_build();
 
         private:
             bool serialize_block(storage& _storage, const image_vector_t& _images) const;
@@ -88,6 +123,8 @@ namespace core
 
             void erase_deleted_from_tree(const archive_index& _index);
 
+            void collect_images(int64_t _from, int64_t _count, uint32_t _types, image_list& _images) const;
+
             bool read_file(storage& _storage, images_map_t& _images) const;
 
             bool append_to_file(storage& _storage, const images_map_t& _images) const;
@@ -5,6 +5,7 @@
 #include "../../corelib/collection_helper.h"
 
 #include "../log/log.h"
+#include "../tools/metrics.h"
 
 #include "image_cache.h"
 #include "history_message.h"
@@ -12,14 +13,31 @@
 #include "archive_index.h"
 #include "not_sent_messages.h"
 #include "messages_data.h"
+#include "history_search.h"
 
 #include "local_history.h"
 
 using namespace core;
 using namespace archive;
 
-local_history::local_history(const std::wstring& _archive_path)
+namespace
+{
+    metrics::histogram& get_read_histogram()
+    {
+        static auto& read_time = metrics::get_histogram("archive.read");
+        return read_time;
+    }
+
+    metrics::histogram& get_write_histogram()
+    {
+        static auto& write_time = metrics::get_histogram("archive.write");
+        return write_time;
+    }
+}
+
+local_history::local_history(const std::wstring& _archive_path, std::function<void(const std::string&)> _on_images_built)
     :	archive_path_(_archive_path)
+    ,	on_images_built_(std::move(_on_images_built))
 {
 }
 
@@ -38,7 +56,14 @@ std::shared_ptr<contact_archive> local_history::get_contact_archive(const std::s
 
     std::wstring contact_folder = core::tools::from_utf8(_contact);
     std::replace(contact_folder.begin(), contact_folder.end(), L'|', L'_');
-    auto contact_arch = std::make_shared<contact_archive>(archive_path_ + L'/' + contact_folder, _contact);
+    std::function<void()> on_images_built;
+    if (on_images_built_)
+    {
+        auto on_built = on_images_built_;
+        on_images_built = [on_built, _contact]{ on_built(_contact); };
+    }
+
+    auto contact_arch = std::make_shared<contact_archive>(archive_path_ + L'/' + contact_folder, _contact, std::move(on_images_built));
 
     archives_.insert(std::make_pair(_contact, contact_arch));
 
@@ -52,23 +77,27 @@ void local_history::update_history(
     Out dlg_state& _state,
     Out dlg_state_changes& _state_changes)
 {
+    metrics::auto_timer timer(get_write_histogram());
+
     get_contact_archive(_contact)->insert_history_block(_data, Out _inserted_messages, Out _state, Out _state_changes);
 }
 
-void local_history::get_images(const std::string& _contact, int64_t _from, int64_t _count, /*out*/ image_list& _images)
+void local_history::get_images(const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types, /*out*/ image_list& _images)
 {
     const auto archive = get_contact_archive(_contact);
     archive->load_from_local();
-    archive->get_images(_from, _count, _images);
+    archive->get_images(_from, _count, _types, _images);
 }
 
-bool local_history::repair_images(const std::string& _contact)
+void local_history::repair_images(const std::string& _contact)
 {
-    return get_contact_archive(_contact)->repair_images();
+    get_contact_archive(_contact)->repair_images();
 }
 
 void local_history::get_messages_index(const std::string& _contact, int64_t _from, int64_t _count, /*out*/ headers_list& _headers)
 {
+    metrics::auto_timer timer(get_read_histogram());
+
     const auto archive = get_contact_archive(_contact);
     archive->load_from_local();
     archive->get_messages_index(_from, _count, -1, _headers);
@@ -76,6 +105,8 @@ void local_history::get_messages_index(const std::string& _contact, int64_t _fro
 
 bool local_history::get_messages(const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later, /*out*/ std::shared_ptr<history_block> _messages)
 {
+    metrics::auto_timer timer(get_read_histogram());
+
     headers_list headers;
 
     auto archive = get_contact_archive(_contact);
@@ -95,15 +126,25 @@ bool local_history::get_messages(const std::string& _contact, int64_t _from, int
     return true;
 }
 
-bool local_history::get_history_file(const std::string& _contact, /*out*/ core::tools::binary_stream& _history_archive
-    , std::shared_ptr<int64_t> _offset, std::shared_ptr<int64_t> _remaining_size, int64_t& _cur_index, std::shared_ptr<int64_t> _mode)
+std::wstring local_history::get_history_file_name(const std::string& _contact) const
 {
     std::wstring contact_folder = core::tools::from_utf8(_contact);
     std::replace(contact_folder.begin(), contact_folder.end(), L'|', L'_');
-    std::wstring file_name = archive_path_ + L'/' + contact_folder + L'/' + db_filename();
 
-    contact_archive::get_history_file(file_name, _history_archive, _offset, _remaining_size, _cur_index, _mode);
-    return true;
+    return archive_path_ + L'/' + contact_folder + L'/' + db_filename();
+}
+
+void local_history::check_search_results(/*in-out*/ searched_msgs& _results)
+{
+    metrics::auto_timer timer(get_read_histogram());
+
+    _results.erase(std::remove_if(_results.begin(), _results.end(), [this](const std::shared_ptr<searched_msg>& _result)
+    {
+        auto archive = get_contact_archive(_result->contact);
+        archive->load_from_local();
+
+        return !archive->check_search_result(*_result);
+    }), _results.end());
 }
 
 void local_history::get_messages_buddies(
@@ -111,6 +152,8 @@ void local_history::get_messages_buddies(
     std::shared_ptr<archive::msgids_list> _ids,
     /*out*/ std::shared_ptr<history_block> _messages)
 {
+    metrics::auto_timer timer(get_read_histogram());
+
     get_contact_archive(_contact)->get_messages_buddies(_ids, _messages);
 }
 
@@ -130,6 +173,8 @@ std::vector<dlg_state> local_history::get_dlg_states(const std::vector<std::stri
 
 void local_history::set_dlg_state(const std::string& _contact, const dlg_state& _state, Out dlg_state& _result, Out dlg_state_changes& _changes)
 {
+    metrics::auto_timer timer(get_write_histogram());
+
     get_contact_archive(_contact)->set_dlg_state(_state, Out _changes);
 
     Out _result = get_contact_archive(_contact)->get_dlg_state();
@@ -335,8 +380,8 @@ void local_history::add_mention(const std::string& _contact, std::shared_ptr<arc
 
 
 
-face::face(const std::wstring& _archive_path)
-    : history_cache_(std::make_shared<local_history>(_archive_path))
+face::face(const std::wstring& _archive_path, std::function<void(const std::string&)> _on_images_built)
+    : history_cache_(std::make_shared<local_history>(_archive_path, std::move(_on_images_built)))
     , thread_(std::make_shared<core::async_executer>())
 {
 }
@@ -376,7 +421,7 @@ std::shared_ptr<update_history_handler> face::update_history(const std::string&
     return handler;
 }
 
-std::shared_ptr<request_images_handler> face::get_images(const std::string& _contact, int64_t _from, int64_t _count)
+std::shared_ptr<request_images_handler> face::get_images(const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types)
 {
     assert(!_contact.empty());
 
@@ -387,9 +432,9 @@ std::shared_ptr<request_images_handler> face::get_images(const std::string& _con
     auto images = std::make_shared<image_list>();
     std::weak_ptr<face> wr_this = shared_from_this();
 
-    thread_->run_async_function([history_cache, _contact, _from, _count, images]() -> int32_t
+    thread_->run_async_function([history_cache, _contact, _from, _count, _types, images]() -> int32_t
     {
-        history_cache->get_images(_contact, _from, _count, *images);
+        history_cache->get_images(_contact, _from, _count, _types, *images);
         return 0;
 
     })->on_result_ = [wr_this, handler, images](int32_t /*_error*/)
@@ -417,7 +462,8 @@ std::shared_ptr<async_task_handlers> face::repair_images(const std::string& _con
 
     thread_->run_async_function([history_cache, _contact]() -> int32_t
     {
-        return history_cache->repair_images(_contact) ? 0 : 1;
+        history_cache->repair_images(_contact);
+        return 0;
 
     })->on_result_ = [wr_this, handler](int32_t _error)
     {
@@ -518,72 +564,25 @@ std::shared_ptr<request_buddies_handler> face::get_messages(const std::string& _
     return handler;
 }
 
-std::shared_ptr<request_history_file_handler> face::get_history_block(std::shared_ptr<contact_and_offsets> _contacts
-                                                                     , std::shared_ptr<contact_and_msgs> _archive, std::shared_ptr<tools::binary_stream> _data)
+std::wstring face::get_history_file_name(const std::string& _contact) const
 {
-    assert(!_contacts->empty());
+    return history_cache_->get_history_file_name(_contact);
+}
 
+std::shared_ptr<request_search_results_handler> face::check_search_results(std::shared_ptr<searched_msgs> _results)
+{
+    auto handler = std::make_shared<request_search_results_handler>();
     auto history_cache = history_cache_;
-    auto handler = std::make_shared<request_history_file_handler>();
-    std::weak_ptr<face> wr_this = shared_from_this();
-
-    auto remaining = std::make_shared<contact_and_offsets>();
 
-    thread_->run_async_function([_contacts, _archive, history_cache, remaining, _data]()->int32_t
+    thread_->run_async_function([history_cache, _results]()->int32_t
     {
-        auto remain_size = std::make_shared<int64_t>(1024 * 1024 * 10);
-        auto index = 0u;
-
-        _archive->clear();
-        auto has_result = false;
-        int64_t cur_index = 0;
-
-        while (*remain_size > 0 && index < _contacts->size())
-        {
-            auto _contact = (*_contacts)[index].first.first;
-            auto regim = (*_contacts)[index].first.second;
-            auto _offset = (*_contacts)[index].second;
-            ++index;
-
-            auto prev_cur_index = cur_index;
-            auto cur_result = history_cache->get_history_file(_contact, *_data, _offset, remain_size, cur_index, regim);
-            has_result |= cur_result;
-
-            if (!cur_result)
-            {
-                *_offset = -2;
-            }
-
-            //if (cur_result && cur_index != prev_cur_index)
-            {
-                _archive->push_back(std::make_pair(_contact, prev_cur_index));
-            }
-        }
-        _archive->push_back(std::make_pair(std::string(), cur_index));
-
-        const auto last_index = index;
-        const auto contacts_size = _contacts->size();
-        remaining->reserve(contacts_size - last_index);
-        for (; index < contacts_size; ++index)
-        {
-            remaining->push_back((*_contacts)[index]);
-        }
-        _contacts->resize(last_index);
-
-        return (has_result ? 0 : -1);
+        history_cache->check_search_results(*_results);
+        return 0;
 
-    })->on_result_ = [wr_this, handler, _archive, history_cache, remaining, _data](int32_t _error)
+    })->on_result_ = [handler, _results](int32_t _error)
     {
-        // we calc count of finished threads
-        // if (_error == -1)
-        //    return;
-
-        auto ptr_this = wr_this.lock();
-        if (!ptr_this)
-            return;
-
         if (handler->on_result)
-            handler->on_result(_archive, remaining, _data);
+            handler->on_result(_results);
     };
 
     return handler;
@@ -35,6 +35,7 @@ namespace core
         class archive_hole;
         class not_sent_message;
         class not_sent_messages;
+        struct searched_msg;
 
         typedef std::shared_ptr<not_sent_message> not_sent_message_sptr;
         typedef std::shared_ptr<history_message> history_message_sptr;
@@ -44,8 +45,7 @@ namespace core
         typedef std::list<image_data> image_list;
         typedef std::list<message_header> headers_list;
         typedef std::list<int64_t> msgids_list;
-        typedef std::vector<std::pair<std::string, int64_t>> contact_and_msgs;
-        typedef std::vector<std::pair<std::pair<std::string, std::shared_ptr<int64_t>>, std::shared_ptr<int64_t>>> contact_and_offsets;
+        typedef std::vector<std::shared_ptr<searched_msg>> searched_msgs;
 
         struct request_images_handler
         {
@@ -167,13 +167,13 @@ namespace core
             }
         };
 
-        struct request_history_file_handler
+        struct request_search_results_handler
         {
-            std::function<void(std::shared_ptr<contact_and_msgs>, std::shared_ptr<contact_and_offsets>, std::shared_ptr<tools::binary_stream> _data)>	on_result;
+            std::function<void(std::shared_ptr<searched_msgs>)>	on_result;
 
-            request_history_file_handler()
+            request_search_results_handler()
             {
-                on_result = [](std::shared_ptr<contact_and_msgs>, std::shared_ptr<contact_and_offsets>, std::shared_ptr<tools::binary_stream>){};
+                on_result = [](std::shared_ptr<searched_msgs>){};
             }
         };
 
@@ -198,24 +198,26 @@ namespace core
             const std::wstring archive_path_;
             std::unique_ptr<not_sent_messages> not_sent_messages_;
 
+            const std::function<void(const std::string&)> on_images_built_;
+
             std::shared_ptr<contact_archive> get_contact_archive(const std::string& _contact);
 
             not_sent_messages& get_pending_messages();
 
         public:
 
-            local_history(const std::wstring& _archive_path);
+            local_history(const std::wstring& _archive_path, std::function<void(const std::string&)> _on_images_built);
             virtual ~local_history();
 
             void optimize_contact_archive(const std::string& _contact);
 
-            void get_images(const std::string& _contact, int64_t _from, int64_t _count, /*out*/ image_list& _images);
-            bool repair_images(const std::string& _contact);
+            void get_images(const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types, /*out*/ image_list& _images);
+            void repair_images(const std::string& _contact);
             void get_messages_index(const std::string& _contact, int64_t _from, int64_t _count, /*out*/ headers_list& _headers);
             void get_messages_buddies(const std::string& _contact, std::shared_ptr<archive::msgids_list> _ids, /*out*/ std::shared_ptr<history_block> _messages);
             bool get_messages(const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later, /*out*/ std::shared_ptr<history_block> _messages);
-            bool get_history_file(const std::string& _contact, /*out*/ core::tools::binary_stream& _history_archive
-                , std::shared_ptr<int64_t> _offset, std::shared_ptr<int64_t> _remaining_size, int64_t& _cur_index, std::shared_ptr<int64_t> _mode);
+            std::wstring get_history_file_name(const std::string& _contact) const;
+            void check_search_results(/*in-out*/ searched_msgs& _results);
 
             void get_dlg_state(const std::string& _contact, dlg_state& _state);
 
@@ -277,17 +279,19 @@ namespace core
 
         public:
 
-            explicit face(const std::wstring& _archive_path);
+            // _on_images_built is called with the contact whose media index is rebuilt, on the thread of the build
+            face(const std::wstring& _archive_path, std::function<void(const std::string&)> _on_images_built);
 
             std::shared_ptr<update_history_handler> update_history(const std::string& _contact, const std::shared_ptr<archive::history_block>& _data);
-            std::shared_ptr<request_images_handler> get_images(const std::string& _contact, int64_t _from, int64_t _count);
+            std::shared_ptr<request_images_handler> get_images(const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types);
             std::shared_ptr<async_task_handlers> repair_images(const std::string& _contact);
             std::shared_ptr<request_headers_handler> get_messages_index(const std::string& _contact, int64_t _from, int64_t _count);
             std::shared_ptr<request_buddies_handler> get_messages_buddies(const std::string& _contact, std::shared_ptr<archive::msgids_list> _ids);
             std::shared_ptr<request_buddies_handler> get_messages(const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later);
 
-            std::shared_ptr<request_history_file_handler> get_history_block(std::shared_ptr<contact_and_offsets> _contacts
-                , std::shared_ptr<contact_and_msgs> _archive, std::shared_ptr<tools::binary_stream> _data);
+            // the data file can be read from any thread, see messages_data::search_in_file
+            std::wstring get_history_file_name(const std::string& _contact) const;
+            std::shared_ptr<request_search_results_handler> check_search_results(std::shared_ptr<searched_msgs> _results);
 
             std::shared_ptr<request_dlg_state_handler> get_dlg_state(const std::string& _contact);
 
@@ -2,14 +2,15 @@
 #include "messages_data.h"
 #include "storage.h"
 #include "archive_index.h"
+#include "history_search.h"
 #include "../tools/system.h"
-#include "../../common.shared/common_defs.h"
+#include "../configuration/app_config.h"
 
 using namespace core;
 using namespace archive;
 
 messages_data::messages_data(const std::wstring& _file_name)
-    :	storage_(std::make_unique<storage>(_file_name))
+    :	storage_(std::make_unique<storage>(_file_name, core::configuration::get_app_config().is_archive_checksum_enabled_))
 {
 }
 
@@ -102,139 +103,118 @@ int32_t kmp_strstr(const char* _str, uint32_t _str_sz, const std::vector<int32_t
     return -1;
 }
 
-bool messages_data::get_history_archive(const std::wstring& _file_name, core::tools::binary_stream& _buffer
-    , std::shared_ptr<int64_t> _offset, std::shared_ptr<int64_t> _remaining_size, int64_t& _cur_index, std::shared_ptr<int64_t> _mode)
+namespace
 {
-    auto file = tools::system::open_file_for_read(_file_name, std::ios::binary | std::ios::ate);
+    // a data file is searched by parts of this size starting from its end
+    const int64_t search_part_size = 1024 * 1024;
 
-    auto init_size = static_cast<int64_t>(file.tellg());
-    std::streamsize size = std::min<int64_t>(*_remaining_size, init_size - *_offset);
+    // two size fields go before the data of a block
+    const int64_t block_header_size = 2 * sizeof(uint32_t);
+}
 
-    if (size <= 0 || init_size == -1)
-    {
-        *_offset = -1;
-        return false;
-    }
+void messages_data::search_in_file(const std::wstring& _file_name, const std::string& _contact, search_context& _context)
+{
+    auto file = tools::system::open_file_for_read(_file_name, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return;
 
-    if (*_mode == 0)
-    {
-        auto limit = 1024 * 1024 * 10;
+    const auto file_size = static_cast<int64_t>(file.tellg());
+    if (file_size <= 0)
+        return;
 
-        if (init_size > limit  && *_offset + limit < init_size)
-        {
-            *_offset = init_size - limit;
-        }
-        else
-        {
-            *_mode = 1;
-        }
-    }
+    const auto& term = _context.get_term();
+
+    core::tools::binary_stream data;
 
-    file.seekg(*_offset, std::ios::beg);
+    auto end = file_size;
+    auto part_size = search_part_size;
 
-    if (!file.read(_buffer.get_data_for_write() + _cur_index, size))
+    // parts go from the end of the file, so the newest messages are checked first
+    while (end > 0 && !_context.is_cancelled())
     {
-        return false;
-    }
+        const auto start = std::max<int64_t>(0, end - part_size);
+        const auto size = end - start;
 
-    *_remaining_size -= size;
-    _cur_index += size;
+        data.reset();
+        data.reserve(static_cast<uint32_t>(size));
 
-    if (size == init_size - *_offset )
-    {
-        *_offset = -1;
-    }
+        file.seekg(start, std::ios::beg);
+        if (!file.read(data.get_data_for_write(), size))
+            return;
 
-    return true;
-}
+        int64_t first_block = -1;
+        int64_t current_pos = 0;
+        int64_t begin_of_block = 0;
 
-void messages_data::search_in_archive(std::shared_ptr<contact_and_offsets> _contacts_and_offsets, std::shared_ptr<coded_term> _cterm
-                , std::shared_ptr<archive::contact_and_msgs> _archive
-                , std::shared_ptr<tools::binary_stream> _data
-                , std::vector<std::shared_ptr<::core::archive::searched_msg>>& messages_ids
-                , int64_t _min_id)
-{
-    std::set<int64_t, std::greater<int64_t>> top_ids;
+        for (;;)
+        {
+            if (!storage::fast_read_data_block(data, current_pos, begin_of_block, size))
+            {
+                // a part ends on a block boundary, so a block cut by its end is a false match
+                if (++current_pos < size)
+                    continue;
 
-    for (auto contact_i = 0u; contact_i < _archive->size() - 1; ++contact_i)
-    {
-        auto current_pos = (*_archive)[contact_i].second;
-        auto end_pos = (*_archive)[contact_i + 1].second;
-        auto _offset = (*_contacts_and_offsets)[contact_i].second;
-        auto _contact = (*_archive)[contact_i].first;
+                break;
+            }
 
-        int64_t begin_of_block;
+            if (first_block == -1)
+                first_block = begin_of_block - block_header_size;
 
-        while (storage::fast_read_data_block((*_data), current_pos, begin_of_block, end_pos))
-        {
-            _data->set_output(begin_of_block);
-            auto mess_id = history_message::get_id_field(*_data);
+            data.set_output(begin_of_block);
+            const auto mess_id = history_message::get_id_field(data);
 
-            if ((mess_id != -1 && top_ids.count(mess_id) != 0) || mess_id == -1 || mess_id <= _min_id)
-            {
+            if (mess_id == -1 || mess_id <= _context.get_min_id())
                 continue;
-            }
 
-            if (top_ids.size() > ::common::get_limit_search_results())
-            {
-                auto greater = top_ids.upper_bound(mess_id);
-
-                if (greater != top_ids.end())
-                {
-                    auto min_id = (*top_ids.rbegin());
-                    top_ids.erase(min_id);
-                    top_ids.insert(mess_id);
-                }
-                else
-                {
-                    continue;
-                }
-            }
+            data.set_output(begin_of_block);
+            if (history_message::is_sticker(data))
+                continue;
 
             uint32_t text_length = 0;
 
-            _data->set_output(begin_of_block);
+            data.set_output(begin_of_block);
+            history_message::jump_to_text_field(data, text_length);
 
-            if (history_message::is_sticker(*_data))
-            {
+            if (!text_length || !data.available())
                 continue;
-            }
 
-            _data->set_output(begin_of_block);
+            if (kmp_strstr(data.read_available(), text_length, term.coded_string, term.prefix, term.symbs, term.symb_indexes) == -1)
+                continue;
 
-            history_message::jump_to_text_field(*_data, text_length);
+            // the message is decoded from the part, the archive only checks later that this copy is still actual
+            data.set_output(begin_of_block);
 
-            if (!text_length)
-            {
+            auto message = std::make_shared<history_message>();
+            if (message->unserialize(data) != 0 || message->get_msgid() != mess_id)
                 continue;
-            }
 
-            char* pointer = nullptr;
-            if (_data->available())
-            {
-                pointer = _data->read_available();
-            }
+            auto search_msg = std::make_shared<searched_msg>();
+            search_msg->contact = _contact;
+            search_msg->id = mess_id;
+            search_msg->term = term.lower_term;
+            search_msg->offset = start + begin_of_block - block_header_size;
+            search_msg->message = std::move(message);
 
-            if (kmp_strstr(pointer, text_length, _cterm->coded_string, _cterm->prefix, _cterm->symbs, _cterm->symb_indexes) != -1)
-            {
-                top_ids.insert(mess_id);
-
-                auto search_msg = std::make_shared<searched_msg>();
-                search_msg->contact = _contact;
-                search_msg->id = mess_id;
-                search_msg->term = _cterm->lower_term;
-                search_msg->contact = _contact;
-                messages_ids.push_back(std::move(search_msg));
-            }
+            _context.add_result(std::move(search_msg));
         }
 
-        if (current_pos == (*_archive)[contact_i].second && !((*_archive)[contact_i].first.empty()))
+        if (start == 0)
+            break;
+
+        if (first_block == -1)
         {
-            *_offset = -1;
+            // the part is the middle of a bigger block, which fits into a part twice as big
+            if (part_size == search_part_size)
+            {
+                part_size *= 2;
+                continue;
+            }
+
+            first_block = 0;
         }
 
-        if (*_offset != -1)
-            *_offset += current_pos - (*_archive)[contact_i].second;
+        end = start + first_block;
+        part_size = search_part_size;
     }
 }
 
@@ -3,13 +3,87 @@
 #include "history_message.h"
 #include "../tools/system.h"
 
+#include <boost/crc.hpp>
+
 using namespace core;
 using namespace archive;
 
 const int32_t max_data_block_size = (1024 * 1024);
 
-storage::storage(const std::wstring& _file_name)
-    :	file_name_(_file_name), last_error_(archive::error::ok)
+namespace
+{
+    const uint32_t checksum_flag = 0x80000000;
+
+    const int64_t size_field_size = sizeof(uint32_t);
+    const int64_t frame_size = 4 * size_field_size;
+
+    uint32_t get_checksum(const char* _data, uint32_t _size)
+    {
+        boost::crc_32_type crc;
+        crc.process_bytes(_data, _size);
+
+        return crc.checksum();
+    }
+
+    uint32_t read_size_field(const char* _data)
+    {
+        uint32_t value;
+        memcpy(&value, _data, sizeof(value));
+
+        return value;
+    }
+
+    uint64_t read_word(const char* _data)
+    {
+        uint64_t value;
+        memcpy(&value, _data, sizeof(value));
+
+        return value;
+    }
+
+    // the first position in [_from, _to) with two equal size fields one after another, _to if there is none;
+    // the buffer must be readable up to _to + frame_size
+    int64_t find_size_pair(const char* _data, int64_t _from, int64_t _to)
+    {
+        const uint64_t low_bits = 0x7f7f7f7f7f7f7f7full;
+
+        // a word and the word four bytes later are compared at once,
+        // a pair can start at any of the first five bytes of the word
+        const int64_t positions_per_word = 5;
+
+        auto pos = _from;
+
+        for (; pos + positions_per_word <= _to; pos += positions_per_word)
+        {
+            const auto diff = read_word(_data + pos) ^ read_word(_data + pos + size_field_size);
+
+            // the high bit of every zero byte, that is of every byte equal to the one four bytes later
+            const auto equal = ~(((diff & low_bits) + low_bits) | diff | low_bits);
+
+            // four equal bytes in a row (the words are little endian)
+            const auto pairs = equal & (equal >> 8) & (equal >> 16) & (equal >> 24) & 0x8080808080ull;
+            if (!pairs)
+                continue;
+
+            for (int64_t i = 0; i < positions_per_word; ++i)
+            {
+                if (pairs & (0x80ull << (8 * i)))
+                    return pos + i;
+            }
+        }
+
+        for (; pos < _to; ++pos)
+        {
+            if (read_size_field(_data + pos) == read_size_field(_data + pos + size_field_size))
+                return pos;
+        }
+
+        return std::max(_from, _to);
+    }
+}
+
+storage::storage(const std::wstring& _file_name, bool _with_checksum)
+    :	file_name_(_file_name), with_checksum_(_with_checksum), last_error_(archive::error::ok)
 {
 }
 
@@ -104,15 +178,24 @@ bool storage::write_data_block(core::tools::binary_stream& _data, int64_t& _offs
     _offset = active_file_stream_->tellp();
 
     uint32_t data_size = _data.available();
+    const char* data = (data_size ? _data.read(data_size) : nullptr);
 
-    active_file_stream_->write((const char*) &data_size, sizeof(data_size));
-    active_file_stream_->write((const char*) &data_size, sizeof(data_size));
+    const uint32_t size_field = (with_checksum_ ? (data_size | checksum_flag) : data_size);
+
+    active_file_stream_->write((const char*) &size_field, sizeof(size_field));
+    active_file_stream_->write((const char*) &size_field, sizeof(size_field));
 
     if (data_size)
-        active_file_stream_->write((const char*) _data.read(data_size), data_size);
+        active_file_stream_->write(data, data_size);
 
-    active_file_stream_->write((const char*) &data_size, sizeof(data_size));
-    active_file_stream_->write((const char*) &data_size, sizeof(data_size));
+    if (with_checksum_)
+    {
+        const auto checksum = get_checksum(data, data_size);
+        active_file_stream_->write((const char*) &checksum, sizeof(checksum));
+    }
+
+    active_file_stream_->write((const char*) &size_field, sizeof(size_field));
+    active_file_stream_->write((const char*) &size_field, sizeof(size_field));
 
     return true;
 }
@@ -137,16 +220,35 @@ bool storage::read_data_block(int64_t _offset, core::tools::binary_stream& _data
     if (!active_file_stream_->good())
         return false;
 
-    if (sz1 != sz2 || sz1 > max_data_block_size)
+    const auto has_checksum = ((sz1 & checksum_flag) != 0);
+    const auto data_size = (sz1 & ~checksum_flag);
+
+    if (sz1 != sz2 || data_size > max_data_block_size)
         return false;
 
-    if (sz1 != 0)
+    char* data = nullptr;
+    if (data_size != 0)
     {
-        active_file_stream_->read(_data.alloc_buffer(sz1), sz1);
+        data = _data.alloc_buffer(data_size);
+        active_file_stream_->read(data, data_size);
         if (!active_file_stream_->good())
             return false;
     }
 
+    if (has_checksum)
+    {
+        uint32_t checksum = 0;
+        active_file_stream_->read((char*) &checksum, sizeof(checksum));
+        if (!active_file_stream_->good())
+            return false;
+
+        if (checksum != get_checksum(data, data_size))
+        {
+            last_error_ = archive::error::checksum_mismatch;
+            return false;
+        }
+    }
+
     uint32_t sz3 = 0, sz4 = 0;
     active_file_stream_->read((char*) &sz3, sizeof(sz3));
     if (!active_file_stream_->good())
@@ -164,66 +266,58 @@ bool storage::read_data_block(int64_t _offset, core::tools::binary_stream& _data
 
 bool storage::fast_read_data_block(core::tools::binary_stream& buffer, int64_t& current_pos, int64_t& _begin, int64_t _end_position)
 {
-    bool is_small_file = false;
+    const auto end_position = std::min<int64_t>(_end_position, buffer.all_size());
 
-    static auto step = sizeof(uint32_t) / sizeof(char);
-    if (current_pos + 4 * step >= buffer.all_size())
-    {
-        is_small_file = true;
-    }
+    // a block takes more than its four size fields
+    const auto last_position = end_position - frame_size;
+    if (current_pos >= last_position)
+        return false;
+
+    const char* data = buffer.get_data();
 
-    if (!is_small_file)
+    for (;;)
     {
-        uint32_t sz1 = 0, sz2 = 0, sz3 = 0, sz4 = 0;
+        current_pos = find_size_pair(data, current_pos, last_position);
+        if (current_pos >= last_position)
+            return false;
+
+        const auto size_field = read_size_field(data + current_pos);
+        const auto data_size = (size_field & ~checksum_flag);
 
-        while (!is_small_file)
+        if (data_size == 0 || data_size > max_data_block_size)
         {
-            if (current_pos + 4 * step >= _end_position)
-            {
-                is_small_file = true;
-                break;
-            }
+            ++current_pos;
+            continue;
+        }
 
-            sz1 = *((uint32_t*)(&(buffer.get_data())[current_pos]));
-            sz2 = *((uint32_t*)(&(buffer.get_data())[current_pos + step]));
+        const auto data_begin = current_pos + 2 * size_field_size;
+        const auto data_end = data_begin + data_size;
+        const auto trailer = ((size_field & checksum_flag) ? data_end + size_field_size : data_end);
 
-            if (sz1 == 0 || sz1 != sz2 || sz1 > max_data_block_size)
-            {
-                ++current_pos;
-                continue;
-            }
+        // the block is cut by the end of the buffer, it is read again with the next part of the file
+        if (trailer + 2 * size_field_size > end_position)
+            return false;
 
-            if (current_pos + 4 * step + sz1 <= _end_position)
-            {
-                sz3 = *((uint32_t*)(&(buffer.get_data())[current_pos + 2 * step + sz1]));
-                sz4 = *((uint32_t*)(&(buffer.get_data())[current_pos + 3 * step + sz1]));
-
-                if (sz3 != sz1 || sz3 != sz4)
-                {
-                    ++current_pos;
-                    continue;
-                }
-                else
-                    break;
-            }
-            else
-            {
-                is_small_file = true;
-                break;
-            }
-        };
+        if (read_size_field(data + trailer) != size_field || read_size_field(data + trailer + size_field_size) != size_field)
+        {
+            ++current_pos;
+            continue;
+        }
 
-        if (!is_small_file)
+        // the framing is intact, only the data is damaged, so the whole block is skipped
+        if ((size_field & checksum_flag) && read_size_field(data + data_end) != get_checksum(data + data_begin, data_size))
         {
-            current_pos += 2 * step;
-            _begin = current_pos;
+            current_pos = trailer + 2 * size_field_size;
+            continue;
+        }
 
-            buffer.set_output(current_pos);
-            buffer.set_input(current_pos + sz1);
+        _begin = data_begin;
 
-            current_pos += sz1 + 2 * step;
-        }
-    }
+        buffer.set_output(data_begin);
+        buffer.set_input(data_end);
 
-    return !is_small_file;
+        current_pos = trailer + 2 * size_field_size;
+
+        return true;
+    }
 }
@@ -34,10 +34,14 @@ namespace core
             }
         };
 
+        // a block is framed as size, size, data, size, size;
+        // a block written with a checksum has the high bit set in the sizes and the crc32 of the data after it
         class storage
         {
             const std::wstring file_name_;
 
+            const bool with_checksum_;
+
             std::list<storage_data_block> data_list_;
 
             std::unique_ptr<std::fstream> active_file_stream_;
@@ -53,13 +57,16 @@ namespace core
 
             bool write_data_block(core::tools::binary_stream& _data, int64_t& _offset);
             bool read_data_block(int64_t _offset, core::tools::binary_stream& _data);
+
+            // finds the next valid block in a raw copy of a storage file starting at current_pos,
+            // corrupt regions (broken framing or a wrong checksum) are skipped
             static bool fast_read_data_block(core::tools::binary_stream& buffer, int64_t& current_pos, int64_t& _begin, int64_t _end_position);
 
             archive::error get_last_error() const { return last_error_; }
 
             const std::wstring& get_file_name() const { return file_name_; }
 
-            storage(const std::wstring& _file_name);
+            storage(const std::wstring& _file_name, bool _with_checksum = false);
             virtual ~storage();
         };
 
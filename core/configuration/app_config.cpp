@@ -14,6 +14,10 @@ namespace
     std::unique_ptr<app_config> config_;
 
     const int_set& valid_dpi_values();
+
+    const int32_t default_send_threads_count = 4;
+
+    const int32_t max_send_threads_count = 16;
 }
 
 app_config::app_config()
@@ -22,6 +26,8 @@ app_config::app_config()
     , is_crash_enabled_(false)
     , full_log_(false)
     , unlock_context_menu_features_(false)
+    , send_threads_count_(default_send_threads_count)
+    , is_archive_checksum_enabled_(false)
 {
 
 }
@@ -31,14 +37,19 @@ app_config::app_config(
     const int32_t _forced_dpi,
     const bool _is_crash_enabled,
     const bool _full_log,
-    const bool _unlock_context_menu_features)
+    const bool _unlock_context_menu_features,
+    const int32_t _send_threads_count,
+    const bool _is_archive_checksum_enabled)
     : is_server_history_enabled_(_is_server_history_enabled)
     , forced_dpi_(_forced_dpi)
     , is_crash_enabled_(_is_crash_enabled)
     , full_log_(_full_log)
     , unlock_context_menu_features_(_unlock_context_menu_features)
+    , send_threads_count_(_send_threads_count)
+    , is_archive_checksum_enabled_(_is_archive_checksum_enabled)
 {
     assert(valid_dpi_values().count(forced_dpi_) > 0);
+    assert(send_threads_count_ > 0 && send_threads_count_ <= max_send_threads_count);
 }
 
 void app_config::serialize(Out core::coll_helper &_collection) const
@@ -99,12 +110,22 @@ void load_app_config(const boost::filesystem::wpath &_path)
     const auto full_log = options.get<bool>("fulllog", false);
     const auto unlock_context_menu_features = options.get<bool>("dev.unlock_context_menu_features", ::build::is_debug());
 
+    auto send_threads_count = options.get<int32_t>("net.send_threads", default_send_threads_count);
+    if (send_threads_count <= 0 || send_threads_count > max_send_threads_count)
+    {
+        send_threads_count = default_send_threads_count;
+    }
+
+    const auto archive_checksum = options.get<bool>("archive.checksum", false);
+
     config_ = std::make_unique<app_config>(
         !disable_server_history,
         forced_dpi,
         enable_crash,
         full_log,
-        unlock_context_menu_features);
+        unlock_context_menu_features,
+        send_threads_count,
+        archive_checksum);
 }
 
 namespace
@@ -13,7 +13,9 @@ struct app_config
         const int32_t _forced_dpi,
         const bool _is_crash_enabled,
         const bool _full_log,
-        const bool _unlock_context_menu_features);
+        const bool _unlock_context_menu_features,
+        const int32_t _send_threads_count,
+        const bool _is_archive_checksum_enabled);
 
     void serialize(Out core::coll_helper &_collection) const;
 
@@ -26,6 +28,12 @@ struct app_config
     const bool full_log_;
 
     const bool unlock_context_menu_features_;
+
+    // wim packets of different contacts sent at once
+    const int32_t send_threads_count_;
+
+    // history blocks are written with a crc32, older builds can not read such blocks
+    const bool is_archive_checksum_enabled_;
 };
 
 const app_config& get_app_config();
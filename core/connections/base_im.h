@@ -153,7 +153,7 @@ namespace core
         virtual void show_contact_avatar(int64_t _seq, const std::string& _contact, int32_t _avatar_size) = 0;
 
         // history functions
-        virtual void get_archive_images(int64_t _seq_, const std::string& _contact, int64_t _from, int64_t _count) = 0;
+        virtual void get_archive_images(int64_t _seq_, const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types) = 0;
         virtual void repair_archive_images(int64_t _seq_, const std::string& _contact) = 0;
         virtual void get_archive_messages(int64_t _seq_, const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later, bool _need_prefetch, bool _first_request, std::function<void(int64_t)> last_message_catcher) = 0;
         virtual void get_archive_index(int64_t _seq_, const std::string& _contact, int64_t _from, int64_t _count, std::function<void(int64_t)> last_message_catcher) = 0;
@@ -12,9 +12,12 @@
 
 #include "../core.h"
 #include "../tools/system.h"
+#include "../tools/case_fold.h"
+#include "../tools/metrics.h"
 #include "../utils.h"
 #include "../archive/contact_archive.h"
 #include "../archive/history_message.h"
+#include "../archive/image_cache.h"
 #include "../statistics.h"
 #include "../themes/themes.h"
 #include "../proxy_settings.h"
@@ -106,6 +109,7 @@ im_container::im_container(const std::shared_ptr<voip_manager::VoipManager>& voi
     REGISTER_IM_MESSAGE("modify_chat", on_modify_chat);
     REGISTER_IM_MESSAGE("sign_url", on_sign_url);
     REGISTER_IM_MESSAGE("stats", on_stats);
+    REGISTER_IM_MESSAGE("metrics/dump", on_dump_metrics);
     REGISTER_IM_MESSAGE("themes/meta/get", on_get_themes_meta);
     REGISTER_IM_MESSAGE("themes/theme/get", on_get_theme);
     REGISTER_IM_MESSAGE("files/set_url_played", on_url_played);
@@ -502,8 +506,9 @@ void im_container::on_get_archive_images(int64_t _seq, coll_helper& _params)
     const auto contact = _params.get_value_as_string("contact");
     const auto from = _params.get_value_as_int64("from");
     const auto count = _params.get_value_as_int64("count");
+    const auto types = _params.get_value_as_uint("types", archive::gallery_media_types);
 
-    im->get_archive_images(_seq, contact, from, count);
+    im->get_archive_images(_seq, contact, from, count, types);
 }
 
 void im_container::on_repair_archive_images(int64_t _seq, coll_helper& _params)
@@ -974,6 +979,14 @@ void core::im_container::on_stats(int64_t _seq, coll_helper& _params)
     g_core->insert_event((core::stats::stats_event_names)_params.get_value_as_int("event"), props);
 }
 
+void core::im_container::on_dump_metrics(int64_t _seq, coll_helper& _params)
+{
+    coll_helper cl_coll(g_core->create_collection(), true);
+    cl_coll.set_value_as_string("metrics", core::metrics::dump());
+
+    g_core->post_message_to_gui("metrics/dump/result", _seq, cl_coll.get());
+}
+
 void core::im_container::on_url_played(int64_t _seq, coll_helper& _params)
 {
     auto im = get_im(_params);
@@ -1148,7 +1161,7 @@ void core::im_container::on_history_search(int64_t _seq, coll_helper& _params)
     for (auto& symbol_iter : searchSymbolsPatterns)
     {
         for (auto& iter : symbol_iter)
-            iter = ::core::tools::system::to_upper(iter);
+            ::core::tools::case_fold::to_upper(iter);
     }
 
     im->history_search_in_cl(searchSymbolsPatterns, _seq, _params.get_value_as_uint("fixed_patterns_count"), pattern);
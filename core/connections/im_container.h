@@ -151,6 +151,7 @@ namespace core
         // tools
         void on_sign_url(int64_t _seq, coll_helper& _params);
         void on_stats(int64_t _seq, coll_helper& _params);
+        void on_dump_metrics(int64_t _seq, coll_helper& _params);
 
         std::shared_ptr<base_im> get_im(coll_helper& _params) const;
         void on_get_flags(int64_t _seq, coll_helper& _params);
@@ -13,6 +13,71 @@
 
 #include "async_loader.h"
 
+namespace
+{
+    const int32_t max_file_sharing_requests = 4;
+
+    const int64_t max_file_sharing_request_size = 2 * 1024 * 1024;
+
+    // writes a response into its range of the preallocated file
+    class file_range_stream
+        : public core::tools::stream
+    {
+    public:
+        file_range_stream(std::ofstream&& _file, core::wim::downloadable_file_chunks_ptr _file_chunks, int64_t _range_id)
+            : file_(std::move(_file))
+            , file_chunks_(std::move(_file_chunks))
+            , range_id_(_range_id)
+            , bytes_writed_(0)
+            , failed_(!file_.good())
+        {
+        }
+
+        void write(const char* _data, uint32_t _size) override
+        {
+            bytes_writed_ += _size;
+
+            if (failed_)
+                return;
+
+            const auto size = file_chunks_->advance_range(range_id_, _size);
+            if (size == 0)
+                return;
+
+            file_.write(_data, size);
+            if (!file_.good())
+                failed_ = true;
+        }
+
+        uint32_t all_size() const override
+        {
+            return bytes_writed_;
+        }
+
+        void close() override
+        {
+            if (!file_.is_open())
+                return;
+
+            file_.close();
+            if (file_.fail())
+                failed_ = true;
+        }
+
+        bool is_failed() const
+        {
+            return failed_;
+        }
+
+    private:
+        std::ofstream file_;
+        core::wim::downloadable_file_chunks_ptr file_chunks_;
+        int64_t range_id_;
+        uint32_t bytes_writed_;
+        bool failed_;
+    };
+}
+
 core::wim::async_loader::async_loader(const std::wstring& _content_cache_dir)
     : content_cache_dir_(_content_cache_dir)
 {
@@ -437,19 +502,6 @@ void core::wim::async_loader::download_file_sharing(
             }
 
             auto file_chunks = std::make_shared<downloadable_file_chunks>(_priority, _contact, meta->file_download_url_, file_path, meta->file_size_);
-            file_chunks->downloaded_ = tools::system::get_file_size(file_chunks->tmp_file_name_);
-
-            if (file_chunks->total_size_ == file_chunks->downloaded_)
-            {
-                if (!tools::system::move_file(file_chunks->tmp_file_name_, file_chunks->file_name_))
-                {
-                    fire_callback(loader_errors::move_file, data, _handler.completion_callback_);
-                    return;
-                }
-
-                fire_callback(loader_errors::success, data, _handler.completion_callback_);
-                return;
-            }
 
             {
                 boost::lock_guard<boost::mutex> lock(ptr_this->in_progress_mutex_);
@@ -463,6 +515,12 @@ void core::wim::async_loader::download_file_sharing(
                 ptr_this->in_progress_[_url] = file_chunks;
             }
 
+            if (!file_chunks->open_tmp_file())
+            {
+                ptr_this->fire_chunks_callback(loader_errors::save_2_file, _url);
+                return;
+            }
+
             ptr_this->download_file_sharing_impl(_url, _wim_params, file_chunks);
         }));
 }
@@ -508,14 +566,34 @@ void core::wim::async_loader::contact_switched(const std::string& _contact)
 
 void core::wim::async_loader::download_file_sharing_impl(std::string _url, wim_packet_params _wim_params, downloadable_file_chunks_ptr _file_chunks)
 {
-    if (_file_chunks->cancel_)
+    // holds the download until all the requests are started, so it can't be finished in between
+    _file_chunks->add_request();
+
+    if (!_file_chunks->cancel_)
     {
-        tools::system::delete_file(_file_chunks->tmp_file_name_);
-        fire_chunks_callback(loader_errors::cancelled, _url);
-        return;
+        for (int32_t i = 0; i < max_file_sharing_requests; ++i)
+        {
+            if (!start_file_sharing_request(_url, _wim_params, _file_chunks))
+                break;
+        }
     }
 
-    auto progress = [_file_chunks, this](int64_t /*_total*/, int64_t _transferred, int32_t /*_in_percentages*/)
+    if (_file_chunks->release_request() == 0)
+        finish_file_sharing(_url, _file_chunks);
+}
+
+bool core::wim::async_loader::start_file_sharing_request(const std::string& _url, const wim_packet_params& _wim_params, downloadable_file_chunks_ptr _file_chunks)
+{
+    // a low priority download is requested by parts, so a new priority is applied soon
+    const auto max_size = _file_chunks->priority_ <= highest_priority ? _file_chunks->total_size_ : max_file_sharing_request_size;
+
+    int64_t range_id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+    if (!_file_chunks->take_range(max_size, range_id, begin, end))
+        return false;
+
+    auto progress = [_file_chunks, this](int64_t /*_total*/, int64_t /*_transferred*/, int32_t /*_in_percentages*/)
     {
         downloadable_file_chunks::handler_list_t handler_list;
 
@@ -524,7 +602,7 @@ void core::wim::async_loader::download_file_sharing_impl(std::string _url, wim_p
             handler_list = _file_chunks->handlers_;
         }
 
-        const auto downloaded = _file_chunks->downloaded_ + _transferred;
+        const auto downloaded = _file_chunks->get_downloaded();
         for (auto& handler : handler_list)
         {
             if (handler.progress_callback_)
@@ -537,9 +615,10 @@ void core::wim::async_loader::download_file_sharing_impl(std::string _url, wim_p
         }
     };
 
-    auto stop = [_file_chunks]()
+    // the range is over when another request took its tail
+    auto stop = [_file_chunks, range_id]()
     {
-        return _file_chunks->cancel_;
+        return _file_chunks->cancel_ || _file_chunks->is_range_over(range_id);
     };
 
     auto user_proxy = g_core->get_proxy_settings();
@@ -551,78 +630,95 @@ void core::wim::async_loader::download_file_sharing_impl(std::string _url, wim_p
     request->set_keep_alive();
     request->replace_host(_wim_params.hosts_);
     request->set_priority(_file_chunks->priority_);
+    request->set_range(begin, end - 1);
 
-    constexpr int64_t max_chunk_size = 512 * 1024;
-    const auto bytes_left = _file_chunks->total_size_ - _file_chunks->downloaded_;
-    const auto chunk_size = _file_chunks->priority_ <= highest_priority
-        ? bytes_left
-        : bytes_left < max_chunk_size ? bytes_left : max_chunk_size;
-
-    request->set_range(_file_chunks->downloaded_, _file_chunks->downloaded_ + chunk_size);
+    auto tmp_file = tools::system::open_file_for_write(_file_chunks->tmp_file_name_, std::ios::binary | std::ios::in | std::ios::out);
+    tmp_file.seekp(begin);
 
-    const auto flags = _file_chunks->downloaded_ > 0
-        ? std::ios::binary | std::ios::app
-        : std::ios::binary | std::ios::trunc;
+    auto output = std::make_shared<file_range_stream>(std::move(tmp_file), _file_chunks, range_id);
+    request->set_output_stream(output);
 
-    auto tmp_file = tools::system::open_file_for_write(_file_chunks->tmp_file_name_, flags);
+    std::weak_ptr<async_loader> wr_this(shared_from_this());
 
-    if (!tmp_file.good())
+    request->get_async([_url, _wim_params, _file_chunks, request, output, range_id, begin, wr_this](bool /*_success*/)
     {
-        fire_chunks_callback(loader_errors::save_2_file, _url);
-        return;
-    }
+        output->close();
 
-    request->set_output_stream(std::make_shared<tools::file_output_stream>(std::move(tmp_file)));
+        const auto code = request->get_response_code();
 
-    std::weak_ptr<async_loader> wr_this(shared_from_this());
+        // a server which ignores the range sends the file from its beginning
+        const auto valid_data = (code == 206 || ((code == 200 || code == 201) && begin == 0));
+
+        auto finished = false;
+        if (output->is_failed())
+        {
+            _file_chunks->save_failed_ = true;
+            _file_chunks->invalidate_range(range_id);
+        }
+        else if (output->all_size() != 0 && !valid_data)
+        {
+            _file_chunks->invalidate_range(range_id);
+        }
+        else
+        {
+            finished = _file_chunks->finish_range(range_id);
+        }
+
+        _file_chunks->save_blocks();
 
-    request->get_async([_url, _wim_params, _file_chunks, request, wr_this](bool _success) mutable
-    {
         std::shared_ptr<async_loader> ptr_this = wr_this.lock();
         if (!ptr_this)
             return;
 
-        const auto code = request->get_response_code();
-        if (_success && (code == 206 || code == 200 || code == 201))
-        {
-            const auto size = request->get_response()->all_size();
-            _file_chunks->downloaded_ += size;
+        // a failed or timed out request is replaced too, its range is free again and its tail is taken by the new one
+        if (!_file_chunks->cancel_ && !_file_chunks->save_failed_ && (finished || _file_chunks->can_retry()))
+            ptr_this->start_file_sharing_request(_url, _wim_params, _file_chunks);
 
-            request->get_response()->close();
+        if (_file_chunks->release_request() == 0)
+            ptr_this->finish_file_sharing(_url, _file_chunks);
+    });
 
-            if (_file_chunks->total_size_ == _file_chunks->downloaded_)
-            {
-                if (!tools::system::move_file(_file_chunks->tmp_file_name_, _file_chunks->file_name_))
-                {
-                    ptr_this->fire_chunks_callback(loader_errors::move_file, _url);
-                    return;
-                }
+    return true;
+}
 
-                ptr_this->fire_chunks_callback(loader_errors::success, _url);
-                return;
-            }
+void core::wim::async_loader::finish_file_sharing(const std::string& _url, downloadable_file_chunks_ptr _file_chunks)
+{
+    if (_file_chunks->cancel_)
+    {
+        _file_chunks->delete_tmp_files();
+        fire_chunks_callback(loader_errors::cancelled, _url);
+        return;
+    }
 
-            ptr_this->download_file_sharing_impl(_url, _wim_params, _file_chunks);
-        }
-        else
-        {
-            if (_file_chunks->cancel_)
-            {
-                request->get_response()->close();
-                tools::system::delete_file(_file_chunks->tmp_file_name_);
-                ptr_this->fire_chunks_callback(loader_errors::cancelled, _url);
-                return;
-            }
+    if (_file_chunks->save_failed_)
+    {
+        fire_chunks_callback(loader_errors::save_2_file, _url);
+        return;
+    }
 
-            ptr_this->suspended_tasks_.push([_url, _file_chunks, wr_this](const wim_packet_params& wim_params)
-            {
-                std::shared_ptr<async_loader> ptr_this = wr_this.lock();
-                if (!ptr_this)
-                    return;
+    if (_file_chunks->is_completed())
+    {
+        _file_chunks->delete_blocks_file();
 
-                ptr_this->download_file_sharing_impl(_url, wim_params, _file_chunks);
-            });
+        if (!tools::system::move_file(_file_chunks->tmp_file_name_, _file_chunks->file_name_))
+        {
+            fire_chunks_callback(loader_errors::move_file, _url);
+            return;
         }
+
+        fire_chunks_callback(loader_errors::success, _url);
+        return;
+    }
+
+    std::weak_ptr<async_loader> wr_this(shared_from_this());
+
+    suspended_tasks_.push([_url, _file_chunks, wr_this](const wim_packet_params& wim_params)
+    {
+        std::shared_ptr<async_loader> ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
+
+        ptr_this->download_file_sharing_impl(_url, wim_params, _file_chunks);
     });
 }
 
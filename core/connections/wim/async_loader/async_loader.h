@@ -66,6 +66,8 @@ namespace core
 
         private:
             void download_file_sharing_impl(std::string _url, wim_packet_params _wim_params, downloadable_file_chunks_ptr _file_chunks);
+            bool start_file_sharing_request(const std::string& _url, const wim_packet_params& _wim_params, downloadable_file_chunks_ptr _file_chunks);
+            void finish_file_sharing(const std::string& _url, downloadable_file_chunks_ptr _file_chunks);
 
             static void update_file_chunks(downloadable_file_chunks& _file_chunks, priority_t _new_priority, file_info_handler_t _additional_handlers);
 
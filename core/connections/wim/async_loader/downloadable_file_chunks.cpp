@@ -1,13 +1,42 @@
 #include "stdafx.h"
 
+#include "../../../tools/system.h"
+
 #include "downloadable_file_chunks.h"
 
+namespace
+{
+    const int32_t blocks_file_version = 1;
+
+    // a request which got nothing for so long gives away the rest of its range,
+    // it is less than the idle timeout of a request, so the range is taken over before the request fails
+    const auto stall_timeout = std::chrono::seconds(4);
+
+    // requests in a row which closed without data, the download is suspended after them
+    const int32_t max_empty_requests = 4;
+
+    // a running range is split only if both halves are at least that big
+    const int64_t min_split_size = 2 * core::wim::downloadable_file_chunks::block_size;
+
+    int64_t align_up(int64_t _value)
+    {
+        const auto block_size = core::wim::downloadable_file_chunks::block_size;
+        return (_value + block_size - 1) / block_size * block_size;
+    }
+}
+
+const int64_t core::wim::downloadable_file_chunks::block_size;
+
 core::wim::downloadable_file_chunks::downloadable_file_chunks()
     : priority_on_start_(default_priority)
     , priority_(default_priority)
-    , downloaded_(0)
     , total_size_(0)
     , cancel_(true)
+    , save_failed_(false)
+    , done_size_(0)
+    , last_range_id_(0)
+    , requests_(0)
+    , empty_requests_(0)
 {
 }
 
@@ -18,9 +47,360 @@ core::wim::downloadable_file_chunks::downloadable_file_chunks(
     , url_(_url)
     , file_name_(_file_name)
     , tmp_file_name_(_file_name + L".tmp")
-    , downloaded_(0)
     , total_size_(_total_size)
     , cancel_(false)
+    , save_failed_(false)
+    , done_size_(0)
+    , last_range_id_(0)
+    , requests_(0)
+    , empty_requests_(0)
 {
     contacts_.emplace_back(std::hash<std::string>()(_contact));
 }
+
+bool core::wim::downloadable_file_chunks::open_tmp_file()
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    blocks_.assign(static_cast<size_t>((total_size_ + block_size - 1) / block_size), false);
+    durable_blocks_.assign(blocks_.size(), false);
+    done_size_ = 0;
+
+    if (!tools::system::is_exist(tmp_file_name_))
+    {
+        if (!tools::system::create_empty_file(tmp_file_name_))
+            return false;
+    }
+    else if (!load_blocks())
+    {
+        const auto prefix = std::min<int64_t>(tools::system::get_file_size(tmp_file_name_), total_size_);
+
+        for (size_t block = 0; block < blocks_.size(); ++block)
+        {
+            if (static_cast<int64_t>(block) * block_size + get_block_size(block) > prefix)
+                break;
+
+            blocks_[block] = true;
+            durable_blocks_[block] = true;
+            done_size_ += get_block_size(block);
+        }
+    }
+
+    // a full size tmp file without the blocks file would be taken for a whole prefix
+    if (!write_blocks_file())
+        return false;
+
+    boost::system::error_code error;
+    boost::filesystem::resize_file(boost::filesystem::wpath(tmp_file_name_), static_cast<uintmax_t>(total_size_), error);
+
+    return !error;
+}
+
+void core::wim::downloadable_file_chunks::delete_tmp_files() const
+{
+    tools::system::delete_file(tmp_file_name_);
+    delete_blocks_file();
+}
+
+void core::wim::downloadable_file_chunks::delete_blocks_file() const
+{
+    tools::system::delete_file(get_blocks_file_name());
+}
+
+bool core::wim::downloadable_file_chunks::is_completed() const
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    return done_size_ == total_size_;
+}
+
+int64_t core::wim::downloadable_file_chunks::get_downloaded() const
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    auto downloaded = done_size_;
+
+    // and the beginnings of the blocks being written
+    for (const auto& it : ranges_)
+    {
+        const auto block = static_cast<size_t>(it.second.position_ / block_size);
+        if (block < blocks_.size() && !blocks_[block])
+            downloaded += it.second.position_ % block_size;
+    }
+
+    return downloaded;
+}
+
+bool core::wim::downloadable_file_chunks::take_range(int64_t _max_size, int64_t& _id, int64_t& _begin, int64_t& _end, std::chrono::steady_clock::time_point _now)
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    size_t first = 0;
+    while (first < blocks_.size() && (blocks_[first] || is_block_taken(first)))
+        ++first;
+
+    if (first < blocks_.size())
+    {
+        auto last = first;
+        while (last < blocks_.size() && !blocks_[last] && !is_block_taken(last) && static_cast<int64_t>(last - first) * block_size < _max_size)
+            ++last;
+
+        _begin = static_cast<int64_t>(first) * block_size;
+        _end = std::min(static_cast<int64_t>(last) * block_size, total_size_);
+    }
+    else
+    {
+        // any stalled range with a tail left goes first, the largest of them, then the slowest running one
+        auto slowest = ranges_.end();
+        auto stalled = false;
+        for (auto it = ranges_.begin(); it != ranges_.end(); ++it)
+        {
+            const auto& r = it->second;
+
+            const auto is_stalled = (_now - r.last_progress_ > stall_timeout && align_up(r.position_) < r.end_);
+            if (stalled && !is_stalled)
+                continue;
+
+            if (slowest == ranges_.end() || is_stalled != stalled || r.end_ - r.position_ > slowest->second.end_ - slowest->second.position_)
+            {
+                slowest = it;
+                stalled = is_stalled;
+            }
+        }
+
+        if (slowest == ranges_.end())
+            return false;
+
+        auto& running = slowest->second;
+
+        const auto split = (stalled
+            ? align_up(running.position_)
+            : align_up(running.position_ + (running.end_ - running.position_) / 2));
+
+        if (split >= running.end_)
+            return false;
+
+        if (!stalled && (split - running.position_ < min_split_size || running.end_ - split < min_split_size))
+            return false;
+
+        _begin = split;
+        _end = std::min(running.end_, split + _max_size);
+
+        running.end_ = split;
+    }
+
+    _id = ++last_range_id_;
+    ranges_[_id] = range{ _begin, _end, _begin, _now };
+
+    ++requests_;
+
+    return true;
+}
+
+int64_t core::wim::downloadable_file_chunks::advance_range(int64_t _id, int64_t _size)
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    const auto it = ranges_.find(_id);
+    if (it == ranges_.end())
+        return 0;
+
+    auto& r = it->second;
+
+    const auto size = std::max<int64_t>(0, std::min(_size, r.end_ - r.position_));
+    if (size == 0)
+        return 0;
+
+    const auto from = r.position_;
+    r.position_ += size;
+    r.last_progress_ = std::chrono::steady_clock::now();
+
+    // a range starts at a block, so every block it reaches the end of is written by it
+    for (auto block = static_cast<size_t>(from / block_size); block < blocks_.size(); ++block)
+    {
+        const auto block_end = static_cast<int64_t>(block) * block_size + get_block_size(block);
+        if (block_end > r.position_)
+            break;
+
+        if (!blocks_[block])
+        {
+            blocks_[block] = true;
+            done_size_ += get_block_size(block);
+        }
+    }
+
+    return size;
+}
+
+bool core::wim::downloadable_file_chunks::is_range_over(int64_t _id) const
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    const auto it = ranges_.find(_id);
+
+    return (it == ranges_.end() || it->second.position_ >= it->second.end_);
+}
+
+bool core::wim::downloadable_file_chunks::finish_range(int64_t _id)
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    const auto it = ranges_.find(_id);
+    if (it == ranges_.end())
+        return false;
+
+    const auto& r = it->second;
+
+    // a range starts at a block, so every block it reaches the end of is written by it
+    for (auto block = static_cast<size_t>(r.begin_ / block_size); block < blocks_.size(); ++block)
+    {
+        if (static_cast<int64_t>(block) * block_size + get_block_size(block) > r.position_)
+            break;
+
+        durable_blocks_[block] = blocks_[block];
+    }
+
+    const auto finished = (r.position_ >= r.end_);
+
+    if (r.position_ > r.begin_)
+        empty_requests_ = 0;
+    else
+        ++empty_requests_;
+
+    ranges_.erase(it);
+
+    return finished;
+}
+
+void core::wim::downloadable_file_chunks::invalidate_range(int64_t _id)
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    const auto it = ranges_.find(_id);
+    if (it == ranges_.end())
+        return;
+
+    const auto& r = it->second;
+
+    for (auto block = static_cast<size_t>(r.begin_ / block_size); block < blocks_.size() && static_cast<int64_t>(block) * block_size < r.position_; ++block)
+    {
+        if (blocks_[block])
+        {
+            blocks_[block] = false;
+            done_size_ -= get_block_size(block);
+        }
+
+        durable_blocks_[block] = false;
+    }
+
+    ++empty_requests_;
+
+    ranges_.erase(it);
+}
+
+bool core::wim::downloadable_file_chunks::can_retry() const
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    return (empty_requests_ < max_empty_requests);
+}
+
+bool core::wim::downloadable_file_chunks::save_blocks() const
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    return write_blocks_file();
+}
+
+void core::wim::downloadable_file_chunks::add_request()
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    ++requests_;
+}
+
+int32_t core::wim::downloadable_file_chunks::release_request()
+{
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    assert(requests_ > 0);
+
+    return --requests_;
+}
+
+std::wstring core::wim::downloadable_file_chunks::get_blocks_file_name() const
+{
+    return tmp_file_name_ + L".blocks";
+}
+
+bool core::wim::downloadable_file_chunks::write_blocks_file() const
+{
+    tools::binary_stream bs;
+    bs.write<int32_t>(blocks_file_version);
+    bs.write<int64_t>(total_size_);
+    bs.write<int64_t>(block_size);
+
+    uint8_t byte = 0;
+    for (size_t block = 0; block < durable_blocks_.size(); ++block)
+    {
+        if (durable_blocks_[block])
+            byte |= (1 << (block % 8));
+
+        if (block % 8 == 7 || block + 1 == durable_blocks_.size())
+        {
+            bs.write<uint8_t>(byte);
+            byte = 0;
+        }
+    }
+
+    return bs.save_2_file(get_blocks_file_name());
+}
+
+bool core::wim::downloadable_file_chunks::load_blocks()
+{
+    tools::binary_stream bs;
+    if (!bs.load_from_file(get_blocks_file_name()))
+        return false;
+
+    const auto header_size = sizeof(int32_t) + 2 * sizeof(int64_t);
+    const auto bitmap_size = (blocks_.size() + 7) / 8;
+
+    if (bs.available() != header_size + bitmap_size)
+        return false;
+
+    if (bs.read<int32_t>() != blocks_file_version || bs.read<int64_t>() != total_size_ || bs.read<int64_t>() != block_size)
+        return false;
+
+    for (size_t block = 0; block < blocks_.size(); block += 8)
+    {
+        const auto byte = bs.read<uint8_t>();
+
+        for (size_t bit = 0; bit < 8 && block + bit < blocks_.size(); ++bit)
+        {
+            if (byte & (1 << bit))
+            {
+                blocks_[block + bit] = true;
+                durable_blocks_[block + bit] = true;
+                done_size_ += get_block_size(block + bit);
+            }
+        }
+    }
+
+    return true;
+}
+
+int64_t core::wim::downloadable_file_chunks::get_block_size(size_t _block) const
+{
+    return std::min(block_size, total_size_ - static_cast<int64_t>(_block) * block_size);
+}
+
+bool core::wim::downloadable_file_chunks::is_block_taken(size_t _block) const
+{
+    const auto begin = static_cast<int64_t>(_block) * block_size;
+    const auto end = begin + get_block_size(_block);
+
+    return std::any_of(ranges_.begin(), ranges_.end(), [begin, end](const std::pair<const int64_t, range>& _range)
+    {
+        return _range.second.position_ < end && begin < _range.second.end_;
+    });
+}
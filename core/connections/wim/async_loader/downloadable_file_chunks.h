@@ -7,11 +7,54 @@ namespace core
 {
     namespace wim
     {
+        // a file sharing download: several range requests write into a tmp file of the full size at once,
+        // the blocks of the closed ranges are saved next to it, so an interrupted download goes on from them
         struct downloadable_file_chunks
         {
+            static const int64_t block_size = 256 * 1024;
+
             downloadable_file_chunks();
             downloadable_file_chunks(priority_t _priority, const std::string& _contact, const std::string& _url, const std::wstring& _file_name, int64_t _total_size);
 
+            // loads the saved blocks (a tmp file without them is a prefix left by the sequential download),
+            // saves them and only then preallocates the tmp file
+            bool open_tmp_file();
+            void delete_tmp_files() const;
+            void delete_blocks_file() const;
+
+            bool is_completed() const;
+
+            int64_t get_downloaded() const;
+
+            // a free range of at most _max_size, or the tail of a stalled running range,
+            // or the second half of the slowest one; false if nothing is left which is worth a new request
+            bool take_range(int64_t _max_size, int64_t& _id, int64_t& _begin, int64_t& _end,
+                std::chrono::steady_clock::time_point _now = std::chrono::steady_clock::now());
+
+            // how much of the _size bytes written next into the range belong to it,
+            // 0 once it is finished or its tail is taken by another request
+            int64_t advance_range(int64_t _id, int64_t _size);
+
+            bool is_range_over(int64_t _id) const;
+
+            // the stream of the range is closed, its written blocks are saved from now on;
+            // true if the whole range is written
+            bool finish_range(int64_t _id);
+
+            // the data written into the range is wrong, its blocks are downloaded again
+            void invalidate_range(int64_t _id);
+
+            // a new request may replace the one whose range is not finished,
+            // unless the last requests in a row closed without writing anything
+            bool can_retry() const;
+
+            // only the blocks of the finished ranges, the others may be still unflushed
+            bool save_blocks() const;
+
+            // the running requests, the download is over when the last one is released
+            void add_request();
+            int32_t release_request();
+
             priority_t priority_on_start_;
             priority_t priority_;
 
@@ -20,15 +63,47 @@ namespace core
             std::wstring file_name_;
             std::wstring tmp_file_name_;
 
-            int64_t downloaded_;
             int64_t total_size_;
 
             bool cancel_;
+            bool save_failed_;
 
             typedef std::vector<async_handler<downloaded_file_info>> handler_list_t;
             handler_list_t handlers_;
 
             std::vector<hash_t> contacts_;
+
+        private:
+            struct range
+            {
+                int64_t begin_;
+                int64_t end_;
+                int64_t position_;
+
+                std::chrono::steady_clock::time_point last_progress_;
+            };
+
+            std::wstring get_blocks_file_name() const;
+
+            bool load_blocks();
+            bool write_blocks_file() const;
+
+            int64_t get_block_size(size_t _block) const;
+
+            bool is_block_taken(size_t _block) const;
+
+            // written, and written by a range which is closed already
+            std::vector<bool> blocks_;
+            std::vector<bool> durable_blocks_;
+            int64_t done_size_;
+
+            std::map<int64_t, range> ranges_;
+            int64_t last_range_id_;
+
+            int32_t requests_;
+            int32_t empty_requests_;
+
+            mutable boost::mutex mutex_;
         };
 
         typedef std::shared_ptr<downloadable_file_chunks> downloadable_file_chunks_ptr;
@@ -75,6 +75,105 @@ namespace core
                 }
 
             };
+
+            // contacts waiting for their holes to be filled, a few are downloaded at once;
+            // pages of one contact go one after another since the next hole is known
+            // only after the previous page is written. Opened dialogs are not limited,
+            // they must not wait behind long background downloads
+            class scheduler
+            {
+            public:
+                struct job
+                {
+                    holes::request request_;
+                    std::function<void(int64_t)> last_message_catcher_;
+                    bool priority_;
+
+                    job(const holes::request& _request, std::function<void(int64_t)> _last_message_catcher)
+                        : request_(_request)
+                        , last_message_catcher_(std::move(_last_message_catcher))
+                        , priority_(false)
+                    {
+                    }
+                };
+
+            private:
+                const uint32_t max_running_;
+
+                std::list<job> queue_;
+
+                std::set<std::string> running_;
+
+            public:
+                explicit scheduler(uint32_t _max_running)
+                    : max_running_(_max_running)
+                {
+                    assert(max_running_ > 0);
+                }
+
+                void push(const job& _job, bool _priority)
+                {
+                    if (_priority)
+                    {
+                        queue_.push_front(_job);
+                        queue_.front().priority_ = true;
+                    }
+                    else
+                    {
+                        queue_.push_back(_job);
+                    }
+                }
+
+                // moves the jobs of the opened dialog ahead of the others
+                void prioritize(const std::string& _contact)
+                {
+                    std::list<job> jobs;
+
+                    for (auto iter = queue_.begin(); iter != queue_.end();)
+                    {
+                        if (iter->request_.get_contact() == _contact)
+                        {
+                            iter->priority_ = true;
+                            jobs.splice(jobs.end(), queue_, iter++);
+                        }
+                        else
+                            ++iter;
+                    }
+
+                    queue_.splice(queue_.begin(), jobs);
+                }
+
+                // the first queued job of a contact which is not being downloaded now,
+                // jobs of opened dialogs are started even if all the slots are busy
+                std::shared_ptr<job> pop()
+                {
+                    const auto is_full = (running_.size() >= max_running_);
+
+                    for (auto iter = queue_.begin(); iter != queue_.end(); ++iter)
+                    {
+                        if (is_full && !iter->priority_)
+                            continue;
+
+                        const auto& contact = iter->request_.get_contact();
+                        if (running_.count(contact))
+                            continue;
+
+                        running_.insert(contact);
+
+                        auto next = std::make_shared<job>(*iter);
+                        queue_.erase(iter);
+
+                        return next;
+                    }
+
+                    return nullptr;
+                }
+
+                void finish(const std::string& _contact)
+                {
+                    running_.erase(_contact);
+                }
+            };
         }
     }
 }
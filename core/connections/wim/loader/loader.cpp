@@ -28,6 +28,8 @@ using namespace wim;
 
 namespace
 {
+    const int32_t upload_threads_count = 4;
+
     bool is_suspendable_error(const loader_errors _error);
 
     template<typename T>
@@ -47,6 +49,7 @@ namespace
 
 loader::loader(const std::wstring &_cache_dir)
     : file_sharing_threads_(std::make_unique<async_executer>(1))
+    , upload_threads_(std::make_unique<async_executer>(upload_threads_count))
     , cache_(disk_cache::disk_cache::make(_cache_dir))
 {
     initialize_tasks_runners();
@@ -159,17 +162,30 @@ void loader::set_played(const std::string& _file_url, const std::wstring& _previ
 }
 
 void loader::send_task_ranges_async(std::weak_ptr<upload_task> _wr_task)
+{
+    auto task = _wr_task.lock();
+    if (!task)
+        return;
+
+    int64_t offset = 0;
+    int64_t size = 0;
+
+    while (task->take_range(offset, size))
+        send_task_range_async(task, offset, size);
+}
+
+void loader::send_task_range_async(std::weak_ptr<upload_task> _wr_task, int64_t _offset, int64_t _size)
 {
     std::weak_ptr<loader> wr_this = shared_from_this();
 
-    file_sharing_threads_->run_async_function(
-        [_wr_task]
+    upload_threads_->run_async_function(
+        [_wr_task, _offset, _size]
         {
             auto task = _wr_task.lock();
             if (!task)
                 return -1;
 
-            return (int32_t)task->send_next_range();
+            return (int32_t)task->send_range(_offset, _size);
         }
     )->on_result_ =
         [wr_this, _wr_task](int32_t _error)
@@ -182,6 +198,10 @@ void loader::send_task_ranges_async(std::weak_ptr<upload_task> _wr_task)
             if (!task)
                 return;
 
+            // aborted or already finished by another range
+            if (!ptr_this->has_file_sharing_task(task->get_id()))
+                return;
+
             if (_error != 0)
             {
                 task->set_last_error(_error);
@@ -194,15 +214,16 @@ void loader::send_task_ranges_async(std::weak_ptr<upload_task> _wr_task)
 
             ptr_this->on_file_sharing_task_progress(task);
 
-            if (!task->is_end())
-            {
-                ptr_this->send_task_ranges_async(task);
-            }
-            else
+            if (task->is_end())
             {
                 ptr_this->on_file_sharing_task_result(task, 0);
                 g_core->insert_event(core::stats::stats_event_names::filesharing_sent_success);
             }
+            else if (task->get_last_error() == 0)
+            {
+                // the ranges in flight are finished after a network error, the rest waits for the resume
+                ptr_this->send_task_ranges_async(task);
+            }
         };
 }
 
@@ -55,6 +55,8 @@ class loader : public std::enable_shared_from_this<loader>
 
     std::unique_ptr<async_executer> file_sharing_threads_;
 
+    std::unique_ptr<async_executer> upload_threads_;
+
     disk_cache::disk_cache_sptr cache_;
 
     std::string priority_contact_;
@@ -67,6 +69,8 @@ class loader : public std::enable_shared_from_this<loader>
 
     void on_file_sharing_task_progress(std::shared_ptr<fs_loader_task> _task);
 
+    void send_task_range_async(std::weak_ptr<upload_task> _wr_task, int64_t _offset, int64_t _size);
+
     void add_task(loader_task_sptr _task);
 
     void initialize_tasks_runners();
@@ -15,13 +15,26 @@ using namespace core;
 using namespace wim;
 
 const int32_t status_code_too_large_file	= 413;
-const int32_t max_block_size				= 1024*1024;
+
+const int64_t initial_range_size			= 1024*1024;
+const int64_t min_range_size				= 256*1024;
+const int64_t max_range_size				= 4*1024*1024;
+const int64_t range_size_alignment			= 64*1024;
+
+const int32_t max_ranges_in_flight			= 4;
+
+// a range is sized to take about so long with the measured throughput
+const auto range_duration					= std::chrono::seconds(2);
 
 upload_task::upload_task(const std::string &_id, const wim_packet_params& _params, const std::wstring& _file_name)
     : fs_loader_task(_id, _params)
     , file_name_(_file_name)
     , file_size_(0)
     , bytes_sent_(0)
+    , next_offset_(0)
+    , ranges_in_flight_(0)
+    , range_size_(initial_range_size)
+    , throughput_(0)
 {
     session_id_ = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 }
@@ -85,44 +98,107 @@ loader_errors upload_task::open_file()
 
     file_stream_.seekg (0, std::ifstream::beg);
 
-    out_buffer_.reserve(max_block_size);
-
     return loader_errors::success;
 }
 
-loader_errors upload_task::read_data_from_file()
+bool upload_task::take_range(int64_t& _offset, int64_t& _size)
 {
-    out_buffer_.reset();
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    // the first range opens the session on the server and gives the first throughput
+    const auto max_in_flight = (bytes_sent_ == 0 ? 1 : max_ranges_in_flight);
+    if (ranges_in_flight_ >= max_in_flight)
+        return false;
+
+    if (!failed_ranges_.empty())
+    {
+        _offset = failed_ranges_.front().offset_;
+        _size = failed_ranges_.front().size_;
+
+        failed_ranges_.pop_front();
+    }
+    else
+    {
+        if (next_offset_ >= file_size_)
+            return false;
+
+        _offset = next_offset_;
+        _size = std::min(range_size_, file_size_ - next_offset_);
+
+        next_offset_ += _size;
+    }
+
+    ++ranges_in_flight_;
+
+    return true;
+}
+
+loader_errors upload_task::send_range(int64_t _offset, int64_t _size)
+{
+    core::tools::binary_stream buffer;
+
+    auto res = read_data_from_file(_offset, _size, buffer);
+    if (res == loader_errors::success)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::string file_url;
+        res = send_data_to_server(_offset, buffer, file_url);
+
+        if (res == loader_errors::success)
+        {
+            boost::lock_guard<boost::mutex> lock(mutex_);
 
-    int64_t tail = file_size_ - bytes_sent_;
-    int64_t read_size = max_block_size;
+            bytes_sent_ += _size;
+            assert(bytes_sent_ <= file_size_);
 
-    if (tail <= 0)
+            if (!file_url.empty())
+                file_url_ = std::move(file_url);
+
+            update_range_size(_size, std::chrono::steady_clock::now() - start);
+
+            --ranges_in_flight_;
+
+            return res;
+        }
+    }
+
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
+    failed_ranges_.push_back(range{ _offset, _size });
+
+    --ranges_in_flight_;
+
+    return res;
+}
+
+loader_errors upload_task::read_data_from_file(int64_t _offset, int64_t _size, core::tools::binary_stream& _buffer)
+{
+    if (_size <= 0 || _offset + _size > file_size_)
     {
         assert(false);
         return loader_errors::internal_logic_error;
     }
 
-    if (tail <= max_block_size)
-        read_size = tail;
+    boost::lock_guard<boost::mutex> lock(file_mutex_);
 
-    file_stream_.seekg(bytes_sent_, std::ifstream::beg);
+    file_stream_.seekg(_offset, std::ifstream::beg);
 
-    file_stream_.read(out_buffer_.alloc_buffer((uint32_t)read_size), read_size);
+    file_stream_.read(_buffer.alloc_buffer((uint32_t)_size), _size);
     if (!file_stream_.good())
         return loader_errors::read_from_file;
 
     return loader_errors::success;
 }
 
-loader_errors upload_task::send_data_to_server()
+loader_errors upload_task::send_data_to_server(int64_t _offset, core::tools::binary_stream& _buffer, std::string& _file_url)
 {
     send_file_params chunk;
-    chunk.size_already_sent_ = bytes_sent_;
-    chunk.current_chunk_size_ = out_buffer_.available();
+    chunk.size_already_sent_ = _offset;
+    chunk.current_chunk_size_ = _buffer.available();
     chunk.full_data_size_ = file_size_;
     chunk.file_name_ = core::tools::from_utf16(file_name_short_);
-    chunk.data_ = out_buffer_.read(out_buffer_.available());
+    chunk.data_ = _buffer.read(_buffer.available());
     chunk.session_id_ = session_id_;
 
     send_file packet(get_wim_params(), chunk, upload_host_, upload_url_);
@@ -136,32 +212,32 @@ loader_errors upload_task::send_data_to_server()
         return loader_errors::send_range;
     }
 
-    bytes_sent_ += chunk.current_chunk_size_;
-
+    // the server answers so to the range which completes the file
     if (packet.get_status_code() == 200)
-    {
-        file_url_ = packet.get_file_url();
-        assert(bytes_sent_ == file_size_);
-    }
-    else
-    {
-        assert(bytes_sent_ < file_size_);
-    }
+        _file_url = packet.get_file_url();
 
     return loader_errors::success;
 }
 
-loader_errors upload_task::send_next_range()
+void upload_task::update_range_size(int64_t _size, std::chrono::steady_clock::duration _duration)
 {
-    auto res = read_data_from_file();
-    if (res != loader_errors::success)
-        return res;
+    const auto seconds = std::chrono::duration_cast<std::chrono::duration<double>>(_duration).count();
+    if (seconds <= 0)
+        return;
 
-    return send_data_to_server();
+    const auto throughput = _size / seconds;
+
+    throughput_ = (throughput_ == 0 ? throughput : (throughput_ * 3 + throughput) / 4);
+
+    const auto size = static_cast<int64_t>(throughput_ * std::chrono::duration_cast<std::chrono::duration<double>>(range_duration).count());
+
+    range_size_ = std::max(min_range_size, std::min(max_range_size, size / range_size_alignment * range_size_alignment));
 }
 
-bool upload_task::is_end()
+bool upload_task::is_end() const
 {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
     assert(bytes_sent_ <= file_size_);
 
     return (bytes_sent_ == file_size_);
@@ -194,6 +270,8 @@ std::shared_ptr<web_file_info> upload_task::make_info() const
 {
     auto info = std::make_shared<web_file_info>();
 
+    boost::lock_guard<boost::mutex> lock(mutex_);
+
     info->set_file_name(file_name_);
     info->set_bytes_transfer(bytes_sent_);
     info->set_file_size(file_size_);
@@ -11,27 +11,55 @@ namespace core
         struct upload_progress_handler;
         class web_file_info;
 
+        // the ranges of the file are sent by several requests at once,
+        // the server puts them together by the session id whatever order they come in
         class upload_task : public fs_loader_task, public std::enable_shared_from_this<upload_task>
         {
+            struct range
+            {
+                int64_t offset_;
+                int64_t size_;
+            };
+
             std::wstring				file_name_;
             std::wstring				file_name_short_;
             std::ifstream				file_stream_;
             int64_t						file_size_;
-            int64_t						bytes_sent_;
 
             std::string					upload_host_;
             std::string					upload_url_;
 
-            core::tools::binary_stream	out_buffer_;
-
             int64_t						session_id_;
 
             std::string					file_url_;
 
             std::shared_ptr<upload_progress_handler>	handler_;
 
-            loader_errors read_data_from_file();
-            loader_errors send_data_to_server();
+            // guards the ranges, the sent bytes and the file url
+            mutable boost::mutex		mutex_;
+
+            boost::mutex				file_mutex_;
+
+            // the bytes confirmed by the server
+            int64_t						bytes_sent_;
+
+            // the beginning of the part of the file which is not taken yet
+            int64_t						next_offset_;
+
+            // failed ranges are sent again before the rest of the file
+            std::deque<range>			failed_ranges_;
+
+            int32_t						ranges_in_flight_;
+
+            int64_t						range_size_;
+
+            // bytes per second of one request
+            double						throughput_;
+
+            loader_errors read_data_from_file(int64_t _offset, int64_t _size, core::tools::binary_stream& _buffer);
+            loader_errors send_data_to_server(int64_t _offset, core::tools::binary_stream& _buffer, std::string& _file_url);
+
+            void update_range_size(int64_t _size, std::chrono::steady_clock::duration _duration);
 
             virtual void resume(loader& _loader) override;
 
@@ -40,11 +68,16 @@ namespace core
             upload_task(const std::string &_id, const wim_packet_params& _params, const std::wstring& _file_name);
             virtual ~upload_task();
 
-            bool is_end();
+            bool is_end() const;
 
             loader_errors get_gate();
             loader_errors open_file();
-            loader_errors send_next_range();
+
+            // false if there are enough requests in flight or nothing is left to send
+            bool take_range(int64_t& _offset, int64_t& _size);
+
+            // can be called for different ranges at once
+            loader_errors send_range(int64_t _offset, int64_t _size);
 
             const std::string& get_file_url() const;
 
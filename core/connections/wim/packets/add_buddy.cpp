@@ -24,6 +24,11 @@ add_buddy::~add_buddy()
 {
 }
 
+ordering_key add_buddy::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t add_buddy::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
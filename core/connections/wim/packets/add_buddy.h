@@ -35,6 +35,8 @@ namespace core
                 const std::string& _group,
                 const std::string& _auth_message);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~add_buddy();
         };
 
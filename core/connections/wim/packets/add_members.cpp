@@ -21,6 +21,11 @@ add_members::~add_members()
 {
 }
 
+ordering_key add_members::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t add_members::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
@@ -33,6 +33,8 @@ namespace core
                 const std::string& _aimid,
                 const std::string & _members_to_add);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~add_members();
         };
 
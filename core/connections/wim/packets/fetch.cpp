@@ -24,12 +24,316 @@
 
 #include "../../../log/log.h"
 
+#include "rapidjson/reader.h"
+
 
 using namespace core;
 using namespace wim;
 
 const auto default_fetch_timeout = std::chrono::milliseconds(500);
 
+namespace
+{
+    struct fetch_response_info
+    {
+        bool has_response_;
+
+        bool has_status_code_;
+        uint32_t status_code_;
+
+        bool has_status_text_;
+        std::string status_text_;
+
+        bool has_status_detail_code_;
+        uint32_t status_detail_code_;
+
+        bool has_data_;
+
+        bool has_fetch_base_url_;
+        std::string fetch_base_url_;
+
+        bool has_time_to_next_fetch_;
+        uint32_t time_to_next_fetch_;
+
+        bool has_ts_;
+        uint32_t ts_;
+
+        fetch_response_info()
+            : has_response_(false)
+            , has_status_code_(false)
+            , status_code_(0)
+            , has_status_text_(false)
+            , has_status_detail_code_(false)
+            , status_detail_code_(0)
+            , has_data_(false)
+            , has_fetch_base_url_(false)
+            , has_time_to_next_fetch_(false)
+            , time_to_next_fetch_(0)
+            , has_ts_(false)
+            , ts_(0)
+        {
+        }
+    };
+
+    // reads the response without a document for all of it,
+    // each of response.data.events is passed as text once its object is closed
+    class fetch_response_reader
+        : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, fetch_response_reader>
+    {
+    public:
+        typedef std::function<void(const char* _json, size_t _size)> event_callback;
+
+        fetch_response_reader(const rapidjson::StringStream& _stream, event_callback _on_event)
+            : stream_(_stream)
+            , on_event_(std::move(_on_event))
+            , event_begin_(0)
+        {
+        }
+
+        const fetch_response_info& get_info() const
+        {
+            return info_;
+        }
+
+        bool StartObject()
+        {
+            return start(true);
+        }
+
+        bool EndObject(rapidjson::SizeType /*_count*/)
+        {
+            return end();
+        }
+
+        bool StartArray()
+        {
+            return start(false);
+        }
+
+        bool EndArray(rapidjson::SizeType /*_count*/)
+        {
+            return end();
+        }
+
+        bool Key(const char* _str, rapidjson::SizeType _length, bool /*_copy*/)
+        {
+            // the keys inside the events are read by their documents
+            if (is_known_object())
+                key_.assign(_str, _length);
+
+            return true;
+        }
+
+        bool String(const char* _str, rapidjson::SizeType _length, bool /*_copy*/)
+        {
+            if (is_value(context::response, "statusText"))
+            {
+                info_.status_text_.assign(_str, _length);
+                info_.has_status_text_ = true;
+            }
+            else if (is_value(context::data, "fetchBaseURL"))
+            {
+                info_.fetch_base_url_.assign(_str, _length);
+                info_.has_fetch_base_url_ = true;
+            }
+
+            return true;
+        }
+
+        bool Uint(unsigned _value)
+        {
+            if (is_value(context::response, "statusCode"))
+            {
+                info_.status_code_ = _value;
+                info_.has_status_code_ = true;
+            }
+            else if (is_value(context::response, "statusDetailCode"))
+            {
+                info_.status_detail_code_ = _value;
+                info_.has_status_detail_code_ = true;
+            }
+            else if (is_value(context::data, "timeToNextFetch"))
+            {
+                info_.time_to_next_fetch_ = _value;
+                info_.has_time_to_next_fetch_ = true;
+            }
+            else if (is_value(context::data, "ts"))
+            {
+                info_.ts_ = _value;
+                info_.has_ts_ = true;
+            }
+
+            return true;
+        }
+
+        bool Default()
+        {
+            return true;
+        }
+
+    private:
+        enum class context
+        {
+            root,
+            response,
+            data,
+            events,
+            event,
+            skipped
+        };
+
+        bool start(bool _object)
+        {
+            auto next = context::skipped;
+
+            if (contexts_.empty())
+            {
+                next = (_object ? context::root : context::skipped);
+            }
+            else
+            {
+                const auto current = contexts_.back();
+
+                if (current == context::root && _object && key_ == "response")
+                {
+                    next = context::response;
+                    info_.has_response_ = true;
+                }
+                else if (current == context::response && _object && key_ == "data")
+                {
+                    next = context::data;
+                    info_.has_data_ = true;
+                }
+                else if (current == context::data && !_object && key_ == "events")
+                {
+                    next = context::events;
+                }
+                else if (current == context::events && _object)
+                {
+                    next = context::event;
+
+                    // the stream is already past the brace
+                    event_begin_ = stream_.Tell() - 1;
+                }
+            }
+
+            contexts_.push_back(next);
+
+            return true;
+        }
+
+        bool end()
+        {
+            assert(!contexts_.empty());
+
+            const auto current = contexts_.back();
+            contexts_.pop_back();
+
+            if (current == context::event)
+                on_event_(stream_.head_ + event_begin_, stream_.Tell() - event_begin_);
+
+            return true;
+        }
+
+        bool is_known_object() const
+        {
+            if (contexts_.empty())
+                return false;
+
+            const auto current = contexts_.back();
+
+            return (current == context::root || current == context::response || current == context::data);
+        }
+
+        bool is_value(context _context, const char* _key) const
+        {
+            return (!contexts_.empty() && contexts_.back() == _context && key_ == _key);
+        }
+
+        const rapidjson::StringStream& stream_;
+
+        event_callback on_event_;
+
+        std::vector<context> contexts_;
+
+        std::string key_;
+
+        size_t event_begin_;
+
+        fetch_response_info info_;
+    };
+
+    enum class event_type
+    {
+        unknown,
+        buddylist,
+        presence,
+        dlg_state,
+        webrtc_msg,
+        hidden_chat,
+        diff,
+        my_info,
+        user_added_to_buddy_list,
+        typing,
+        session_ended,
+        permit_deny,
+        im_state,
+        notification,
+        apps,
+        mention_me
+    };
+
+    // FNV-1a, the switch below doesn't compile if two known types get the same hash
+    constexpr uint32_t get_type_hash(const char* _type, uint32_t _hash = 2166136261u)
+    {
+        return (*_type == 0) ? _hash : get_type_hash(_type + 1, (_hash ^ static_cast<uint8_t>(*_type)) * 16777619u);
+    }
+
+    event_type check_type(const char* _type, const char* _known_type, event_type _known)
+    {
+        return (strcmp(_type, _known_type) == 0) ? _known : event_type::unknown;
+    }
+
+    event_type get_event_type(const char* _type)
+    {
+        switch (get_type_hash(_type))
+        {
+        case get_type_hash("buddylist"):
+            return check_type(_type, "buddylist", event_type::buddylist);
+        case get_type_hash("presence"):
+            return check_type(_type, "presence", event_type::presence);
+        case get_type_hash("histDlgState"):
+            return check_type(_type, "histDlgState", event_type::dlg_state);
+        case get_type_hash("webrtcMsg"):
+            return check_type(_type, "webrtcMsg", event_type::webrtc_msg);
+        case get_type_hash("hiddenChat"):
+            return check_type(_type, "hiddenChat", event_type::hidden_chat);
+        case get_type_hash("diff"):
+            return check_type(_type, "diff", event_type::diff);
+        case get_type_hash("myInfo"):
+            return check_type(_type, "myInfo", event_type::my_info);
+        case get_type_hash("userAddedToBuddyList"):
+            return check_type(_type, "userAddedToBuddyList", event_type::user_added_to_buddy_list);
+        case get_type_hash("typing"):
+            return check_type(_type, "typing", event_type::typing);
+        case get_type_hash("sessionEnded"):
+            return check_type(_type, "sessionEnded", event_type::session_ended);
+        case get_type_hash("permitDeny"):
+            return check_type(_type, "permitDeny", event_type::permit_deny);
+        case get_type_hash("imState"):
+            return check_type(_type, "imState", event_type::im_state);
+        case get_type_hash("notification"):
+            return check_type(_type, "notification", event_type::notification);
+        case get_type_hash("apps"):
+            return check_type(_type, "apps", event_type::apps);
+        case get_type_hash("mentionMeMessage"):
+            return check_type(_type, "mentionMeMessage", event_type::mention_me);
+        default:
+            return event_type::unknown;
+        }
+    }
+}
+
 fetch::fetch(
     wim_packet_params _params,
     const std::string& _fetch_url,
@@ -163,81 +467,84 @@ std::shared_ptr<core::wim::fetch_event> fetch::pop_event()
 }
 
 
-int32_t fetch::parse_response_data(const rapidjson::Value& _data)
+int32_t fetch::parse_response(std::shared_ptr<core::tools::binary_stream> _response)
 {
+    if (!_response->available())
+        return wpie_http_empty_response;
+
+    _response->write((char) 0);
+
+    const auto size = _response->available();
+    const auto json_str = _response->read(size);
+
+#ifdef DEBUG__OUTPUT_NET_PACKETS
+    puts(json_str);
+#endif // DEBUG__OUTPUT_NET_PACKETS
+
     try
     {
         bool have_webrtc_event = false;
 
-        const auto iter_events = _data.FindMember("events");
+        // reused by the events one after another
+        std::vector<char> event_json;
+
+        rapidjson::StringStream stream(json_str);
 
-        if (iter_events != _data.MemberEnd() && iter_events->value.IsArray())
+        fetch_response_reader handler(stream, [this, &have_webrtc_event, &event_json](const char* _json, size_t _size)
         {
-            for (auto iter_evt = iter_events->value.Begin(); iter_evt != iter_events->value.End(); ++iter_evt)
-            {
-                auto iter_type = iter_evt->FindMember("type");
-                auto iter_event_data = iter_evt->FindMember("eventData");
+            event_json.assign(_json, _json + _size);
+            event_json.push_back(0);
 
-                if (iter_type != iter_evt->MemberEnd() && iter_event_data != iter_evt->MemberEnd() &&
-                    iter_type->value.IsString())
-                {
-                    const std::string event_type = rapidjson_get_string(iter_type->value);
-
-                    if (event_type == "buddylist")
-                        push_event(std::make_shared<fetch_event_buddy_list>())->parse(iter_event_data->value);
-                    else if (event_type == "presence")
-                        push_event(std::make_shared<fetch_event_presence>())->parse(iter_event_data->value);
-                    else if (event_type == "histDlgState")
-                        push_event(std::make_shared<fetch_event_dlg_state>())->parse(iter_event_data->value);
-                    else if (event_type == "webrtcMsg")
-                        have_webrtc_event = true;
-                    else if (event_type == "hiddenChat")
-                        push_event(std::make_shared<fetch_event_hidden_chat>())->parse(iter_event_data->value);
-                    else if (event_type == "diff")
-                        push_event(std::make_shared<fetch_event_diff>())->parse(iter_event_data->value);
-                    else if (event_type == "myInfo")
-                        push_event(std::make_shared<fetch_event_my_info>())->parse(iter_event_data->value);
-                    else if (event_type == "userAddedToBuddyList")
-                        push_event(std::make_shared<fetch_event_user_added_to_buddy_list>())->parse(iter_event_data->value);
-                    else if (event_type == "typing")
-                        push_event(std::make_shared<fetch_event_typing>())->parse(iter_event_data->value);
-                    else if (event_type == "sessionEnded")
-                        on_session_ended(iter_event_data->value);
-                    else if (event_type == "permitDeny")
-                        push_event(std::make_shared<fetch_event_permit>())->parse(iter_event_data->value);
-                    else if (event_type == "imState")
-                        push_event(std::make_shared<fetch_event_imstate>())->parse(iter_event_data->value);
-                    else if (event_type == "notification")
-                        push_event(std::make_shared<fetch_event_notification>())->parse(iter_event_data->value);
-                    else if (event_type == "apps")
-                        push_event(std::make_shared<fetch_event_appsdata>())->parse(iter_event_data->value);
-                    else if (event_type == "mentionMeMessage")
-                        push_event(std::make_shared<fetch_event_mention_me>())->parse(iter_event_data->value);
-                }
-            }
+            rapidjson::Document doc;
+            if (!doc.ParseInsitu(event_json.data()).HasParseError())
+                parse_event(doc, have_webrtc_event);
+        });
+
+        rapidjson::Reader reader;
+        reader.Parse(stream, handler);
+        if (reader.HasParseError())
+            return wpie_error_parse_response;
+
+        const auto& info = handler.get_info();
+
+        if (!info.has_response_ || !info.has_status_code_)
+            return wpie_http_parse_response;
+
+        status_code_ = info.status_code_;
+
+        if (info.has_status_text_)
+            status_text_ = info.status_text_;
+
+        if (info.has_status_detail_code_)
+            status_detail_code_ = info.status_detail_code_;
+
+        if (status_code_ != 200)
+        {
+            // the events could come before the status
+            events_.clear();
+            relogin_ = relogin::none;
+
+            return on_response_error_code();
         }
 
+        if (!info.has_data_)
+            return on_empty_data();
+
         if (relogin_ == relogin::none)
         {
-            auto iter_next_fetch_url = _data.FindMember("fetchBaseURL");
-            if (iter_next_fetch_url == _data.MemberEnd() || !iter_next_fetch_url->value.IsString())
+            if (!info.has_fetch_base_url_)
                 return wpie_http_parse_response;
 
-            next_fetch_url_ = rapidjson_get_string(iter_next_fetch_url->value);
+            next_fetch_url_ = info.fetch_base_url_;
             next_fetch_time_ = std::chrono::system_clock::now();
 
-            auto iter_time_to_next_fetch = _data.FindMember("timeToNextFetch");
-            if (iter_time_to_next_fetch != _data.MemberEnd() && iter_time_to_next_fetch->value.IsUint())
-            {
-                time_t fetch_timeout = iter_time_to_next_fetch->value.GetUint();
-                next_fetch_time_ += std::chrono::milliseconds(fetch_timeout);
-            }
+            if (info.has_time_to_next_fetch_)
+                next_fetch_time_ += std::chrono::milliseconds(info.time_to_next_fetch_);
 
-            auto iter_ts = _data.FindMember("ts");
-            if (iter_ts == _data.MemberEnd() || !iter_ts->value.IsUint())
+            if (!info.has_ts_)
                 return wpie_http_parse_response;
 
-            ts_ = iter_ts->value.GetUint();
+            ts_ = info.ts_;
             auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
             auto diff = now - execute_time_ - std::round(request_time_);
             time_offset_ = now - ts_ - diff;
@@ -247,6 +554,7 @@ int32_t fetch::parse_response_data(const rapidjson::Value& _data)
             auto we = std::make_shared<webrtc_event>();
             if (!!we) {
                 // sorry... the simplest way
+                load_response_str(json_str, size);
                 we->parse(response_str());
                 push_event(we);
             } else {
@@ -262,6 +570,68 @@ int32_t fetch::parse_response_data(const rapidjson::Value& _data)
     return 0;
 }
 
+void fetch::parse_event(const rapidjson::Value& _event, bool& _have_webrtc_event)
+{
+    auto iter_type = _event.FindMember("type");
+    auto iter_event_data = _event.FindMember("eventData");
+
+    if (iter_type == _event.MemberEnd() || iter_event_data == _event.MemberEnd() || !iter_type->value.IsString())
+        return;
+
+    const auto& event_data = iter_event_data->value;
+
+    switch (get_event_type(iter_type->value.GetString()))
+    {
+    case event_type::buddylist:
+        push_event(std::make_shared<fetch_event_buddy_list>())->parse(event_data);
+        break;
+    case event_type::presence:
+        push_event(std::make_shared<fetch_event_presence>())->parse(event_data);
+        break;
+    case event_type::dlg_state:
+        push_event(std::make_shared<fetch_event_dlg_state>())->parse(event_data);
+        break;
+    case event_type::webrtc_msg:
+        _have_webrtc_event = true;
+        break;
+    case event_type::hidden_chat:
+        push_event(std::make_shared<fetch_event_hidden_chat>())->parse(event_data);
+        break;
+    case event_type::diff:
+        push_event(std::make_shared<fetch_event_diff>())->parse(event_data);
+        break;
+    case event_type::my_info:
+        push_event(std::make_shared<fetch_event_my_info>())->parse(event_data);
+        break;
+    case event_type::user_added_to_buddy_list:
+        push_event(std::make_shared<fetch_event_user_added_to_buddy_list>())->parse(event_data);
+        break;
+    case event_type::typing:
+        push_event(std::make_shared<fetch_event_typing>())->parse(event_data);
+        break;
+    case event_type::session_ended:
+        on_session_ended(event_data);
+        break;
+    case event_type::permit_deny:
+        push_event(std::make_shared<fetch_event_permit>())->parse(event_data);
+        break;
+    case event_type::im_state:
+        push_event(std::make_shared<fetch_event_imstate>())->parse(event_data);
+        break;
+    case event_type::notification:
+        push_event(std::make_shared<fetch_event_notification>())->parse(event_data);
+        break;
+    case event_type::apps:
+        push_event(std::make_shared<fetch_event_appsdata>())->parse(event_data);
+        break;
+    case event_type::mention_me:
+        push_event(std::make_shared<fetch_event_mention_me>())->parse(event_data);
+        break;
+    default:
+        break;
+    }
+}
+
 int32_t fetch::on_response_error_code()
 {
     auto code = get_status_code();
@@ -29,10 +29,11 @@ namespace core
             relogin relogin_;
 
             virtual int32_t init_request(std::shared_ptr<core::http_request_simple> request) override;
-            virtual int32_t parse_response_data(const rapidjson::Value& _data) override;
+            virtual int32_t parse_response(std::shared_ptr<core::tools::binary_stream> _response) override;
             virtual int32_t on_response_error_code() override;
             virtual int32_t execute_request(std::shared_ptr<core::http_request_simple> request) override;
 
+            void parse_event(const rapidjson::Value& _event, bool& _have_webrtc_event);
             void on_session_ended(const rapidjson::Value& _data);
 
             std::list< std::shared_ptr<core::wim::fetch_event> > events_;
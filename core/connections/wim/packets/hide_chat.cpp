@@ -21,6 +21,11 @@ hide_chat::~hide_chat()
 
 }
 
+ordering_key hide_chat::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t hide_chat::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::string method;
@@ -30,6 +30,8 @@ namespace core
         public:
 
             hide_chat(wim_packet_params _params, const std::string& _aimid, int64_t _last_msg_id);
+            ordering_key get_ordering_key() const override;
+
             virtual ~hide_chat();
         };
 
@@ -21,6 +21,11 @@ modify_chat::~modify_chat()
 {
 }
 
+ordering_key modify_chat::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t modify_chat::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
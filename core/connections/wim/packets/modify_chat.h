@@ -33,6 +33,8 @@ namespace core
                 const std::string& _aimid_,
                 const std::string& _m_chat_name);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~modify_chat();
         };
 
@@ -21,6 +21,11 @@ mute_buddy::~mute_buddy()
 {
 }
 
+ordering_key mute_buddy::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t mute_buddy::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
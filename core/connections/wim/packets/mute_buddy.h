@@ -30,6 +30,8 @@ namespace core
                 const std::string& _aimid,
                 bool mute);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~mute_buddy();
         };
 
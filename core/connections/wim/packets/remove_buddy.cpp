@@ -19,6 +19,11 @@ remove_buddy::~remove_buddy()
 {
 }
 
+ordering_key remove_buddy::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t remove_buddy::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
@@ -31,6 +31,8 @@ namespace core
                 wim_packet_params _params,
                 const std::string& _aimid);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~remove_buddy();
         };
 
@@ -21,6 +21,11 @@ remove_members::~remove_members()
 {
 }
 
+ordering_key remove_members::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t remove_members::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
@@ -33,6 +33,8 @@ namespace core
                 const std::string& _aimid,
                 const std::string& _m_chat_members_to_remove);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~remove_members();
         };
 
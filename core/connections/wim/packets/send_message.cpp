@@ -39,6 +39,11 @@ send_message::~send_message()
 
 }
 
+ordering_key send_message::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t send_message::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     const auto is_sticker = (type_ == message_type::sticker);
@@ -74,6 +74,8 @@ namespace core
                 const core::archive::quotes_vec& _quotes,
                 const core::archive::mentions_map& _mentions);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~send_message();
         };
 
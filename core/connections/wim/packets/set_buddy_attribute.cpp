@@ -21,6 +21,11 @@ set_buddy_attribute::~set_buddy_attribute()
 {
 }
 
+ordering_key set_buddy_attribute::get_ordering_key() const
+{
+    return ordering_key::make_contact_key(aimid_);
+}
+
 int32_t set_buddy_attribute::init_request(std::shared_ptr<core::http_request_simple> _request)
 {
     std::stringstream ss_url;
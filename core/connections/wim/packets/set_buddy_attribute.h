@@ -33,6 +33,8 @@ namespace core
                 const std::string& _aimid,
                 const std::string& _friendly);
 
+            ordering_key get_ordering_key() const override;
+
             virtual ~set_buddy_attribute();
         };
 
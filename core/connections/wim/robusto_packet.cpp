@@ -47,17 +47,19 @@ int32_t robusto_packet::parse_response(std::shared_ptr<core::tools::binary_strea
     if (!_response->available())
         return wpie_http_empty_response;
 
-    uint32_t size = _response->available();
-    load_response_str((const char*) _response->read(size), size);
+    _response->write((char) 0);
+
     try
     {
+        const auto json_str = _response->read(_response->available());
+
 #if defined(DEBUG)
         // because ParseInsitu spoils str somehow
-        const std::string json_str_dbg(response_str());
+        const std::string json_str_dbg(json_str);
 #endif
 
         rapidjson::Document doc;
-        if (doc.Parse(response_str().c_str()).HasParseError())
+        if (doc.ParseInsitu(json_str).HasParseError())
             return wpie_error_parse_response;
 
         auto iter_status = doc.FindMember("status");
@@ -39,6 +39,7 @@ namespace core
             virtual ~robusto_packet();
 
             void set_robusto_params(const robusto_packet_params& _params);
+            const std::string& get_robusto_token() const { return robusto_params_.robusto_token_; }
         };
 
     }
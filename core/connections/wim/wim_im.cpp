@@ -124,6 +124,7 @@
 #include "../../archive/archive_index.h"
 #include "../../archive/not_sent_messages.h"
 #include "../../archive/messages_data.h"
+#include "../../archive/history_search.h"
 #include "stat/imstat.h"
 #include "dialog_holes.h"
 #include "../../configuration/hosts_config.h"
@@ -136,6 +137,7 @@
 
 #include "../../tools/system.h"
 #include "../../tools/file_sharing.h"
+#include "../../tools/metrics.h"
 
 #include "../../configuration/hosts_config.h"
 
@@ -166,6 +168,45 @@ namespace
 
     const auto dlg_state_agregate_start_timeout = std::chrono::minutes(3);
     const auto dlg_state_agregate_period = std::chrono::seconds(60);
+
+    struct send_queue_metrics
+    {
+        metrics::counter& queued_;
+        metrics::counter& running_;
+        metrics::counter& executed_;
+        metrics::histogram& wait_;
+    };
+
+    send_queue_metrics& get_send_queue_metrics(const ordering_class _class)
+    {
+        static send_queue_metrics global_metrics = {
+            metrics::get_counter("wim.send.global.queued"),
+            metrics::get_counter("wim.send.global.running"),
+            metrics::get_counter("wim.send.global.executed"),
+            metrics::get_histogram("wim.send.global.wait") };
+
+        static send_queue_metrics contact_metrics = {
+            metrics::get_counter("wim.send.contact.queued"),
+            metrics::get_counter("wim.send.contact.running"),
+            metrics::get_counter("wim.send.contact.executed"),
+            metrics::get_histogram("wim.send.contact.wait") };
+
+        static send_queue_metrics chat_metrics = {
+            metrics::get_counter("wim.send.chat.queued"),
+            metrics::get_counter("wim.send.chat.running"),
+            metrics::get_counter("wim.send.chat.executed"),
+            metrics::get_histogram("wim.send.chat.wait") };
+
+        switch (_class)
+        {
+        case ordering_class::contact:
+            return contact_metrics;
+        case ordering_class::chat:
+            return chat_metrics;
+        default:
+            return global_metrics;
+        }
+    }
 }
 
 void write_offset_in_log(time_t offset)
@@ -183,9 +224,12 @@ void write_offset_in_log(time_t offset)
 //////////////////////////////////////////////////////////////////////////
 // send_thread class
 //////////////////////////////////////////////////////////////////////////
-core::wim::wim_send_thread::wim_send_thread()
-    :   is_packet_execute_(false)
+core::wim::wim_send_thread::wim_send_thread(uint32_t _max_running)
+    :   async_executer(_max_running),
+        max_running_(_max_running),
+        running_(0)
 {
+    assert(max_running_ > 0);
 }
 
 core::wim::wim_send_thread::~wim_send_thread()
@@ -197,20 +241,69 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
     std::function<void(int32_t)> _error_handler,
     std::shared_ptr<async_task_handlers> _handlers)
 {
-    std::weak_ptr<wim_send_thread> wr_this(shared_from_this());
-
     std::shared_ptr<async_task_handlers> callback_handlers = _handlers ? _handlers : std::make_shared<async_task_handlers>();
 
-    const auto can_run_async = _packet->support_async_execution();
+    task_and_params packet(_packet, _error_handler, callback_handlers);
 
-    if (is_packet_execute_ && !can_run_async)
+    if (_packet->support_async_execution())
     {
-        packets_queue_.push_back(task_and_params(_packet, _error_handler, callback_handlers));
+        run_packet(packet);
         return callback_handlers;
     }
 
-    if (!can_run_async)
-        is_packet_execute_ = true;
+    get_send_queue_metrics(packet.key_.class_).queued_.add();
+
+    auto& queue = queues_[packet.key_];
+    queue.packets_.push_back(std::move(packet));
+
+    if (!queue.is_running_ && queue.packets_.size() == 1)
+        ready_keys_.push_back(queue.packets_.front().key_);
+
+    schedule();
+
+    return callback_handlers;
+}
+
+void core::wim::wim_send_thread::schedule()
+{
+    while (running_ < max_running_ && !ready_keys_.empty())
+    {
+        auto iter_queue = queues_.find(ready_keys_.front());
+        ready_keys_.pop_front();
+
+        assert(iter_queue != queues_.end());
+        if (iter_queue == queues_.end())
+            continue;
+
+        auto& queue = iter_queue->second;
+        assert(!queue.is_running_ && !queue.packets_.empty());
+
+        auto packet = std::move(queue.packets_.front());
+        queue.packets_.pop_front();
+
+        queue.is_running_ = true;
+        ++running_;
+
+        auto& stats = get_send_queue_metrics(packet.key_.class_);
+        stats.queued_.add(-1);
+        stats.running_.add();
+        stats.executed_.add();
+        stats.wait_.record(std::chrono::steady_clock::now() - packet.queued_time_);
+
+        run_packet(packet);
+    }
+}
+
+void core::wim::wim_send_thread::run_packet(const task_and_params& _packet)
+{
+    std::weak_ptr<wim_send_thread> wr_this(shared_from_this());
+
+    auto packet = _packet.task_;
+    auto error_handler = _packet.error_handler_;
+    auto callback_handlers = _packet.callback_handlers_;
+    auto key = _packet.key_;
+
+    const auto can_run_async = packet->support_async_execution();
 
     const auto current_time = std::chrono::system_clock::now();
 
@@ -221,7 +314,7 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
         {
             return 0;
 
-        })->on_result_ = [wr_this, callback_handlers](int32_t /*_error*/)
+        })->on_result_ = [wr_this, callback_handlers, key, can_run_async](int32_t /*_error*/)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -230,15 +323,16 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
             if (callback_handlers->on_result_)
                 callback_handlers->on_result_(wpie_error_request_canceled_wait_timeout);
 
-            ptr_this->execute_packet_from_queue();
+            if (!can_run_async)
+                ptr_this->on_packet_finished(key);
         };
 
-        return callback_handlers;
+        return;
     }
 
     if (can_run_async)
     {
-        _packet->execute_async([wr_this, _packet, _error_handler, callback_handlers](int32_t _error)
+        packet->execute_async([wr_this, packet, callback_handlers](int32_t _error)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -248,15 +342,15 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
                 callback_handlers->on_result_(_error);
         });
 
-        return callback_handlers;
+        return;
     }
 
-    auto internal_handlers = run_async_function([_packet]()->int32_t
+    auto internal_handlers = run_async_function([packet]()->int32_t
     {
-        return _packet->execute();
+        return packet->execute();
     });
 
-    internal_handlers->on_result_ = [wr_this, _packet, _error_handler, callback_handlers](int32_t _error)
+    internal_handlers->on_result_ = [wr_this, _packet, packet, error_handler, callback_handlers, key](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -264,22 +358,21 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
 
         if (_error == wim_protocol_internal_error::wpie_network_error)
         {
-            if ((_packet->get_repeat_count() < sent_repeat_count) && (!_packet->is_stopped()))
+            if ((packet->get_repeat_count() < sent_repeat_count) && (!packet->is_stopped()))
             {
-                ptr_this->is_packet_execute_ = false;
-
-                if (_packet->can_change_hosts_scheme())
-                    _packet->change_hosts_scheme();
+                if (packet->can_change_hosts_scheme())
+                    packet->change_hosts_scheme();
 
-                ptr_this->post_packet(_packet, _error_handler, callback_handlers);
+                // the key stays busy, nothing of it may overtake the repeated packet
+                ptr_this->run_packet(_packet);
 
                 return;
             }
         }
         else
         {
-            if (_packet->is_hosts_scheme_changed())
-                g_core->get_hosts_config().update_hosts(_packet->get_hosts_scheme());
+            if (packet->is_hosts_scheme_changed())
+                g_core->get_hosts_config().update_hosts(packet->get_hosts_scheme());
         }
 
         if (_error == wpie_error_too_fast_sending)
@@ -290,49 +383,73 @@ std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(
         if (callback_handlers->on_result_)
             callback_handlers->on_result_(_error);
 
-        ptr_this->is_packet_execute_ = false;
-
         if (_error != 0)
         {
-            if (_error_handler)
+            if (error_handler)
             {
-                _error_handler(_error);
+                error_handler(_error);
             }
         }
 
-        ptr_this->execute_packet_from_queue();
+        ptr_this->on_packet_finished(key);
     };
-
-    return callback_handlers;
 }
 
-
-std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(std::shared_ptr<wim_packet> _packet, const std::function<void(int32_t)> _error_handler)
+void core::wim::wim_send_thread::on_packet_finished(const ordering_key& _key)
 {
-    return post_packet(_packet, _error_handler, nullptr);
-}
+    assert(running_ > 0);
+    --running_;
 
+    get_send_queue_metrics(_key.class_).running_.add(-1);
 
-void core::wim::wim_send_thread::execute_packet_from_queue()
-{
-    if (!packets_queue_.empty())
+    auto iter_queue = queues_.find(_key);
+    if (iter_queue != queues_.end())
     {
-        auto next_packet = packets_queue_.front();
-        packets_queue_.pop_front();
+        auto& queue = iter_queue->second;
+        queue.is_running_ = false;
 
-        post_packet(next_packet.task_, next_packet.error_handler_, next_packet.callback_handlers_);
+        if (queue.packets_.empty())
+            queues_.erase(iter_queue);
+        else
+            ready_keys_.push_back(_key);
     }
+
+    schedule();
+}
+
+std::shared_ptr<async_task_handlers> core::wim::wim_send_thread::post_packet(std::shared_ptr<wim_packet> _packet, const std::function<void(int32_t)> _error_handler)
+{
+    return post_packet(_packet, _error_handler, nullptr);
 }
 
 void core::wim::wim_send_thread::clear()
 {
-    for (const auto& packet : packets_queue_)
-        if (packet.callback_handlers_->on_result_)
-            packet.callback_handlers_->on_result_(wpie_error_task_canceled);
+    std::vector<std::shared_ptr<async_task_handlers>> canceled;
+
+    for (auto iter_queue = queues_.begin(); iter_queue != queues_.end();)
+    {
+        auto& queue = iter_queue->second;
 
-    packets_queue_.clear();
+        for (const auto& packet : queue.packets_)
+            canceled.push_back(packet.callback_handlers_);
 
+        get_send_queue_metrics(iter_queue->first.class_).queued_.add(-(int64_t)queue.packets_.size());
+        queue.packets_.clear();
+
+        // running packets finish on their own and remove the queue
+        if (queue.is_running_)
+            ++iter_queue;
+        else
+            iter_queue = queues_.erase(iter_queue);
+    }
+
+    ready_keys_.clear();
+
+    for (const auto& handlers : canceled)
+        if (handlers->on_result_)
+            handlers->on_result_(wpie_error_task_canceled);
 }
+
 //////////////////////////////////////////////////////////////////////////
 // end send_thread class
 //////////////////////////////////////////////////////////////////////////
@@ -341,24 +458,17 @@ void core::wim::wim_send_thread::clear()
 //////////////////////////////////////////////////////////////////////////
 // robusto_thread
 //////////////////////////////////////////////////////////////////////////
-void robusto_thread::push_packet_to_queue(
-    std::shared_ptr<robusto_packet> _packet,
-    std::shared_ptr<async_task_handlers> _handlers)
+void robusto_thread::push_token_waiter(std::shared_ptr<async_task_handlers> _handlers)
 {
-    packets_queue_.push_back(std::make_shared<task_and_params>(_packet, _handlers));
+    token_waiters_.push_back(_handlers);
 }
 
-
-std::shared_ptr<robusto_thread::task_and_params> robusto_thread::get_front_packet_from_queue()
+std::list<std::shared_ptr<async_task_handlers>> robusto_thread::take_token_waiters()
 {
-    if (packets_queue_.empty())
-        return nullptr;
-
-    auto packet = packets_queue_.front();
-
-    packets_queue_.pop_front();
+    std::list<std::shared_ptr<async_task_handlers>> waiters;
+    waiters.swap(token_waiters_);
 
-    return packet;
+    return waiters;
 }
 //////////////////////////////////////////////////////////////////////////
 // end robusto_thread class
@@ -376,8 +486,18 @@ std::shared_ptr<async_task_handlers> remove_messages_from_not_sent(
     const std::shared_ptr<archive::history_block>& _intro_messages);
 
 const auto search_threads_count = 3;
+
+// contacts whose holes are filled at once
+const auto holes_downloads_count = 3;
+
+// stickers downloaded at once, the ones requested by the gui are taken first
+const auto stickers_downloads_count = 4;
+
 const auto sending_search_results_interval = std::chrono::milliseconds(500);
 
+// fetched responses waiting for the dispatch, beyond that the next fetch waits for the dispatch too
+const size_t max_fetches_to_dispatch = 4;
+
 //////////////////////////////////////////////////////////////////////////
 // im class
 //////////////////////////////////////////////////////////////////////////
@@ -392,7 +512,8 @@ im::im(const im_login_id& _login, std::shared_ptr<voip_manager::VoipManager> _vo
     auth_params_(std::make_shared<auth_parameters>()),
     attached_auth_params_(std::make_shared<auth_parameters>()),
     fetch_params_(std::make_shared<fetch_parameters>()),
-    wim_send_thread_(std::make_shared<wim_send_thread>()),
+    // different contacts, packets of one contact are still sent in order
+    wim_send_thread_(std::make_shared<wim_send_thread>(core::configuration::get_app_config().send_threads_count_)),
     fetch_thread_(std::make_shared<fetch_thread>()),
     async_tasks_(std::make_shared<async_executer>()),
     robusto_threads_(std::make_shared<robusto_thread>()),
@@ -403,6 +524,7 @@ im::im(const im_login_id& _login, std::shared_ptr<voip_manager::VoipManager> _vo
     dlg_state_timer_(0),
     im_created_(false),
     failed_holes_requests_(std::make_shared<holes::failed_requests>()),
+    holes_scheduler_(std::make_shared<holes::scheduler>(holes_downloads_count)),
     sent_pending_messages_active_(false),
     imstat_(std::make_unique<statistic::imstat>()),
     history_searcher_(std::make_shared<async_executer>(search_threads_count)),
@@ -413,7 +535,8 @@ im::im(const im_login_id& _login, std::shared_ptr<voip_manager::VoipManager> _vo
     last_success_network_post_(std::chrono::system_clock::now()),
     last_check_alt_scheme_reset_(std::chrono::system_clock::now()),
     dlg_state_agregate_mode_(false),
-    last_network_activity_time_(std::chrono::system_clock::now() - dlg_state_agregate_start_timeout)
+    last_network_activity_time_(std::chrono::system_clock::now() - dlg_state_agregate_start_timeout),
+    dispatching_fetched_events_(false)
 {
 }
 
@@ -934,9 +1057,14 @@ void im::load_auth_and_fetch_parameters()
 
 
 void im::store_fetch_parameters()
+{
+    store_fetch_parameters(*fetch_params_);
+}
+
+void im::store_fetch_parameters(const fetch_parameters& _params)
 {
     auto bstream = std::make_shared<core::tools::binary_stream>();
-    fetch_params_->serialize(*bstream);
+    _params.serialize(*bstream);
 
     const std::wstring file_name = get_fetch_parameters_filename();
 
@@ -1159,7 +1287,7 @@ void im::resume_download_stickers()
     {
         get_stickers()->set_download_stickers_error(false);
 
-        download_stickers(false);
+        download_stickers();
     }
 
     if (get_stickers()->is_download_meta_error())
@@ -1787,17 +1915,31 @@ void im::get_set_icon_big(const int64_t _seq, const int32_t _set_id)
     };
 }
 
-void im::download_stickers(const bool _recursive)
+void im::download_stickers()
 {
-    if (get_stickers()->is_download_stickers_error())
-        return;
+    auto stickers = get_stickers();
 
-    if (get_stickers()->is_download_stickers_in_progress() && !_recursive)
-        return;
+    while (!stickers->is_download_stickers_error() && stickers->get_download_stickers_running() < stickers_downloads_count)
+    {
+        stickers->set_download_stickers_running(stickers->get_download_stickers_running() + 1);
 
-    std::weak_ptr<im> wr_this = shared_from_this();
+        download_next_sticker();
+    }
+}
+
+void im::on_sticker_downloaded()
+{
+    auto stickers = get_stickers();
+
+    assert(stickers->get_download_stickers_running() > 0);
+    stickers->set_download_stickers_running(stickers->get_download_stickers_running() - 1);
+
+    download_stickers();
+}
 
-    get_stickers()->set_download_stickers_in_progress(true);
+void im::download_next_sticker()
+{
+    std::weak_ptr<im> wr_this = shared_from_this();
 
     get_stickers()->get_next_sticker_task()->on_result_ = [wr_this](bool _res, const stickers::download_task& _task)
     {
@@ -1807,7 +1949,8 @@ void im::download_stickers(const bool _recursive)
 
         if (!_res)
         {
-            ptr_this->get_stickers()->set_download_stickers_in_progress(false);
+            auto stickers = ptr_this->get_stickers();
+            stickers->set_download_stickers_running(stickers->get_download_stickers_running() - 1);
             return;
         }
 
@@ -1824,7 +1967,8 @@ void im::download_stickers(const bool _recursive)
             if (_error == loader_errors::network_error)
             {
                 ptr_this->get_stickers()->set_download_stickers_error(true);
-                ptr_this->get_stickers()->set_download_stickers_in_progress(false);
+                ptr_this->get_stickers()->on_sticker_failed(_task);
+                ptr_this->on_sticker_downloaded();
 
                 return;
             }
@@ -1870,7 +2014,7 @@ void im::download_stickers(const bool _recursive)
                     }
                 }
 
-                ptr_this->download_stickers(true);
+                ptr_this->on_sticker_downloaded();
             };
         }));
     };
@@ -2664,18 +2808,10 @@ void im::poll(bool _is_first, poll_reason _reason, int32_t _failed_network_error
 
         if (_error == 0)
         {
-            ptr_this->dispatch_events(packet,[packet, wr_this, active_session_id, _is_first, start_time](int32_t _error)
-            {
-                auto ptr_this = wr_this.lock();
-                if (!ptr_this)
-                    return;
-
-                if (packet->need_relogin() != relogin::none)
-                {
-                    g_core->unlogin(packet->need_relogin() == relogin::relogin_with_error);
-                    return;
-                }
+            const auto need_relogin = packet->need_relogin();
 
+            if (need_relogin == relogin::none)
+            {
                 auto time_offset = packet->get_time_offset();
                 auto time_offset_prev = ptr_this->auth_params_->time_offset_;
 
@@ -2686,8 +2822,6 @@ void im::poll(bool _is_first, poll_reason _reason, int32_t _failed_network_error
                 ptr_this->check_need_agregate_dlg_state();
                 ptr_this->last_network_activity_time_ = std::chrono::system_clock::now();
 
-                ptr_this->store_fetch_parameters();
-
                 if ((std::chrono::system_clock::now() - start_time) < std::chrono::minutes(5))
                 {
                     auto prev_time_offset = ptr_this->auth_params_->time_offset_;
@@ -2703,21 +2837,21 @@ void im::poll(bool _is_first, poll_reason _reason, int32_t _failed_network_error
                         ptr_this->store_auth_parameters();
                     }
                 }
+            }
 
-                if (!ptr_this->is_session_valid(active_session_id))
-                    return;
+            // too many responses wait for the dispatch, this one polls once its events are dispatched
+            const auto poll_now = (need_relogin == relogin::none && ptr_this->fetched_events_.size() < max_fetches_to_dispatch);
 
-                ptr_this->poll(false, im::poll_reason::normal);
+            ptr_this->fetched_events_.push_back(fetched_events{ packet, active_session_id, _is_first, (need_relogin == relogin::none && !poll_now) });
+            ptr_this->dispatch_fetched_events();
 
-                ptr_this->resume_failed_network_requests();
+            if (!poll_now || !ptr_this->is_session_valid(active_session_id))
+                return;
 
-                if (_is_first)
-                {
-                    g_core->post_message_to_gui("login/complete", 0, nullptr);
+            // the next fetch waits for the server while these events are dispatched
+            ptr_this->poll(false, im::poll_reason::normal);
 
-                    ptr_this->send_timezone();
-                }
-            });
+            ptr_this->resume_failed_network_requests();
         }
         else
         {
@@ -2752,6 +2886,60 @@ void im::poll(bool _is_first, poll_reason _reason, int32_t _failed_network_error
     };
 }
 
+void im::dispatch_fetched_events()
+{
+    if (dispatching_fetched_events_ || fetched_events_.empty())
+        return;
+
+    dispatching_fetched_events_ = true;
+
+    std::weak_ptr<im> wr_this = shared_from_this();
+
+    dispatch_events(fetched_events_.front().packet_, [wr_this](int32_t _error)
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
+
+        const auto events = ptr_this->fetched_events_.front();
+        ptr_this->fetched_events_.pop_front();
+
+        ptr_this->dispatching_fetched_events_ = false;
+
+        const auto need_relogin = events.packet_->need_relogin();
+        if (need_relogin != relogin::none)
+        {
+            g_core->unlogin(need_relogin == relogin::relogin_with_error);
+            return;
+        }
+
+        if (ptr_this->is_session_valid(events.session_id_))
+        {
+            // the fetch url is stored only after its events are dispatched, so they are fetched again after a restart
+            fetch_parameters dispatched_params(*ptr_this->fetch_params_);
+            dispatched_params.fetch_url_ = events.packet_->get_next_fetch_url();
+
+            ptr_this->store_fetch_parameters(dispatched_params);
+
+            if (events.poll_after_dispatch_)
+            {
+                ptr_this->poll(false, im::poll_reason::normal);
+
+                ptr_this->resume_failed_network_requests();
+            }
+
+            if (events.is_first_)
+            {
+                g_core->post_message_to_gui("login/complete", 0, nullptr);
+
+                ptr_this->send_timezone();
+            }
+        }
+
+        ptr_this->dispatch_fetched_events();
+    });
+}
+
 void im::dispatch_events(std::shared_ptr<fetch> _fetch_packet, std::function<void(int32_t)> _on_complete)
 {
     std::weak_ptr<im> wr_this = shared_from_this();
@@ -3370,14 +3558,40 @@ void im::on_event_presence(fetch_event_presence* _event, std::shared_ptr<auto_ca
 
 std::shared_ptr<async_task_handlers> im::get_robusto_token()
 {
-    robusto_threads_->set_robusto_token_in_process(true);
-
     auto out_handlers = std::make_shared<async_task_handlers>();
 
+    // only one token is requested at a time, the others get the same result
+    if (robusto_threads_->is_get_robusto_token_in_process())
+    {
+        robusto_threads_->push_token_waiter(out_handlers);
+        return out_handlers;
+    }
+
+    robusto_threads_->set_robusto_token_in_process(true);
+
     std::weak_ptr<im> wr_this = shared_from_this();
+
+    auto on_token = [wr_this, out_handlers](int32_t _error)
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
+
+        ptr_this->robusto_threads_->set_robusto_token_in_process(false);
+
+        auto waiters = ptr_this->robusto_threads_->take_token_waiters();
+        waiters.push_front(out_handlers);
+
+        for (const auto& waiter : waiters)
+        {
+            if (waiter->on_result_)
+                waiter->on_result_(_error);
+        }
+    };
+
     auto packet_gen_token = std::make_shared<core::wim::gen_robusto_token>(make_wim_params());
     robusto_threads_->run_async_task(packet_gen_token)->on_result_ =
-        [wr_this, out_handlers, packet_gen_token](int32_t _error)
+        [wr_this, on_token, packet_gen_token](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -3391,31 +3605,24 @@ std::shared_ptr<async_task_handlers> im::get_robusto_token()
             add_client_packet->set_robusto_params(ptr_this->make_robusto_params());
 
             ptr_this->robusto_threads_->run_async_task(add_client_packet)->on_result_ =
-                [wr_this, out_handlers, add_client_packet](int32_t _error)
+                [wr_this, on_token, add_client_packet](int32_t _error)
             {
                 auto ptr_this = wr_this.lock();
                 if (!ptr_this)
                     return;
 
-                ptr_this->robusto_threads_->set_robusto_token_in_process(false);
-
                 if (_error == 0)
                 {
                     ptr_this->auth_params_->robusto_client_id_ = add_client_packet->get_client_id();
                     ptr_this->store_auth_parameters();
                 }
 
-
-                if (out_handlers->on_result_)
-                    out_handlers->on_result_(_error);
+                on_token(_error);
             };
         }
         else
         {
-            ptr_this->robusto_threads_->set_robusto_token_in_process(false);
-
-            if (out_handlers->on_result_)
-                out_handlers->on_result_(_error);
+            on_token(_error);
         }
     };
 
@@ -3444,15 +3651,15 @@ void im::post_robusto_packet_to_server(std::shared_ptr<async_task_handlers> _han
         {
             if (_error == wpie_error_robusto_token_invalid)
             {
-                if (ptr_this->robusto_threads_->is_get_robusto_token_in_process())
-                {
-                    ptr_this->robusto_threads_->push_packet_to_queue(_packet, _handlers);
-                }
-                else
+                // packets in flight all fail with the old token, only the first of them drops it,
+                // the rest wait for the token being requested or are resent with the renewed one
+                if (!ptr_this->robusto_threads_->is_get_robusto_token_in_process() &&
+                    _packet->get_robusto_token() == ptr_this->auth_params_->robusto_token_)
                 {
                     ptr_this->auth_params_->reset_robusto();
-                    ptr_this->post_robusto_packet_internal(_packet, _handlers, _recursion_count + 1, _error);
                 }
+
+                ptr_this->post_robusto_packet_internal(_packet, _handlers, _recursion_count + 1, _error);
             }
             else
             {
@@ -3469,6 +3676,9 @@ std::shared_ptr<async_task_handlers> im::post_robusto_packet_internal(
     uint32_t _recursion_count,
     int32_t _last_error)
 {
+    if (!_handlers)
+        _handlers = std::make_shared<async_task_handlers>();
+
     if (_recursion_count > 5)
     {
         if (_handlers->on_result_)
@@ -3477,18 +3687,10 @@ std::shared_ptr<async_task_handlers> im::post_robusto_packet_internal(
         return _handlers;
     }
 
-    if (!_handlers)
-        _handlers = std::make_shared<async_task_handlers>();
-
-    if (robusto_threads_->is_get_robusto_token_in_process())
-    {
-        robusto_threads_->push_packet_to_queue(_packet, _handlers);
-        return _handlers;
-    }
-
     std::weak_ptr<core::wim::im> wr_this = shared_from_this();
 
-    if (!auth_params_->is_robusto_valid())
+    // the packets which come while the token is requested wait for the same request
+    if (!auth_params_->is_robusto_valid() || robusto_threads_->is_get_robusto_token_in_process())
     {
         get_robusto_token()->on_result_ = [_handlers, wr_this, _recursion_count, _packet](int32_t _error)
         {
@@ -3499,11 +3701,6 @@ std::shared_ptr<async_task_handlers> im::post_robusto_packet_internal(
             if (_error == 0)
             {
                 ptr_this->post_robusto_packet_to_server(_handlers, _packet, _recursion_count);
-
-                while ( auto packet_and_handler = ptr_this->robusto_threads_->get_front_packet_from_queue() )
-                {
-                    ptr_this->post_robusto_packet_to_server(packet_and_handler->handlers_, packet_and_handler->packet_, _recursion_count + 1);
-                }
             }
             else
             {
@@ -3528,18 +3725,35 @@ std::shared_ptr<async_task_handlers> im::post_robusto_packet(std::shared_ptr<rob
 std::shared_ptr<archive::face> im::get_archive()
 {
     if (!archive_)
-        archive_ = std::make_shared<archive::face>(get_im_data_path() + L"/archive");
+    {
+        std::weak_ptr<im> wr_this = shared_from_this();
+
+        // the gallery shows what was indexed so far and reloads once the index is complete
+        archive_ = std::make_shared<archive::face>(get_im_data_path() + L"/archive", [wr_this](const std::string& _contact)
+        {
+            g_core->execute_core_context([wr_this, _contact]
+            {
+                auto ptr_this = wr_this.lock();
+                if (!ptr_this)
+                    return;
+
+                coll_helper coll(g_core->create_collection(), true);
+                coll.set_value_as_string("contact", _contact);
+                g_core->post_message_to_gui("archive/images/built", 0, coll.get());
+            });
+        });
+    }
 
     return archive_;
 }
 
-void im::get_archive_images(int64_t _seq, const std::string& _contact, int64_t _from, int64_t _count)
+void im::get_archive_images(int64_t _seq, const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types)
 {
     std::weak_ptr<im> wr_this = shared_from_this();
 
     add_opened_dialog(_contact);
 
-    get_archive()->get_images(_contact, _from, _count)->on_result =
+    get_archive()->get_images(_contact, _from, _count, _types)->on_result =
         [wr_this, _seq](std::shared_ptr<archive::image_list> _images)
     {
         auto ptr_this = wr_this.lock();
@@ -3556,6 +3770,7 @@ void im::get_archive_images(int64_t _seq, const std::string& _contact, int64_t _
             data.set_value_as_int64("msgid", image.get_msgid());
             data.set_value_as_string("url", image.get_url());
             data.set_value_as_bool("is_filesharing", image.get_is_filesharing());
+            data.set_value_as_int("type", static_cast<int32_t>(image.get_type()));
 
             ifptr<ivalue> val(coll->create_value());
             val->set_as_collection(data.get());
@@ -3940,7 +4155,7 @@ void im::get_archive_messages_buddies(int64_t _seq, const std::string& _contact,
     };
 }
 
-std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_history_params& _params, std::function<void(int64_t)> last_message_catcher)
+std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_history_params& _params, std::function<void(int64_t)> last_message_catcher, std::function<void(int64_t, size_t)> _on_received)
 {
     auto out_handler = std::make_shared<async_task_handlers>();
     auto packet = std::make_shared<core::wim::get_history>(make_wim_params(), _params, g_core->get_locale());
@@ -3961,7 +4176,7 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
     const bool init = _params.init_;
     const bool from_deleted = _params.from_deleted_;
 
-    post_robusto_packet(packet)->on_result_ = [wr_this, packet, contact, init, from_deleted, on_result, last_message_catcher, from_msgid](int32_t _error)
+    post_robusto_packet(packet)->on_result_ = [wr_this, packet, contact, init, from_deleted, on_result, last_message_catcher, from_msgid, _on_received](int32_t _error)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -3977,6 +4192,18 @@ std::shared_ptr<async_task_handlers> im::get_history_from_server(const get_histo
 
         auto messages = packet->get_messages();
 
+        if (_on_received)
+        {
+            int64_t oldest_msgid = -1;
+            for (const auto& message : *messages)
+            {
+                if (oldest_msgid == -1 || message->get_msgid() < oldest_msgid)
+                    oldest_msgid = message->get_msgid();
+            }
+
+            _on_received(oldest_msgid, messages->size());
+        }
+
         __INFO(
             "delete_history",
             "processing incoming history from a server\n"
@@ -4151,12 +4378,51 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 {
     __INFO("archive", "im::download_holes, contact=%1%", _contact);
 
+    holes_scheduler_->push(holes::scheduler::job(holes::request(_contact, _from, _depth, _recursion), last_message_catcher), has_opened_dialogs(_contact));
+
+    run_holes_jobs();
+}
+
+void im::run_holes_jobs()
+{
+    std::weak_ptr<im> wr_this = shared_from_this();
+
+    while (auto job = holes_scheduler_->pop())
+    {
+        const auto contact = job->request_.get_contact();
+
+        // the slot is freed when the last page of the contact is handled, whichever way it ends
+        auto job_scope = std::make_shared<tools::auto_scope>([wr_this, contact]
+        {
+            g_core->execute_core_context([wr_this, contact]
+            {
+                auto ptr_this = wr_this.lock();
+                if (!ptr_this)
+                    return;
+
+                ptr_this->holes_scheduler_->finish(contact);
+                ptr_this->run_holes_jobs();
+            });
+        });
+
+        download_holes_page(
+            contact,
+            job->request_.get_from(),
+            job->request_.get_depth(),
+            job->request_.get_recursion(),
+            job->last_message_catcher_,
+            job_scope);
+    }
+}
+
+void im::download_holes_page(const std::string& _contact, int64_t _from, int64_t _depth, int32_t _recursion, std::function<void(int64_t)> last_message_catcher, std::shared_ptr<tools::auto_scope> _job_scope)
+{
     std::weak_ptr<im> wr_this = shared_from_this();
 
     holes::request hole_request(_contact, _from, _depth, _recursion);
 
     get_archive()->get_next_hole(_contact, _from, _depth)->on_result =
-    	[wr_this, _contact, _depth, _recursion, hole_request, last_message_catcher](std::shared_ptr<archive::archive_hole> _hole)
+    	[wr_this, _contact, _depth, _recursion, hole_request, last_message_catcher, _job_scope](std::shared_ptr<archive::archive_hole> _hole)
     {
         auto ptr_this = wr_this.lock();
         if (!ptr_this)
@@ -4177,7 +4443,7 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
             return;
         }
 
-        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _hole, _contact, _depth, _recursion, hole_request, last_message_catcher](const archive::dlg_state& _state)
+        ptr_this->get_archive()->get_dlg_state(_contact)->on_result = [wr_this, _hole, _contact, _depth, _recursion, hole_request, last_message_catcher, _job_scope](const archive::dlg_state& _state)
         {
             auto ptr_this = wr_this.lock();
             if (!ptr_this)
@@ -4226,7 +4492,46 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
                     return;
             }
 
-            ptr_this->get_history_from_server(hist_params, last_message_catcher)->on_result_ = [wr_this, _contact, _hole, depth_tail, _recursion, hole_request, count, last_message_catcher](int32_t _error)
+            // the next page of a deep hole is requested while this one is being written to the archive;
+            // the chain goes on only when that request completes, so get_next_hole finds the range filled
+            auto prefetch = std::make_shared<std::shared_ptr<async_task_handlers>>();
+
+            auto on_received = [wr_this, _contact, till_msg_id, count, patch_version, depth_tail, prefetch, last_message_catcher](int64_t _oldest_msgid, size_t _received)
+            {
+                auto ptr_this = wr_this.lock();
+                if (!ptr_this)
+                    return;
+
+                const auto is_page_full = ((int64_t)_received >= (-1 * count));
+                const auto is_hole_left = (_oldest_msgid > 0) && (till_msg_id == -1 || _oldest_msgid > till_msg_id);
+                // the next page walks the received messages and the hole start, the same check as above
+                const auto is_depth_left = (depth_tail == -1 || depth_tail > (int64_t)_received + 1);
+                if (!is_page_full || !is_hole_left || !is_depth_left)
+                    return;
+
+                get_history_params next_params(
+                    _contact,
+                    _oldest_msgid,
+                    till_msg_id,
+                    count,
+                    patch_version,
+                    false);
+
+                auto handlers = std::make_shared<async_task_handlers>();
+                *prefetch = handlers;
+
+                ptr_this->get_history_from_server(next_params, last_message_catcher)->on_result_ = [prefetch, handlers](int32_t /*_error*/)
+                {
+                    // a failed prefetch leaves the hole in place for get_next_hole
+                    if (*prefetch == handlers)
+                        prefetch->reset();
+
+                    if (handlers->on_result_)
+                        handlers->on_result_(0);
+                };
+            };
+
+            ptr_this->get_history_from_server(hist_params, last_message_catcher, on_received)->on_result_ = [wr_this, _contact, _hole, depth_tail, _recursion, hole_request, count, last_message_catcher, _job_scope, prefetch](int32_t _error)
             {
                 auto ptr_this = wr_this.lock();
                 if (!ptr_this)
@@ -4234,13 +4539,25 @@ void im::download_holes(const std::string& _contact, int64_t _from, int64_t _dep
 
                 if (_error == 0)
                 {
-                    ptr_this->get_archive()->validate_hole_request(_contact, *_hole, count)->on_result = [wr_this, _contact, depth_tail, _recursion, last_message_catcher](int64_t _from)
+                    ptr_this->get_archive()->validate_hole_request(_contact, *_hole, count)->on_result = [wr_this, _contact, depth_tail, _recursion, last_message_catcher, _job_scope, prefetch](int64_t _from)
                     {
                         auto ptr_this = wr_this.lock();
                         if (!ptr_this)
                             return;
 
-                        ptr_this->download_holes(_contact, _from, depth_tail, (_recursion + 1), last_message_catcher);
+                        auto next_page = [wr_this, _contact, _from, depth_tail, _recursion, last_message_catcher, _job_scope](int32_t)
+                        {
+                            auto ptr_this = wr_this.lock();
+                            if (!ptr_this)
+                                return;
+
+                            ptr_this->download_holes_page(_contact, _from, depth_tail, (_recursion + 1), last_message_catcher, _job_scope);
+                        };
+
+                        if (*prefetch)
+                            (*prefetch)->on_result_ = next_page;
+                        else
+                            next_page(0);
 
                         return;
 
@@ -4969,196 +5286,109 @@ void im::login_normalize_phone(int64_t _seq, const std::string& _country, const
     };
 }
 
-void im::history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, std::shared_ptr<archive::contact_and_msgs> _thread_archive
-                                  , std::shared_ptr<tools::binary_stream> data, int64_t _seq
-                                  , int64_t _min_id)
+void im::history_search_next_contact(std::shared_ptr<archive::search_context> _context, int64_t _seq)
 {
-    if (search_data_.req_id != _seq || search_data_.req_id == -1)
-        return;
+    std::weak_ptr<wim::im> wr_this(shared_from_this());
 
-    auto contact_and_offsets = std::make_shared<archive::contact_and_offsets>();
+    auto history = get_archive();
 
-    auto max_contacts_for_one_buffer = 100u;
-    for (auto index = 0u; index < max_contacts_for_one_buffer && index < search_data_.contact_and_offset.size(); ++index)
+    history_searcher_->run_t_async_function<bool>([_context, history]()->bool
     {
-        auto item = search_data_.contact_and_offset.back();
-        search_data_.contact_and_offset.pop_back();
-        contact_and_offsets->push_back(item);
-    }
+        static auto& contact_time = metrics::get_histogram("history_search.contact");
 
-    std::weak_ptr<wim::im> wr_this(shared_from_this());
+        std::string contact;
+        if (!_context->pop_contact(contact))
+            return false;
 
-    get_archive()->get_history_block(contact_and_offsets, _thread_archive, data)->on_result =
-        [_cterm, contact_and_offsets, wr_this, _seq, _min_id]
-            (std::shared_ptr<archive::contact_and_msgs> _archive, std::shared_ptr<archive::contact_and_offsets> _remaining, std::shared_ptr<tools::binary_stream> _data)
-            {
-                auto ptr_this = wr_this.lock();
-                if (!ptr_this)
-                    return;
+        metrics::auto_timer timer(contact_time);
 
-                if (ptr_this->search_data_.req_id != _seq || ptr_this->search_data_.req_id == -1)
-                    return;
+        archive::messages_data::search_in_file(history->get_history_file_name(contact), contact, *_context);
 
-                if (_remaining)
-                {
-                    for (const auto& item : *_remaining)
-                    {
-                        ptr_this->search_data_.contact_and_offset.push_back(item);
-                    }
-                }
+        return true;
 
-                ptr_this->history_searcher_->run_t_async_function<std::vector<std::shared_ptr<::core::archive::searched_msg>>>(
-                    [_cterm, _archive, contact_and_offsets, _seq, _min_id, _data]()->std::vector<std::shared_ptr<::core::archive::searched_msg>>
-                        {
-                            std::vector<std::shared_ptr<::core::archive::searched_msg>> messages_ids;
+    })->on_result_ = [wr_this, _context, _seq](bool _scanned)
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
 
-                            if (_archive->size() > 1)
-                            {
-                                archive::messages_data::search_in_archive(contact_and_offsets, _cterm, _archive, _data, messages_ids, _min_id);
-                            }
+        if (ptr_this->search_data_.req_id != _seq || ptr_this->search_data_.req_id == -1)
+            return;
 
-                            return messages_ids;
+        if (_scanned)
+        {
+            ptr_this->history_search_next_contact(_context, _seq);
+        }
+        else
+        {
+            ++ptr_this->search_data_.count_of_free_threads;
 
-                        })->on_result_ = [wr_this, contact_and_offsets, _archive, _seq, _min_id, _data, _cterm]
-                        (std::vector<std::shared_ptr<::core::archive::searched_msg>> messages_ids)
-                        {
-                            auto ptr_this = wr_this.lock();
-                            if (!ptr_this)
-                                return;
+            if (ptr_this->search_data_.count_of_free_threads == search_threads_count)
+            {
+                static auto& search_time = metrics::get_histogram("history_search.total");
+                search_time.record(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::system_clock::now() - ptr_this->search_data_.start_time));
+            }
+        }
 
-                            if (ptr_this->search_data_.req_id != _seq || ptr_this->search_data_.req_id == -1)
-                                return;
+        if (ptr_this->search_data_.count_of_free_threads == search_threads_count
+            || std::chrono::system_clock::now() > ptr_this->search_data_.last_send_time + sending_search_results_interval)
+        {
+            ptr_this->post_history_search_results(_seq);
+        }
+    };
+}
 
-                            for (const auto& item : *contact_and_offsets)
-                            {
-                                auto offset = item.second;
-                                auto contact = item.first.first;
-                                auto mode = item.first.second;
-                                if (*mode == 0)
-                                {
-                                    ptr_this->search_data_.contact_and_offset.push_front(std::make_pair(std::make_pair(contact, std::make_shared<int64_t>(2)), std::make_shared<int64_t>(0)));
-                                }
-                                *mode = 1;
+void im::post_history_search_results(int64_t _seq)
+{
+    search_data_.last_send_time = std::chrono::system_clock::now();
 
-                                if (*offset > 0)
-                                {
-                                    ptr_this->search_data_.contact_and_offset.push_back(std::make_pair(std::make_pair(contact, mode), offset));
-                                }
-                            }
+    auto results = std::make_shared<archive::searched_msgs>(search_data_.context->take_results());
+    if (results->empty())
+    {
+        check_history_search_finished();
+        return;
+    }
 
-                            if (!ptr_this->search_data_.contact_and_offset.empty())
-                            {
-                                int64_t last_id = -1;
-                                if (ptr_this->search_data_.top_messages.size() >= ::common::get_limit_search_results())
-                                    last_id = ptr_this->search_data_.top_messages_ids.rbegin()->first;
+    ++search_data_.count_of_checks_in_progress;
 
-                                ptr_this->history_search_one_batch(_cterm, _archive, _data, ptr_this->search_data_.req_id, last_id);
-                            }
-                            else
-                            {
-                                ++ptr_this->search_data_.count_of_free_threads;
-                            }
+    std::weak_ptr<wim::im> wr_this(shared_from_this());
 
-                            for (const auto& item : messages_ids)
-                            {
-                                if (ptr_this->search_data_.top_messages_ids.count(item->id) != 0)
-                                    continue;
+    // the messages are decoded by the search already, the archive only drops deleted ones and rereads changed ones
+    get_archive()->check_search_results(results)->on_result = [wr_this, _seq](std::shared_ptr<archive::searched_msgs> _results)
+    {
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
 
-                                if (ptr_this->search_data_.top_messages_ids.size() < ::common::get_limit_search_results())
-                                {
-                                    ptr_this->search_data_.top_messages.push_back(item);
-                                    ptr_this->search_data_.top_messages_ids.insert(std::make_pair(item->id, ptr_this->search_data_.top_messages.size() - 1));
-                                }
-                                else
-                                {
-                                    auto greater = ptr_this->search_data_.top_messages_ids.upper_bound(item->id);
-
-                                    if (greater != ptr_this->search_data_.top_messages_ids.end())
-                                    {
-                                        auto index = ptr_this->search_data_.top_messages_ids.rbegin()->second;
-                                        auto min_id = ptr_this->search_data_.top_messages_ids.rbegin()->first;
-
-                                        if (index == -1)
-                                        {
-                                            ptr_this->search_data_.top_messages.push_back(item);
-                                            index = ptr_this->search_data_.top_messages.size() - 1;
-                                        }
-                                        else
-                                        {
-                                            ptr_this->search_data_.top_messages[index] = item;
-                                        }
-
-                                        ptr_this->search_data_.top_messages_ids.erase(min_id);
-                                        ptr_this->search_data_.top_messages_ids.insert(std::make_pair(item->id, index));
-                                    }
-                                }
-                            }
+        if (ptr_this->search_data_.req_id != _seq || ptr_this->search_data_.req_id == -1)
+            return;
 
-                            auto post_empty_search_result = [](const auto _reqid)
-                            {
-                                coll_helper cl_coll(g_core->create_collection(), true);
-                                cl_coll.set<int64_t>("req_id", _reqid);
-                                g_core->post_message_to_gui("empty_search_results", 0, cl_coll.get());
-                                g_core->insert_event(stats::stats_event_names::cl_search_nohistory);
-                            };
+        --ptr_this->search_data_.count_of_checks_in_progress;
 
-                            if (ptr_this->search_data_.count_of_free_threads == search_threads_count
-                                    || (std::chrono::system_clock::now() > ptr_this->search_data_.last_send_time + sending_search_results_interval))
-                            {
-                                ptr_this->search_data_.count_of_yet_no_sent_msgs = ptr_this->search_data_.top_messages.size();
+        for (const auto& item : *_results)
+        {
+            ++ptr_this->search_data_.count_of_sent_msgs;
+            ptr_this->post_history_search_result_msg_to_gui(item->contact, true, true, _seq, false /* is_contact */, item->message, item->term, 0);
+        }
 
-                                for (const auto& item : ptr_this->search_data_.top_messages)
-                                {
-                                    auto aimid = item->contact;
-                                    auto msg_id = item->id;
-                                    auto term = item->term;
-                                    ptr_this->get_archive()->get_messages(aimid, msg_id, 0, 1)->on_result = [wr_this, aimid, term, msg_id, _seq, post_empty_search_result]
-                                    (std::shared_ptr<archive::history_block> _messages)
-                                    {
-                                        auto ptr_this = wr_this.lock();
-                                        if (!ptr_this)
-                                            return;
-
-                                        --ptr_this->search_data_.count_of_yet_no_sent_msgs;
-
-                                        if (ptr_this->search_data_.req_id != _seq
-                                            || ptr_this->search_data_.req_id == -1
-                                            || _messages->empty()
-                                            || (*_messages)[0]->get_msgid() != msg_id
-                                            || (*_messages)[0]->is_chat_event_deleted()
-                                            || (*_messages)[0]->is_deleted())
-                                        {
-                                            ptr_this->search_data_.top_messages_ids.erase(msg_id);
-
-                                            if (ptr_this->search_data_.count_of_free_threads == search_threads_count
-                                                && ptr_this->search_data_.count_of_yet_no_sent_msgs == 0
-                                                && ptr_this->search_data_.count_of_sent_msgs == 0)
-                                            {
-                                                post_empty_search_result(ptr_this->search_data_.req_id);
-                                            }
-                                        }
-                                        else
-                                        {
-                                            ++ptr_this->search_data_.count_of_sent_msgs;
-                                            ptr_this->post_history_search_result_msg_to_gui(aimid, true, true, ptr_this->search_data_.req_id
-                                                , false /* is_contact */, (*_messages)[0], term, 0);
-                                        }
-                                    };
-
-                                    ptr_this->search_data_.top_messages_ids[item->id] = -1;
-                                }
+        ptr_this->check_history_search_finished();
+    };
+}
 
-                                ptr_this->search_data_.top_messages.clear();
-                                ptr_this->search_data_.last_send_time = std::chrono::system_clock::now();
-                            }
+void im::check_history_search_finished()
+{
+    if (search_data_.count_of_free_threads != search_threads_count
+        || search_data_.count_of_checks_in_progress != 0
+        || search_data_.count_of_sent_msgs != 0)
+    {
+        return;
+    }
 
-                            if (ptr_this->search_data_.count_of_free_threads == search_threads_count
-                                && ptr_this->search_data_.top_messages_ids.empty())
-                            {
-                                post_empty_search_result(ptr_this->search_data_.req_id);
-                            }
-                        };
-            };
+    coll_helper cl_coll(g_core->create_collection(), true);
+    cl_coll.set<int64_t>("req_id", search_data_.req_id);
+    g_core->post_message_to_gui("empty_search_results", 0, cl_coll.get());
+    g_core->insert_event(stats::stats_event_names::cl_search_nohistory);
 }
 
 void im::history_search_in_cl(const std::vector<std::vector<std::string>>& search_patterns, int64_t _req_id, unsigned fixed_patterns_count, const std::string& pattern)
@@ -5220,14 +5450,16 @@ void im::history_search_in_cl(const std::vector<std::vector<std::string>>& searc
 
 void im::setup_search_params(int64_t _req_id)
 {
+    // the workers of the previous search stop after the part of a file they are reading
+    if (search_data_.context)
+        search_data_.context->cancel();
+
+    search_data_.context.reset();
     search_data_.start_time = std::chrono::system_clock::now();
     search_data_.last_send_time = std::chrono::system_clock::now() - 2 * sending_search_results_interval;
     search_data_.req_id = _req_id;
-    search_data_.top_messages.clear();
-    search_data_.count_of_yet_no_sent_msgs = 0;
+    search_data_.count_of_checks_in_progress = 0;
     search_data_.count_of_sent_msgs = 0;
-    search_data_.top_messages_ids.clear();
-    search_data_.contact_and_offset.clear();
     search_data_.count_of_free_threads = search_threads_count;
 }
 
@@ -5244,19 +5476,18 @@ void im::history_search_in_history(const std::string& term, const std::vector<st
         return;
     }
 
+    std::vector<std::string> contacts;
     if (_aimids.empty())
     {
+        contacts.reserve(contact_list_->contacts_index_.size());
         for (const auto& item : contact_list_->contacts_index_)
         {
-            search_data_.contact_and_offset.push_back(std::make_pair(std::make_pair(item.second->aimid_, std::make_shared<int64_t>(0)), std::make_shared<int64_t>(0)));
+            contacts.push_back(item.second->aimid_);
         }
     }
     else
     {
-        for (const auto& item : _aimids)
-        {
-            search_data_.contact_and_offset.push_back(std::make_pair(std::make_pair(item, std::make_shared<int64_t>(0)), std::make_shared<int64_t>(0)));
-        }
+        contacts = _aimids;
     }
 
     auto last_symb_id = std::make_shared<int32_t>(0);
@@ -5266,26 +5497,43 @@ void im::history_search_in_history(const std::string& term, const std::vector<st
     cterm->coded_string = tools::convert_string_to_vector(term, last_symb_id, cterm->symbs, cterm->symb_indexes, cterm->symb_table);
     cterm->prefix = std::vector<int32_t>(tools::build_prefix(cterm->coded_string));
 
-    auto started_contact_count = std::min<int64_t>(search_threads_count, search_data_.contact_and_offset.size());
-    for (auto i = 0; i < started_contact_count; ++i)
+    auto context = std::make_shared<archive::search_context>(cterm, ::common::get_limit_search_results());
+    search_data_.context = context;
+
+    const auto seq = search_data_.req_id;
+
+    std::weak_ptr<wim::im> wr_this(shared_from_this());
+
+    // the last message ids order the contacts newest first and let the search stop
+    // as soon as none of the remaining contacts can have a message newer than the found ones
+    get_archive()->get_dlg_states(contacts)->on_result = [wr_this, contacts, context, seq](const std::vector<archive::dlg_state>& _states)
     {
-        auto thread_archive = std::make_shared<archive::contact_and_msgs>();
+        auto ptr_this = wr_this.lock();
+        if (!ptr_this)
+            return;
 
-        auto data = std::make_shared<tools::binary_stream>();
-        data->reserve(1024 * 1024 * 10);
+        if (ptr_this->search_data_.req_id != seq || ptr_this->search_data_.req_id == -1)
+            return;
 
-        --search_data_.count_of_free_threads;
+        assert(_states.size() == contacts.size());
 
-        history_search_one_batch(cterm, thread_archive, data, search_data_.req_id, -1 /* _min_id */);
-    }
+        for (auto i = 0u; i < contacts.size() && i < _states.size(); ++i)
+        {
+            const auto last_msgid = _states[i].get_last_msgid();
+            context->add_contact(contacts[i], last_msgid > 0 ? last_msgid : std::numeric_limits<int64_t>::max());
+        }
 
-    if (started_contact_count == 0)
-    {
-        coll_helper cl_coll(g_core->create_collection(), true);
-        cl_coll.set<int64_t>("req_id", search_data_.req_id);
-        g_core->post_message_to_gui("empty_search_results", 0, cl_coll.get());
-        g_core->insert_event(stats::stats_event_names::cl_search_nohistory);
-    }
+        const auto started_contact_count = std::min<int64_t>(search_threads_count, contacts.size());
+        for (auto i = 0; i < started_contact_count; ++i)
+        {
+            --ptr_this->search_data_.count_of_free_threads;
+
+            ptr_this->history_search_next_contact(context, seq);
+        }
+
+        if (started_contact_count == 0)
+            ptr_this->check_history_search_finished();
+    };
 }
 
 void im::login_get_sms_code(int64_t _seq, const phone_info& _info, bool _is_login)
@@ -6063,6 +6311,10 @@ void im::post_not_sent_message_to_gui(int64_t _seq, const archive::not_sent_mess
 void im::add_opened_dialog(const std::string& _contact)
 {
     opened_dialogs_.insert(std::make_pair(_contact, archive::opened_dialog()));
+
+    holes_scheduler_->prioritize(_contact);
+
+    run_holes_jobs();
 }
 
 void im::remove_opened_dialog(const std::string& _contact)
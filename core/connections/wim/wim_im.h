@@ -48,6 +48,7 @@ namespace core
     namespace tools
     {
         class binary_stream;
+        class auto_scope;
     }
 
     namespace archive
@@ -66,10 +67,7 @@ namespace core
         typedef std::list<message_header> headers_list;
         typedef std::shared_ptr<headers_list> headers_list_sptr;
 
-        typedef std::vector<std::pair<std::string, int64_t>> contact_and_msgs;
-        typedef std::vector<std::pair<std::pair<std::string, std::shared_ptr<int64_t>>, std::shared_ptr<int64_t>>> contact_and_offsets;
-
-        struct coded_term;
+        class search_context;
     }
 
     namespace themes
@@ -127,6 +125,7 @@ namespace core
         {
             class request;
             class failed_requests;
+            class scheduler;
         }
 
 
@@ -157,6 +156,8 @@ namespace core
         //////////////////////////////////////////////////////////////////////////
         // wim_send_thread
         //////////////////////////////////////////////////////////////////////////
+        // queued, running and executed packets and their wait are published
+        // by ordering class as "wim.send.*" metrics
         class wim_send_thread : public async_executer, public std::enable_shared_from_this<wim_send_thread>
         {
             struct task_and_params
@@ -164,6 +165,8 @@ namespace core
                 std::shared_ptr<wim_packet> task_;
                 std::function<void(int32_t)> error_handler_;
                 std::shared_ptr<async_task_handlers> callback_handlers_;
+                ordering_key key_;
+                std::chrono::steady_clock::time_point queued_time_;
 
                 task_and_params(
                     std::shared_ptr<wim_packet> _task,
@@ -172,15 +175,35 @@ namespace core
                     :
                 task_(_task),
                     error_handler_(_error_handler),
-                    callback_handlers_(_callback_handlers) {}
+                    callback_handlers_(_callback_handlers),
+                    key_(_task->get_ordering_key()),
+                    queued_time_(std::chrono::steady_clock::now()) {}
+            };
+
+            // packets of one key run in order, one at a time
+            struct key_queue
+            {
+                std::list<task_and_params> packets_;
+                bool is_running_;
+
+                key_queue() : is_running_(false) {}
             };
 
-            bool is_packet_execute_;
-            std::list<task_and_params> packets_queue_;
+            const uint32_t max_running_;
+            uint32_t running_;
+
+            std::map<ordering_key, key_queue> queues_;
+
+            // keys with queued packets and nothing running, in the order they became ready
+            std::list<ordering_key> ready_keys_;
 
             std::chrono::system_clock::time_point cancel_packets_time_;
 
-            void execute_packet_from_queue();
+            void schedule();
+
+            void run_packet(const task_and_params& _packet);
+
+            void on_packet_finished(const ordering_key& _key);
 
             std::shared_ptr<async_task_handlers> post_packet(
                 std::shared_ptr<wim_packet> _packet,
@@ -192,7 +215,7 @@ namespace core
             std::shared_ptr<async_task_handlers> post_packet(std::shared_ptr<wim_packet> _packet, std::function<void(int32_t)> _error_handler);
             void clear();
 
-            wim_send_thread();
+            explicit wim_send_thread(uint32_t _max_running);
             virtual ~wim_send_thread();
         };
 
@@ -205,24 +228,11 @@ namespace core
 
         class robusto_thread : public async_executer, public std::enable_shared_from_this<robusto_thread>
         {
-            struct task_and_params
-            {
-                std::shared_ptr<robusto_packet>			packet_;
-                std::shared_ptr<async_task_handlers>	handlers_;
-
-                task_and_params(
-                    std::shared_ptr<robusto_packet> _packet,
-                    std::shared_ptr<async_task_handlers> _handlers)
-                    :
-                packet_(_packet),
-                    handlers_(_handlers)
-                {
-                }
-            };
-
             bool	is_get_robusto_token_in_process_;
 
-            std::list<std::shared_ptr<task_and_params>>	packets_queue_;
+            // callers of get_robusto_token which came while the token was being requested,
+            // the packets waiting for the new token are sent or failed together when it comes
+            std::list<std::shared_ptr<async_task_handlers>> token_waiters_;
 
         public:
 
@@ -234,11 +244,8 @@ namespace core
             bool is_get_robusto_token_in_process()					{ return is_get_robusto_token_in_process_; }
             void set_robusto_token_in_process(bool _is_in_process)	{ is_get_robusto_token_in_process_ = _is_in_process; }
 
-            void push_packet_to_queue(
-                std::shared_ptr<robusto_packet> _packet,
-                std::shared_ptr<async_task_handlers> _handlers);
-
-            std::shared_ptr<task_and_params> get_front_packet_from_queue();
+            void push_token_waiter(std::shared_ptr<async_task_handlers> _handlers);
+            std::list<std::shared_ptr<async_task_handlers>> take_token_waiters();
         };
 
 
@@ -261,18 +268,18 @@ namespace core
             search_data()
                 : req_id(0)
                 , count_of_free_threads(0)
+                , count_of_sent_msgs(0)
+                , count_of_checks_in_progress(0)
             {
             }
 
-            std::list<std::pair<std::pair<std::string, std::shared_ptr<int64_t>>, std::shared_ptr<int64_t>>> contact_and_offset;
+            std::shared_ptr<archive::search_context> context;
             std::chrono::time_point<std::chrono::system_clock> start_time;
             std::chrono::time_point<std::chrono::system_clock> last_send_time;
             int64_t req_id;
-            std::map<int64_t, int32_t, std::greater<int64_t>> top_messages_ids;
             int32_t count_of_free_threads;
             int32_t count_of_sent_msgs;
-            std::vector<std::shared_ptr<::core::archive::searched_msg>> top_messages;
-            int32_t count_of_yet_no_sent_msgs;
+            int32_t count_of_checks_in_progress;
         };
 
         class gui_message
@@ -374,6 +381,8 @@ namespace core
 
             std::shared_ptr<holes::failed_requests> failed_holes_requests_;
 
+            std::shared_ptr<holes::scheduler> holes_scheduler_;
+
             bool sent_pending_messages_active_;
 
             // statistic
@@ -404,6 +413,19 @@ namespace core
             // syncronized with dlg_state messages
             gui_messages_list gui_messages_queue_;
 
+            // the fetched responses, their events are dispatched one response after another
+            // while the next fetch waits for the server
+            struct fetched_events
+            {
+                std::shared_ptr<fetch> packet_;
+                uint64_t session_id_;
+                bool is_first_;
+                bool poll_after_dispatch_;
+            };
+
+            std::list<fetched_events> fetched_events_;
+            bool dispatching_fetched_events_;
+
 
             robusto_packet_params make_robusto_params() const;
 
@@ -416,6 +438,7 @@ namespace core
             void store_auth_parameters();
             void load_auth_and_fetch_parameters();
             void store_fetch_parameters();
+            void store_fetch_parameters(const fetch_parameters& _params);
             std::wstring get_auth_parameters_filename();
             std::wstring get_auth_parameters_filename_exported();
             std::wstring get_auth_parameters_filename_merge();
@@ -440,7 +463,9 @@ namespace core
             void download_stickers_metafile(int64_t _seq, const std::string& _size, const std::string& _md5);
 
 
-            void download_stickers(const bool _recursive = false);
+            void download_stickers();
+            void download_next_sticker();
+            void on_sticker_downloaded();
 
 
             virtual void get_stickers_meta(int64_t _seq, const std::string& _size) override;
@@ -521,6 +546,7 @@ namespace core
             void poll(bool _is_first, poll_reason _reason, int32_t _failed_network_error_count = 0);
 
             void dispatch_events(std::shared_ptr<fetch> _fetch_packet, std::function<void(int32_t)> _on_complete = [](int32_t){});
+            void dispatch_fetched_events();
 
             void schedule_store_timer();
             void stop_store_timer();
@@ -596,7 +622,7 @@ namespace core
             std::shared_ptr<async_task_handlers> get_robusto_token();
 
             // history functions
-            void get_archive_images(int64_t _seq, const std::string& _contact, int64_t _from, int64_t _count) override;
+            void get_archive_images(int64_t _seq, const std::string& _contact, int64_t _from, int64_t _count, uint32_t _types) override;
             void repair_archive_images(int64_t _seq, const std::string& _contact) override;
             void get_archive_index(int64_t _seq, const std::string& _contact, int64_t _from, int64_t _count, int32_t _recursion, std::function<void(int64_t)> last_message_catcher);
             void get_archive_messages(int64_t _seq, const std::string& _contact, int64_t _from, int64_t _count_early, int64_t _count_later, int32_t _recursion, bool _need_prefetch, bool _first_request, std::function<void(int64_t)> last_message_catcher);
@@ -606,7 +632,8 @@ namespace core
             virtual void get_archive_index(int64_t _seq_, const std::string& _contact, int64_t _from, int64_t _count, std::function<void(int64_t)> last_message_catcher) override;
             virtual void get_archive_messages_buddies(int64_t _seq, const std::string& _contact, std::shared_ptr<archive::msgids_list> _ids) override;
 
-            std::shared_ptr<async_task_handlers> get_history_from_server(const get_history_params& _params, std::function<void(int64_t)> last_message_catcher);
+            // _on_received is called with the oldest message id and the count of messages before they are written to the archive
+            std::shared_ptr<async_task_handlers> get_history_from_server(const get_history_params& _params, std::function<void(int64_t)> last_message_catcher, std::function<void(int64_t, size_t)> _on_received = nullptr);
             std::shared_ptr<async_task_handlers> set_dlg_state(set_dlg_state_params _params);
             virtual void add_opened_dialog(const std::string& _contact) override;
             virtual void remove_opened_dialog(const std::string& _contact) override;
@@ -627,6 +654,8 @@ namespace core
             void download_holes(const std::string& _contact, std::function<void(int64_t)> last_message_catcher);
             void download_holes(const std::string& _contact, int64_t _depth = -1, std::function<void(int64_t)> last_message_catcher = [](int64_t) {});
             void download_holes(const std::string& _contact, int64_t _from, int64_t _depth = -1, int32_t _recursion = 0, std::function<void(int64_t)> last_message_catcher = [](int64_t){});
+            void download_holes_page(const std::string& _contact, int64_t _from, int64_t _depth, int32_t _recursion, std::function<void(int64_t)> last_message_catcher, std::shared_ptr<tools::auto_scope> _job_scope);
+            void run_holes_jobs();
 
             virtual std::string _get_protocol_uid() override;
 
@@ -800,9 +829,9 @@ namespace core
 
             // prefetching
 
-            void history_search_one_batch(std::shared_ptr<archive::coded_term> _cterm, std::shared_ptr<archive::contact_and_msgs> _archive
-                , std::shared_ptr<tools::binary_stream> _data, int64_t _seq
-                , int64_t _min_id);
+            void history_search_next_contact(std::shared_ptr<archive::search_context> _context, int64_t _seq);
+            void post_history_search_results(int64_t _seq);
+            void check_history_search_finished();
 
             void prefetch_last_dialog_messages(const std::string &_dlg_aimid, const char* const _reason);
 
@@ -6,6 +6,7 @@
 #include "../../tools/hmac_sha_base64.h"
 #include "../../log/log.h"
 #include "../../utils.h"
+#include "../../tools/metrics.h"
 
 using namespace core;
 using namespace wim;
@@ -33,6 +34,21 @@ bool wim_packet::support_async_execution() const
     return false;
 }
 
+ordering_key wim_packet::get_ordering_key() const
+{
+    return ordering_key();
+}
+
+ordering_key ordering_key::make_contact_key(const std::string& _aimid)
+{
+    if (_aimid.empty())
+        return ordering_key();
+
+    const auto is_chat = (_aimid.find("@chat.agent") != std::string::npos);
+
+    return ordering_key(is_chat ? ordering_class::chat : ordering_class::contact, _aimid);
+}
+
 int32_t wim_packet::execute()
 {
     auto request = std::make_shared<core::http_request_simple>(params_.proxy_, utils::get_user_agent(params_.aimid_), params_.stop_handler_);
@@ -51,7 +67,7 @@ int32_t wim_packet::execute()
 
     auto response = std::static_pointer_cast<tools::binary_stream>(request->get_response());
     assert(response);
-    err = parse_response(response);
+    err = timed_parse_response(response);
     return err;
 }
 
@@ -86,11 +102,25 @@ void wim_packet::execute_async(handler_t _handler)
 
         auto response = std::static_pointer_cast<tools::binary_stream>(request->get_response());
         assert(response);
-        const auto err = ptr_this->parse_response(response);
+        const auto err = ptr_this->timed_parse_response(response);
         _handler(err);
     });
 }
 
+int32_t wim_packet::timed_parse_response(std::shared_ptr<core::tools::binary_stream> _response)
+{
+    static auto& parse_time = metrics::get_histogram("wim.parse_response");
+    static auto& parse_errors = metrics::get_counter("wim.parse_response.errors");
+
+    metrics::auto_timer timer(parse_time);
+
+    const auto err = parse_response(_response);
+    if (err != 0)
+        parse_errors.add();
+
+    return err;
+}
+
 bool wim_packet::is_stopped() const
 {
     return params_.stop_handler_();
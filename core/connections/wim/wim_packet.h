@@ -220,6 +220,38 @@ namespace core
 
         };
 
+        // packets with the same key are sent one after another, different keys may go in parallel
+        enum class ordering_class
+        {
+            global,
+            contact,
+            chat
+        };
+
+        struct ordering_key
+        {
+            ordering_class class_;
+            std::string id_;
+
+            ordering_key()
+                : class_(ordering_class::global)
+            {
+            }
+
+            ordering_key(ordering_class _class, std::string _id)
+                : class_(_class)
+                , id_(std::move(_id))
+            {
+            }
+
+            static ordering_key make_contact_key(const std::string& _aimid);
+
+            bool operator<(const ordering_key& _other) const
+            {
+                return (class_ != _other.class_) ? (class_ < _other.class_) : (id_ < _other.id_);
+            }
+        };
+
         class wim_packet
             : public async_task
             , public std::enable_shared_from_this<wim_packet>
@@ -229,6 +261,8 @@ namespace core
 
             bool hosts_scheme_changed_;
 
+            int32_t timed_parse_response(std::shared_ptr<core::tools::binary_stream> _response);
+
         public:
             typedef std::function<void (int32_t _result)> handler_t;
 
@@ -266,6 +300,8 @@ namespace core
 
             virtual bool support_async_execution() const;
 
+            virtual ordering_key get_ordering_key() const;
+
             int32_t execute() override final;
             void execute_async(handler_t _handler);
 
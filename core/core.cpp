@@ -33,6 +33,7 @@
 #include "tools/system.h"
 #include "proxy_settings.h"
 #include "tools/strings.h"
+#include "tools/metrics.h"
 
 #ifdef _WIN32
     #include "../common.shared/win32/crash_handler.h"
@@ -65,6 +66,7 @@ core_dispatcher::core_dispatcher()
     , gui_connector_(nullptr)
     , core_factory_(nullptr)
     , delayed_stat_timer_id_(0)
+    , metrics_timer_id_(0)
 {
     http_request_simple::init_global();
 
@@ -217,6 +219,8 @@ void core::core_dispatcher::start(const common::core_gui_settings& _settings)
 #endif
 
     load_statistics();
+
+    start_metrics_snapshots();
 }
 
 
@@ -255,6 +259,9 @@ void core::core_dispatcher::unlink_gui()
 
 void core::core_dispatcher::post_message_to_gui(const char * _message, int64_t _seq, icollection* _message_data)
 {
+    static auto& post_time = metrics::get_histogram("core.post_message_to_gui");
+    metrics::auto_timer timer(post_time);
+
     tools::binary_stream bs;
     bs.write<std::string>("CORE->GUI: message=");
     bs.write<std::string>(_message);
@@ -353,6 +360,35 @@ void core_dispatcher::load_statistics()
     });
 }
 
+void core_dispatcher::start_metrics_snapshots()
+{
+    execute_core_context([this]
+    {
+        const auto period = (build::is_debug() ? std::chrono::minutes(1) : std::chrono::minutes(15));
+        metrics_timer_id_ = add_timer([this]
+        {
+            save_metrics_snapshot();
+        }, period);
+    });
+}
+
+void core_dispatcher::save_metrics_snapshot()
+{
+    const auto file_name = (utils::get_logs_path() / L"metrics.txt").wstring();
+
+    save_async([file_name]
+    {
+        std::stringstream ss;
+        ss << "snapshot time: " << std::time(nullptr) << "\r\n";
+        ss << metrics::dump();
+
+        tools::binary_stream bs;
+        bs.write<std::string>(ss.str());
+
+        return (bs.save_2_file(file_name) ? 0 : -1);
+    });
+}
+
 void core_dispatcher::start_session_stats(bool _delayed)
 {
     core::stats::event_props_type props;
@@ -452,15 +488,34 @@ void core_dispatcher::post_app_config()
 
 void core::core_dispatcher::on_message_update_gui_settings_value(int64_t _seq, coll_helper _params)
 {
-    std::string value_name = _params.get_value_as_string("name");
-    istream* value_data = _params.get_value_as_stream("value");
+    const auto set_value = [this](coll_helper& _value)
+    {
+        std::string value_name = _value.get_value_as_string("name");
+        istream* value_data = _value.get_value_as_stream("value");
 
-    tools::binary_stream bs_data;
-    auto size = value_data->size();
-    if (size)
-        bs_data.write((const char*) value_data->read(size), size);
+        tools::binary_stream bs_data;
+        auto size = value_data->size();
+        if (size)
+            bs_data.write((const char*) value_data->read(size), size);
+
+        gui_settings_->set_value(value_name, bs_data);
+    };
 
-    gui_settings_->set_value(value_name, bs_data);
+    // gui sends the values changed during one event loop pass together,
+    // they are saved with the next save_if_needed
+    if (_params.is_value_exist("values"))
+    {
+        const auto values_array = _params.get_value_as_array("values");
+        for (auto i = 0; i < values_array->size(); ++i)
+        {
+            coll_helper value(values_array->get_at(i)->get_as_collection(), false);
+            set_value(value);
+        }
+
+        return;
+    }
+
+    set_value(_params);
 }
 
 void core::core_dispatcher::on_message_update_theme_settings_value(int64_t _seq, coll_helper _params)
@@ -474,7 +529,6 @@ void core::core_dispatcher::on_message_update_theme_settings_value(int64_t _seq,
         bs_data.write((const char*) value_data->read(size), size);
 
     theme_settings_->set_value(value_name, bs_data);
-    theme_settings_->save_if_needed();
 }
 
 void core::core_dispatcher::on_message_set_default_theme_id(int64_t _seq, coll_helper _params)
@@ -88,6 +88,7 @@ namespace core
         std::atomic_uchar history_search_count_;
 
         uint32_t delayed_stat_timer_id_;
+        uint32_t metrics_timer_id_;
 
         void load_gui_settings();
         void load_hosts_config();
@@ -107,6 +108,9 @@ namespace core
 
         void load_statistics();
 
+        void start_metrics_snapshots();
+        void save_metrics_snapshot();
+
         void post_user_proxy_to_gui();
 
     public:
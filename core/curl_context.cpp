@@ -12,6 +12,7 @@ static size_t write_header_function(void *contents, size_t size, size_t nmemb, v
 static size_t write_memory_callback(void *contents, size_t size, size_t nmemb, void *userp);
 static int32_t progress_callback(void* ptr, double TotalToDownload, double NowDownloaded, double TotalToUpload, double NowUploaded);
 static int32_t trace_function(CURL* _handle, curl_infotype _type, unsigned char* _data, size_t _size, void* _userp);
+static std::string get_url_host(const std::string& _url);
 
 core::curl_context::curl_context(std::shared_ptr<tools::stream> _output, http_request_simple::stop_function _stop_func, http_request_simple::progress_function _progress_func, bool _keep_alive)
     :
@@ -132,8 +133,8 @@ void core::curl_context::write_log_string(const std::string& _log_string)
 void core::curl_context::set_range(int64_t _from, int64_t _to)
 {
     assert(_from >= 0);
-    assert(_to > 0);
-    assert(_from < _to);
+    assert(_to >= 0);
+    assert(_from <= _to);
 
     std::stringstream ss_range;
     ss_range << _from << '-' << _to;
@@ -145,6 +146,8 @@ void core::curl_context::set_url(const char* sz_url)
 {
     curl_easy_setopt(curl_, CURLOPT_URL, sz_url);
 
+    host_ = get_url_host(sz_url);
+
     curl_easy_setopt(curl_, CURLOPT_FOLLOWLOCATION, 1L);
     curl_easy_setopt(curl_, CURLOPT_MAXREDIRS, 10L);
 
@@ -220,7 +223,7 @@ bool core::curl_context::execute_request()
 {
     const auto start = std::chrono::steady_clock().now();
 
-    auto handler = curl_handler::instance().perform(priority_, timeout_, curl_);
+    auto handler = curl_handler::instance().perform(priority_, timeout_, curl_, host_);
     assert(handler.valid());
 
     handler.wait();
@@ -236,7 +239,7 @@ void core::curl_context::execute_request_async(http_request_simple::completion_f
 {
     const auto start = std::chrono::steady_clock().now();
 
-    curl_handler::instance().perform_async(priority_, timeout_, curl_,
+    curl_handler::instance().perform_async(priority_, timeout_, curl_, host_,
         [start, _completion_function, this](bool _success)
         {
             write_log_message(_success ? "success" : "failed", start);
@@ -288,6 +291,16 @@ void core::curl_context::set_priority(priority_t _priority)
     priority_ = _priority;
 }
 
+static std::string get_url_host(const std::string& _url)
+{
+    const auto scheme_end = _url.find("://");
+    const auto begin = (scheme_end == std::string::npos ? 0 : scheme_end + 3);
+
+    const auto end = _url.find_first_of(":/?#", begin);
+
+    return _url.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+}
+
 static size_t write_header_function(void *contents, size_t size, size_t nmemb, void *userp)
 {
     size_t realsize = size * nmemb;
@@ -33,6 +33,8 @@ namespace core
 
         milliseconds_t timeout_;
 
+        std::string host_;
+
         curl_context(std::shared_ptr<tools::stream> _output, http_request_simple::stop_function _stop_func, http_request_simple::progress_function _progress_func, bool _keep_alive);
         ~curl_context();
 
@@ -5,14 +5,37 @@
 #include "core.h"
 #include "curl_context.h"
 #include "network_log.h"
+#include "tools/metrics.h"
 
 #include "curl_handler.h"
 
 namespace
 {
-    const int MAX_NORMAL_TRANSMISSIONS = 4;
-    const int MAX_HIGH_TRANSMISSIONS = 6;
-    const int MAX_HIGHEST_TRANSMISSIONS = 8;
+    const size_t MAX_FREE_HANDLES = 16;
+
+    std::chrono::steady_clock::duration seconds_to_duration(double _seconds)
+    {
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(_seconds));
+    }
+
+    // the errors which tell that the network can't take more transfers
+    bool is_network_error(CURLcode _result)
+    {
+        switch (_result)
+        {
+        case CURLE_COULDNT_RESOLVE_HOST:
+        case CURLE_COULDNT_CONNECT:
+        case CURLE_OPERATION_TIMEDOUT:
+        case CURLE_SSL_CONNECT_ERROR:
+        case CURLE_SEND_ERROR:
+        case CURLE_RECV_ERROR:
+        case CURLE_GOT_NOTHING:
+        case CURLE_PARTIAL_FILE:
+            return true;
+        default:
+            return false;
+        }
+    }
 }
 
 namespace core
@@ -27,6 +50,14 @@ namespace core
 
     void finish_job(curl_handler* _curl_handler, CURL* handle, CURLcode _result)
     {
+        static auto& queue_wait = metrics::get_histogram("curl.queue_wait");
+        static auto& request_time = metrics::get_histogram("curl.request");
+        static auto& failed_requests = metrics::get_counter("curl.failed");
+        static auto& reused_connections = metrics::get_counter("curl.connection.reused");
+        static auto& new_connections = metrics::get_counter("curl.connection.new");
+        static auto& dns_lookup_time = metrics::get_histogram("curl.connection.dns_lookup");
+        static auto& tls_handshake_time = metrics::get_histogram("curl.connection.tls_handshake");
+
         auto it = _curl_handler->connections_.find(handle);
         assert(it != _curl_handler->connections_.end());
 
@@ -34,6 +65,58 @@ namespace core
         {
             auto connection = it->second.get();
 
+            queue_wait.record(connection->started_ - connection->queued_);
+            request_time.record(std::chrono::steady_clock::now() - connection->started_);
+
+            if (_result != CURLE_OK)
+                failed_requests.add();
+
+            long connects = 0;
+            if (_result == CURLE_OK && curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &connects) == CURLE_OK)
+            {
+                if (connects == 0)
+                {
+                    reused_connections.add();
+                }
+                else
+                {
+                    new_connections.add();
+
+                    double name_lookup = 0;
+                    double connect = 0;
+                    double app_connect = 0;
+                    curl_easy_getinfo(handle, CURLINFO_NAMELOOKUP_TIME, &name_lookup);
+                    curl_easy_getinfo(handle, CURLINFO_CONNECT_TIME, &connect);
+                    curl_easy_getinfo(handle, CURLINFO_APPCONNECT_TIME, &app_connect);
+
+                    dns_lookup_time.record(seconds_to_duration(name_lookup));
+
+                    // a resumed tls session makes the handshake one round trip shorter
+                    if (app_connect > connect)
+                        tls_handshake_time.record(seconds_to_duration(app_connect - connect));
+                }
+            }
+
+            // the server time, the time to the first byte without dns, connect and tls of a new connection;
+            // a transfer aborted or failed before the response has none
+            double first_byte = 0;
+            double pre_transfer = 0;
+            if (_result != CURLE_OK ||
+                curl_easy_getinfo(handle, CURLINFO_STARTTRANSFER_TIME, &first_byte) != CURLE_OK ||
+                curl_easy_getinfo(handle, CURLINFO_PRETRANSFER_TIME, &pre_transfer) != CURLE_OK ||
+                first_byte <= pre_transfer)
+            {
+                first_byte = 0;
+                pre_transfer = 0;
+            }
+
+            {
+                boost::lock_guard<boost::mutex> lock(_curl_handler->jobs_mutex_);
+
+                _curl_handler->scheduler_.finish(connection->job_id_, is_network_error(_result), seconds_to_duration(first_byte - pre_transfer));
+                _curl_handler->publish_statistics();
+            }
+
             boost::apply_visitor(curl_handler::completion_visitor(_result), connection->completion_handler_);
 
             _curl_handler->connections_.erase(it);
@@ -184,32 +267,23 @@ namespace core
         {
             boost::lock_guard<boost::mutex> lock(handler->jobs_mutex_);
 
-            auto transmissions = handler->connections_.size();
-
-            while (!handler->pending_jobs_.empty())
+            curl_scheduler::job_id id = 0;
+            while (handler->scheduler_.pop(id))
             {
-                const auto& job = handler->pending_jobs_.top();
-
-                if (job.priority_ >= highest_priority && transmissions > MAX_HIGHEST_TRANSMISSIONS)
-                    break;
-
-                if (job.priority_ >= high_priority && transmissions > MAX_HIGH_TRANSMISSIONS)
-                    break;
-
-                if (job.priority_ >= default_priority && transmissions > MAX_NORMAL_TRANSMISSIONS)
-                    break;
-
-                ++transmissions;
+                const auto it = handler->pending_jobs_.find(id);
+                assert(it != handler->pending_jobs_.end());
 
-                const auto completion_handler = job.completion_;
-                const auto timeout = job.timeout_;
-                const auto easy_handle = job.handle_;
+                const auto& job = it->second;
 
-                auto connection = std::make_unique<curl_handler::connection_context>(timeout, handler, easy_handle, completion_handler);
+                auto connection = std::make_unique<curl_handler::connection_context>(job.timeout_, handler, job.handle_, job.completion_);
+                connection->queued_ = job.queued_;
+                connection->job_id_ = id;
                 to_process.push_back(std::move(connection));
 
-                handler->pending_jobs_.pop();
+                handler->pending_jobs_.erase(it);
             }
+
+            handler->publish_statistics();
         }
 
         for (auto&& connection : to_process)
@@ -226,6 +300,20 @@ namespace core
             }
         }
     }
+
+    void share_lock_callback(CURL* /*_handle*/, curl_lock_data _data, curl_lock_access /*_access*/, void* _curl_handler_ptr)
+    {
+        const auto handler = static_cast<curl_handler*>(_curl_handler_ptr);
+
+        handler->share_mutexes_[_data].lock();
+    }
+
+    void share_unlock_callback(CURL* /*_handle*/, curl_lock_data _data, void* _curl_handler_ptr)
+    {
+        const auto handler = static_cast<curl_handler*>(_curl_handler_ptr);
+
+        handler->share_mutexes_[_data].unlock();
+    }
 }
 
 timeval core::curl_handler::make_timeval(milliseconds_t _timeout)
@@ -246,6 +334,8 @@ core::curl_handler& core::curl_handler::instance()
 }
 
 core::curl_handler::curl_handler()
+    : share_handle_(nullptr)
+    , last_job_id_(0)
 {
 #ifdef _WIN32
     evthread_use_windows_threads();
@@ -261,12 +351,32 @@ void core::curl_handler::init()
 #else
     curl_global_init(CURL_GLOBAL_SSL);
 #endif
+
+    share_handle_ = curl_share_init();
+
+    curl_share_setopt(share_handle_, CURLSHOPT_LOCKFUNC, share_lock_callback);
+    curl_share_setopt(share_handle_, CURLSHOPT_UNLOCKFUNC, share_unlock_callback);
+    curl_share_setopt(share_handle_, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(share_handle_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_handle_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
 }
 
 void core::curl_handler::cleanup()
 {
     curl_multi_cleanup(multi_handle_);
 
+    {
+        boost::lock_guard<boost::mutex> lock(handles_mutex_);
+
+        for (auto handle : free_handles_)
+            curl_easy_cleanup(handle);
+
+        free_handles_.clear();
+    }
+
+    curl_share_cleanup(share_handle_);
+
     curl_global_cleanup();
 }
 
@@ -312,25 +422,67 @@ void core::curl_handler::stop()
 
     connections_.clear();
 
-    while (!pending_jobs_.empty())
-    {
-        auto& job = pending_jobs_.top();
-        boost::apply_visitor(completion_visitor(CURLE_ABORTED_BY_CALLBACK), job.completion_);
-        pending_jobs_.pop();
-    }
+    for (auto& it : pending_jobs_)
+        boost::apply_visitor(completion_visitor(CURLE_ABORTED_BY_CALLBACK), it.second.completion_);
+
+    pending_jobs_.clear();
+
+    scheduler_.clear();
 }
 
 CURL* core::curl_handler::get_handle()
 {
-    return curl_easy_init();
+    static auto& pool_hits = metrics::get_counter("curl.handle_pool.hit");
+    static auto& pool_misses = metrics::get_counter("curl.handle_pool.miss");
+
+    {
+        boost::lock_guard<boost::mutex> lock(handles_mutex_);
+
+        if (!free_handles_.empty())
+        {
+            const auto handle = free_handles_.back();
+            free_handles_.pop_back();
+
+            pool_hits.add();
+
+            return handle;
+        }
+    }
+
+    pool_misses.add();
+
+    const auto handle = curl_easy_init();
+    if (handle)
+        curl_easy_setopt(handle, CURLOPT_SHARE, share_handle_);
+
+    return handle;
 }
 
 void core::curl_handler::release_handle(CURL* _handle)
 {
+    if (!_handle)
+        return;
+
+    // the cookies of one request must not be sent with the next one
+    curl_easy_setopt(_handle, CURLOPT_COOKIELIST, "ALL");
+
+    curl_easy_reset(_handle);
+    curl_easy_setopt(_handle, CURLOPT_SHARE, share_handle_);
+
+    {
+        boost::lock_guard<boost::mutex> lock(handles_mutex_);
+
+        if (free_handles_.size() < MAX_FREE_HANDLES)
+        {
+            free_handles_.push_back(_handle);
+            return;
+        }
+    }
+
     curl_easy_cleanup(_handle);
 }
 
-core::curl_handler::future_t core::curl_handler::perform(priority_t _priority, milliseconds_t _timeout, CURL* _handle)
+core::curl_handler::future_t core::curl_handler::perform(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const std::string& _host)
 {
     auto promise = promise_t();
     auto future = promise.get_future();
@@ -338,7 +490,7 @@ core::curl_handler::future_t core::curl_handler::perform(priority_t _priority, m
     if (keep_working_)
     {
         auto completion_handler = completion_handler_t(promise_wrapper(std::move(promise)));
-        add_task(_priority, _timeout, _handle, completion_handler);
+        add_task(_priority, _timeout, _handle, _host, completion_handler);
     }
     else
     {
@@ -348,12 +500,12 @@ core::curl_handler::future_t core::curl_handler::perform(priority_t _priority, m
     return future;
 }
 
-void core::curl_handler::perform_async(priority_t _priority, milliseconds_t _timeout, CURL* _handle, completion_callback_t _completion_callback)
+void core::curl_handler::perform_async(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const std::string& _host, completion_callback_t _completion_callback)
 {
     if (keep_working_)
     {
         auto completion_handler = completion_handler_t(_completion_callback);
-        add_task(_priority, _timeout, _handle, completion_handler);
+        add_task(_priority, _timeout, _handle, _host, completion_handler);
     }
     else
     {
@@ -361,19 +513,46 @@ void core::curl_handler::perform_async(priority_t _priority, milliseconds_t _tim
     }
 }
 
-void core::curl_handler::add_task(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const completion_handler_t& _completion_handler)
+void core::curl_handler::add_task(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const std::string& _host, const completion_handler_t& _completion_handler)
 {
     {
         boost::lock_guard<boost::mutex> lock(jobs_mutex_);
 
-        pending_jobs_.emplace(_priority, _timeout, _handle, _completion_handler);
+        const auto id = ++last_job_id_;
+
+        pending_jobs_.emplace(id, job(_timeout, _handle, _completion_handler));
+        scheduler_.push(id, _priority, _host);
     }
 
     event_active(start_task_event_, 0, 0);
 }
 
+void core::curl_handler::publish_statistics() const
+{
+    static auto& capacity = metrics::get_counter("curl.scheduler.capacity");
+    static auto& in_flight = metrics::get_counter("curl.scheduler.in_flight");
+    static auto& pending = metrics::get_counter("curl.scheduler.pending");
+    static auto& latency = metrics::get_counter("curl.scheduler.latency_ms");
+    static auto& min_latency = metrics::get_counter("curl.scheduler.min_latency_ms");
+    static auto& increases = metrics::get_counter("curl.scheduler.increases");
+    static auto& decreases = metrics::get_counter("curl.scheduler.decreases");
+
+    const auto stats = scheduler_.get_statistics();
+
+    capacity.set(std::lround(stats.capacity_));
+    in_flight.set(stats.in_flight_);
+    pending.set(stats.pending_);
+    latency.set(std::chrono::duration_cast<std::chrono::milliseconds>(stats.latency_).count());
+    min_latency.set(std::chrono::duration_cast<std::chrono::milliseconds>(stats.min_latency_).count());
+    increases.set(stats.increases_);
+    decreases.set(stats.decreases_);
+}
+
 core::curl_handler::connection_context::connection_context(milliseconds_t _timeout, curl_handler* _curl_handler, CURL* _easy_handle, const completion_handler_t& _completion_handler)
-    : timeout_(_timeout)
+    : queued_(std::chrono::steady_clock::now())
+    , started_(queued_)
+    , job_id_(0)
+    , timeout_(_timeout)
     , curl_handler_(_curl_handler)
     , easy_handle_(_easy_handle)
     , completion_handler_(_completion_handler)
@@ -454,15 +633,10 @@ void core::curl_handler::promise_wrapper::set_value(CURLcode _result)
     promise_.set_value(_result);
 }
 
-core::curl_handler::job::job(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const completion_handler_t& _completion)
-    : priority_(_priority)
-    , timeout_(_timeout)
+core::curl_handler::job::job(milliseconds_t _timeout, CURL* _handle, const completion_handler_t& _completion)
+    : timeout_(_timeout)
     , handle_(_handle)
     , completion_(_completion)
+    , queued_(std::chrono::steady_clock::now())
 {
 }
-
-bool core::curl_handler::job_priority_comparer::operator()(const job& _left, const job& _right)
-{
-    return _left.priority_ > _right.priority_;
-}
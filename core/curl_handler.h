@@ -6,6 +6,8 @@
 
 #include <event2/event.h>
 
+#include "curl_scheduler.h"
+
 namespace core
 {
     class curl_handler;
@@ -20,6 +22,8 @@ namespace core
     void event_timer_callback(evutil_socket_t _descriptor, short _flags, void* _curl_handler_ptr);
     void event_timeout_callback(evutil_socket_t _descriptor, short _flags, void* _connection_ptr);
     void start_task_callback(evutil_socket_t _descriptor, short _flags, void* _curl_handler_ptr);
+    void share_lock_callback(CURL* _handle, curl_lock_data _data, curl_lock_access _access, void* _curl_handler_ptr);
+    void share_unlock_callback(CURL* _handle, curl_lock_data _data, void* _curl_handler_ptr);
 
     class curl_handler final
     {
@@ -33,6 +37,8 @@ namespace core
         friend void event_timer_callback(evutil_socket_t _descriptor, short _flags, void* _curl_handler_ptr);
         friend void event_timeout_callback(evutil_socket_t _descriptor, short _flags, void* _connection_ptr);
         friend void start_task_callback(evutil_socket_t _descriptor, short _flags, void* _curl_handler_ptr);
+        friend void share_lock_callback(CURL* _handle, curl_lock_data _data, curl_lock_access _access, void* _curl_handler_ptr);
+        friend void share_unlock_callback(CURL* _handle, curl_lock_data _data, void* _curl_handler_ptr);
     public:
         static curl_handler& instance();
 
@@ -42,14 +48,16 @@ namespace core
         void start();
         void stop(); // cancel all transfers
 
+        // a released handle is reset and given out again, so it keeps its tls session and dns entries
         CURL* get_handle();
         void release_handle(CURL* _handle);
 
+        // _host is where the transfer goes, the hosts share the transfers fairly
         typedef std::future<CURLcode> future_t;
-        future_t perform(priority_t _priority, milliseconds_t _timeout, CURL* _handle);
+        future_t perform(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const std::string& _host);
 
         typedef std::function<void (bool _success)> completion_callback_t;
-        void perform_async(priority_t _priority, milliseconds_t _timeout, CURL* _handle, completion_callback_t _completion_callback);
+        void perform_async(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const std::string& _host, completion_callback_t _completion_callback);
 
     private:
         static timeval make_timeval(milliseconds_t _timeout);
@@ -73,7 +81,9 @@ namespace core
 
         typedef boost::variant<promise_wrapper, completion_callback_t> completion_handler_t;
 
-        void add_task(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const completion_handler_t& _completion_handler);
+        void add_task(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const std::string& _host, const completion_handler_t& _completion_handler);
+
+        void publish_statistics() const;
 
         struct connection_context
         {
@@ -84,6 +94,11 @@ namespace core
 
             void free_event();
 
+            std::chrono::steady_clock::time_point queued_;
+            std::chrono::steady_clock::time_point started_;
+
+            curl_scheduler::job_id job_id_;
+
             milliseconds_t timeout_;
             event* timeout_event_;
 
@@ -101,6 +116,14 @@ namespace core
         CURLM* multi_handle_;
         int running_;
 
+        // the dns cache and tls sessions are shared by all the handles,
+        // the connections are shared by the multi handle they are performed with
+        CURLSH* share_handle_;
+        std::array<boost::mutex, CURL_LOCK_DATA_LAST> share_mutexes_;
+
+        std::vector<CURL*> free_handles_;
+        boost::mutex handles_mutex_;
+
         event_base* event_base_;
         event* timer_event_;
         event* start_task_event_;
@@ -111,21 +134,19 @@ namespace core
 
         struct job
         {
-            job(priority_t _priority, milliseconds_t _timeout, CURL* _handle, const completion_handler_t& _completion);
+            job(milliseconds_t _timeout, CURL* _handle, const completion_handler_t& _completion);
 
-            priority_t priority_; // the lower number is the higher priority
             milliseconds_t timeout_;
             CURL* handle_;
             completion_handler_t completion_;
+            std::chrono::steady_clock::time_point queued_;
         };
 
-        struct job_priority_comparer
-            : public std::unary_function<bool, const job&>
-        {
-            bool operator()(const job& _left, const job& _right);
-        };
+        // the queued jobs, the scheduler decides when they start
+        std::unordered_map<curl_scheduler::job_id, job> pending_jobs_;
+        curl_scheduler::job_id last_job_id_;
 
-        std::priority_queue<job, std::vector<job>, job_priority_comparer> pending_jobs_;
+        curl_scheduler scheduler_;
         boost::mutex jobs_mutex_;
 
         std::atomic<bool> keep_working_;
@@ -0,0 +1,246 @@
+#include "stdafx.h"
+
+#include "curl_scheduler.h"
+
+namespace
+{
+    // the limits of 8, 6 and 4 transfers, as they were fixed before
+    const double initial_capacity = 8;
+    const double min_capacity = 4;
+    const double max_capacity = 32;
+
+    const double decrease_factor = 0.75;
+
+    // the minimum is forgotten after so many samples, so it follows a changed network
+    const int32_t latency_window = 100;
+
+    const int32_t min_host_limit = 2;
+}
+
+core::curl_scheduler::statistics::statistics()
+    : capacity_(0)
+    , in_flight_(0)
+    , pending_(0)
+    , min_latency_(0)
+    , latency_(0)
+    , increases_(0)
+    , decreases_(0)
+{
+}
+
+core::curl_scheduler::curl_scheduler()
+    : pending_count_(0)
+    , counter_(0)
+    , capacity_(initial_capacity)
+    , last_decrease_(0)
+    , increases_(0)
+    , decreases_(0)
+{
+}
+
+void core::curl_scheduler::push(job_id _id, priority_t _priority, const std::string& _host)
+{
+    hosts_[_host].pending_.push(pending_job{ _id, _priority, ++counter_ });
+
+    ++pending_count_;
+}
+
+bool core::curl_scheduler::pop(job_id& _id)
+{
+    const auto host_limit = get_host_limit();
+
+    auto best = hosts_.end();
+    auto best_band = band::normal;
+
+    for (auto it = hosts_.begin(); it != hosts_.end(); ++it)
+    {
+        const auto& host = it->second;
+        if (host.pending_.empty())
+            continue;
+
+        const auto job_band = get_band(host.pending_.top().priority_);
+        if (job_band != band::top && host.in_flight_ >= host_limit)
+            continue;
+
+        if (best == hosts_.end() || job_band < best_band || (job_band == best_band && host.last_started_ < best->second.last_started_))
+        {
+            best = it;
+            best_band = job_band;
+        }
+    }
+
+    if (best == hosts_.end())
+        return false;
+
+    // the limits of the lower bands are not higher, so nothing else can start either
+    const auto limit = get_limit(best->second.pending_.top().priority_);
+    if (limit != -1 && static_cast<int32_t>(running_.size()) >= limit)
+        return false;
+
+    auto& host = best->second;
+
+    _id = host.pending_.top().id_;
+    host.pending_.pop();
+
+    --pending_count_;
+
+    ++host.in_flight_;
+    host.last_started_ = ++counter_;
+
+    running_[_id] = running_job{ best->first, best_band, counter_ };
+
+    return true;
+}
+
+void core::curl_scheduler::finish(job_id _id, bool _network_error, std::chrono::steady_clock::duration _latency)
+{
+    const auto it = running_.find(_id);
+    if (it == running_.end())
+        return;
+
+    const auto job = std::move(it->second);
+    running_.erase(it);
+
+    const auto host = hosts_.find(job.host_);
+    assert(host != hosts_.end());
+
+    if (--host->second.in_flight_ == 0 && host->second.pending_.empty())
+        hosts_.erase(host);
+
+    // the long-poll waits for events, its latency says nothing about the network
+    if (job.band_ == band::top)
+        return;
+
+    if (_network_error)
+    {
+        decrease(job.started_, min_capacity);
+        return;
+    }
+
+    // cancelled or failed before the response, the latency is unknown
+    if (_latency <= std::chrono::steady_clock::duration::zero())
+        return;
+
+    latency_.add(_latency);
+
+    auto& host_latency = latencies_[job.host_];
+    host_latency.add(_latency);
+
+    if (host_latency.average_ > host_latency.min_ * 2)
+    {
+        decrease(job.started_, initial_capacity);
+    }
+    else if (pending_count_ > 0 && host_latency.average_ * 2 < host_latency.min_ * 3 && capacity_ < max_capacity)
+    {
+        // one more transfer after each capacity of the successful ones
+        capacity_ = std::min(max_capacity, capacity_ + 1 / capacity_);
+        ++increases_;
+    }
+}
+
+void core::curl_scheduler::clear()
+{
+    hosts_.clear();
+    running_.clear();
+
+    pending_count_ = 0;
+}
+
+int32_t core::curl_scheduler::get_limit(priority_t _priority) const
+{
+    switch (get_band(_priority))
+    {
+    case band::top:
+        return -1;
+    case band::highest:
+        return static_cast<int32_t>(std::lround(capacity_));
+    case band::high:
+        return static_cast<int32_t>(std::lround(capacity_ * 3 / 4));
+    default:
+        return static_cast<int32_t>(std::lround(capacity_ / 2));
+    }
+}
+
+int32_t core::curl_scheduler::get_host_limit() const
+{
+    return std::max(min_host_limit, static_cast<int32_t>(std::lround(capacity_ * 3 / 4)));
+}
+
+core::curl_scheduler::statistics core::curl_scheduler::get_statistics() const
+{
+    statistics result;
+
+    result.capacity_ = capacity_;
+    result.in_flight_ = static_cast<int64_t>(running_.size());
+    result.pending_ = static_cast<int64_t>(pending_count_);
+    result.min_latency_ = latency_.min_;
+    result.latency_ = latency_.average_;
+    result.increases_ = increases_;
+    result.decreases_ = decreases_;
+
+    return result;
+}
+
+core::curl_scheduler::band core::curl_scheduler::get_band(priority_t _priority)
+{
+    if (_priority < highest_priority)
+        return band::top;
+
+    if (_priority < high_priority)
+        return band::highest;
+
+    if (_priority < default_priority)
+        return band::high;
+
+    return band::normal;
+}
+
+void core::curl_scheduler::decrease(uint64_t _started, double _min_capacity)
+{
+    if (_started <= last_decrease_ || capacity_ <= _min_capacity)
+        return;
+
+    capacity_ = std::max(_min_capacity, capacity_ * decrease_factor);
+    last_decrease_ = counter_;
+
+    ++decreases_;
+}
+
+bool core::curl_scheduler::pending_job_comparer::operator()(const pending_job& _left, const pending_job& _right) const
+{
+    if (_left.priority_ != _right.priority_)
+        return _left.priority_ > _right.priority_;
+
+    return _left.queued_ > _right.queued_;
+}
+
+core::curl_scheduler::latency_state::latency_state()
+    : min_(0)
+    , window_min_(0)
+    , window_samples_(0)
+    , average_(0)
+{
+}
+
+void core::curl_scheduler::latency_state::add(std::chrono::steady_clock::duration _latency)
+{
+    if (window_samples_ == 0 || _latency < window_min_)
+        window_min_ = _latency;
+
+    if (++window_samples_ >= latency_window)
+    {
+        min_ = window_min_;
+        window_samples_ = 0;
+    }
+
+    if (min_.count() == 0 || _latency < min_)
+        min_ = _latency;
+
+    average_ = (average_.count() == 0 ? _latency : (average_ * 7 + _latency) / 8);
+}
+
+core::curl_scheduler::host_state::host_state()
+    : in_flight_(0)
+    , last_started_(0)
+{
+}
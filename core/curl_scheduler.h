@@ -0,0 +1,137 @@
+#pragma once
+
+namespace core
+{
+    // decides which of the queued transfers can start
+    //
+    // the transfers above highest_priority (the long-poll fetch, sending messages) always start,
+    // the rest get a limit on all the transfers in flight which is lower for the lower priorities,
+    // so a burst of previews leaves room for the more important requests;
+    // the limits follow one capacity which grows while there are transfers waiting
+    // and the server time of the hosts (from the request sent to the first byte) stays close to their minimums,
+    // and drops by a quarter on network errors or when the latency grows;
+    // the latency alone doesn't drop it below the initial capacity, which gives the former fixed limits;
+    // one host can't take more than 3/4 of the capacity and the hosts with the same band take turns
+    class curl_scheduler
+    {
+    public:
+        typedef uint64_t job_id;
+
+        struct statistics
+        {
+            statistics();
+
+            double capacity_;
+
+            int64_t in_flight_;
+            int64_t pending_;
+
+            std::chrono::steady_clock::duration min_latency_;
+            std::chrono::steady_clock::duration latency_;
+
+            int64_t increases_;
+            int64_t decreases_;
+        };
+
+        curl_scheduler();
+
+        void push(job_id _id, priority_t _priority, const std::string& _host);
+
+        // false if nothing can start until some transfer is finished
+        bool pop(job_id& _id);
+
+        // _latency is the time from the request sent to the first byte of the response, without dns, connect and tls,
+        // zero if no response came, such a transfer changes the capacity only on a network error
+        void finish(job_id _id, bool _network_error, std::chrono::steady_clock::duration _latency);
+
+        void clear();
+
+        // -1 if not limited
+        int32_t get_limit(priority_t _priority) const;
+        int32_t get_host_limit() const;
+
+        statistics get_statistics() const;
+
+    private:
+        enum class band
+        {
+            top,
+            highest,
+            high,
+            normal
+        };
+
+        static band get_band(priority_t _priority);
+
+        void decrease(uint64_t _started, double _min_capacity);
+
+        struct pending_job
+        {
+            job_id id_;
+            priority_t priority_;
+            uint64_t queued_;
+        };
+
+        struct pending_job_comparer
+        {
+            bool operator()(const pending_job& _left, const pending_job& _right) const;
+        };
+
+        typedef std::priority_queue<pending_job, std::vector<pending_job>, pending_job_comparer> job_queue;
+
+        struct host_state
+        {
+            host_state();
+
+            job_queue pending_;
+
+            int32_t in_flight_;
+
+            uint64_t last_started_;
+        };
+
+        std::map<std::string, host_state> hosts_;
+
+        struct running_job
+        {
+            std::string host_;
+            band band_;
+            uint64_t started_;
+        };
+
+        std::unordered_map<job_id, running_job> running_;
+
+        // the minimum is kept over a window of samples, so it follows a changed network
+        struct latency_state
+        {
+            latency_state();
+
+            void add(std::chrono::steady_clock::duration _latency);
+
+            std::chrono::steady_clock::duration min_;
+            std::chrono::steady_clock::duration window_min_;
+            int32_t window_samples_;
+
+            std::chrono::steady_clock::duration average_;
+        };
+
+        // the hosts differ a lot in their server time, each one is compared with its own minimum
+        std::map<std::string, latency_state> latencies_;
+
+        // of all the hosts, only for the statistics
+        latency_state latency_;
+
+        size_t pending_count_;
+
+        // numbers the pushes and the pops
+        uint64_t counter_;
+
+        double capacity_;
+
+        // the transfers started before the last decrease don't decrease the capacity again
+        uint64_t last_decrease_;
+
+        int64_t increases_;
+        int64_t decreases_;
+    };
+}
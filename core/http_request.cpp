@@ -207,7 +207,7 @@ bool http_request_simple::send_request(bool _post, double& _request_time)
     if (is_time_condition_)
         ctx.set_modified_time(last_modified_time_);
 
-    if (range_from_ >= 0 && range_to_ > 0)
+    if (range_from_ >= 0 && range_to_ >= 0)
         ctx.set_range(range_from_, range_to_);
 
     ctx.set_need_log(need_log_);
@@ -247,7 +247,7 @@ void* http_request_simple::send_request_async(bool _post, completion_function _c
     if (is_time_condition_)
         ctx->set_modified_time(last_modified_time_);
 
-    if (range_from_ >= 0 && range_to_ > 0)
+    if (range_from_ >= 0 && range_to_ >= 0)
         ctx->set_range(range_from_, range_to_);
 
     ctx->set_need_log(need_log_);
@@ -27,8 +27,57 @@ enum statistics_info_types
     last_sent_time = 7,
     event_time = 8,
     event_id = 9,
+    event_count = 10,
 };
 
+namespace
+{
+    // the file is a signature followed by {size, tlvpack} records: a snapshot of all events
+    // and then the counts appended by the later saves, it is rewritten when it grows too much
+    const uint32_t segments_signature = 0x47535453;
+    const uint32_t segments_version = 1;
+
+    const size_t max_stored_events = 4096;
+    const size_t compact_ratio = 4;
+
+    void append_record(const tools::tlvpack& _record, tools::binary_stream& _bs)
+    {
+        tools::binary_stream bs_record;
+        _record.serialize(bs_record);
+
+        const uint32_t size = bs_record.available();
+        _bs.write(size);
+        _bs.write(bs_record.read(size), size);
+    }
+
+    tools::tlvpack make_event_record(stats_event_names _name, std::chrono::system_clock::time_point _time, int32_t _id, const event_props_type& _props, int32_t _count)
+    {
+        tools::tlvpack value_tlv;
+        value_tlv.push_child(tools::tlv(statistics_info_types::event_name, _name));
+        value_tlv.push_child(tools::tlv(statistics_info_types::event_time, (int64_t)std::chrono::system_clock::to_time_t(_time)));
+        value_tlv.push_child(tools::tlv(statistics_info_types::event_id, (int64_t)_id));
+        value_tlv.push_child(tools::tlv(statistics_info_types::event_count, _count));
+
+        tools::tlvpack props_pack;
+        int32_t prop_counter = 0;
+
+        for (const auto& prop : _props)
+        {
+            tools::tlvpack value_tlv_prop;
+            value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_name, prop.first));
+            value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_value, prop.second));
+
+            tools::binary_stream bs_value;
+            value_tlv_prop.serialize(bs_value);
+            props_pack.push_child(tools::tlv(++prop_counter, bs_value));
+        }
+
+        value_tlv.push_child(tools::tlv(statistics_info_types::event_props, props_pack));
+
+        return value_tlv;
+    }
+}
+
 long long statistics::stats_event::session_event_id_ = 0;
 std::shared_ptr<statistics::stop_objects> statistics::stop_objects_;
 
@@ -36,6 +85,8 @@ statistics::statistics(const std::wstring& _file_name)
     : file_name_(_file_name)
     , changed_(false)
     , stats_thread_(std::make_unique<async_executer>())
+    , need_compact_(true)
+    , records_in_file_(0)
     , last_sent_time_(std::chrono::system_clock::now())
 {
     stop_objects_ = std::make_shared<stop_objects>();
@@ -115,55 +166,53 @@ bool statistics::load()
     if (!bstream.load_from_file(file_name_))
         return false;
 
-    return unserialize(bstream);
+    auto result = false;
+
+    if (bstream.available() >= 2 * sizeof(uint32_t) && bstream.read<uint32_t>() == segments_signature && bstream.read<uint32_t>() == segments_version)
+    {
+        need_compact_ = false;
+        result = unserialize_segments(bstream);
+    }
+    else
+    {
+        // written as a single tlvpack by the previous versions
+        bstream.reset_out();
+        result = unserialize(bstream);
+    }
+
+    // what was read is in the file already
+    pending_counts_.clear();
+    changed_ = need_compact_;
+
+    return result;
 }
 
 void statistics::serialize(tools::binary_stream& _bs) const
 {
-    tools::tlvpack pack;
-    int32_t counter = 0;
+    _bs.write(segments_signature);
+    _bs.write(segments_version);
 
     // push stats info
     {
         tools::tlvpack value_tlv;
         value_tlv.push_child(tools::tlv(statistics_info_types::last_sent_time, (int64_t)std::chrono::system_clock::to_time_t(last_sent_time_)));
 
-        tools::binary_stream bs_value;
-        value_tlv.serialize(bs_value);
-        pack.push_child(tools::tlv(++counter, bs_value));
+        append_record(value_tlv, _bs);
     }
 
-    for (auto stat_event = events_.begin(); stat_event != events_.end(); ++stat_event)
-    {
-        tools::tlvpack value_tlv;
-        // TODO : push id, time, ..
-        value_tlv.push_child(tools::tlv(statistics_info_types::event_name, stat_event->get_name()));
-        value_tlv.push_child(tools::tlv(statistics_info_types::event_time, (int64_t)std::chrono::system_clock::to_time_t(stat_event->get_time())));
-        value_tlv.push_child(tools::tlv(statistics_info_types::event_id, (int64_t)stat_event->get_id()));
-
-        tools::tlvpack props_pack;
-        int32_t prop_counter = 0;
-        auto props = stat_event->get_props();
-
-        for (auto prop : props)
-        {
-            tools::tlvpack value_tlv_prop;
-            value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_name, prop.first));
-            value_tlv_prop.push_child(tools::tlv(statistics_info_types::event_prop_value, prop.second));
-
-            tools::binary_stream bs_value;
-            value_tlv_prop.serialize(bs_value);
-            props_pack.push_child(tools::tlv(++prop_counter, bs_value));
-        }
-
-        value_tlv.push_child(tools::tlv(statistics_info_types::event_props, props_pack));
+    for (const auto& stat_event : events_)
+        append_record(make_event_record(stat_event.get_name(), stat_event.get_time(), stat_event.get_id(), stat_event.get_props(), stat_event.get_count()), _bs);
+}
 
-        tools::binary_stream bs_value;
-        value_tlv.serialize(bs_value);
-        pack.push_child(tools::tlv(++counter, bs_value));
+size_t statistics::serialize_pending(tools::binary_stream& _bs) const
+{
+    for (const auto& pending : pending_counts_)
+    {
+        const auto& stat_event = events_[pending.first];
+        append_record(make_event_record(stat_event.get_name(), stat_event.get_time(), stat_event.get_id(), stat_event.get_props(), pending.second), _bs);
     }
 
-    pack.serialize(_bs);
+    return pending_counts_.size();
 }
 
 bool unserialize_props(tools::tlvpack& prop_pack, event_props_type* props)
@@ -231,39 +280,98 @@ bool statistics::unserialize(tools::binary_stream& _bs)
         }
         else
         {
-            auto curr_event_name = pack_val.get_item(statistics_info_types::event_name);
-
-            if (!curr_event_name)
-            {
-                assert(false);
+            if (!unserialize_event(pack_val))
                 return false;
-            }
-            stats_event_names name = curr_event_name->get_value<stats_event_names>();
+        }
+    }
 
-            auto tlv_event_time = pack_val.get_item(statistics_info_types::event_time);
-            auto tlv_event_id = pack_val.get_item(statistics_info_types::event_id);
-            if (!tlv_event_time || !tlv_event_id)
-            {
-                assert(false);
-                return false;
-            }
+    return true;
+}
 
-            event_props_type props;
-            const auto tlv_prop_pack = pack_val.get_item(statistics_info_types::event_props);
-            assert(tlv_prop_pack);
-            if (tlv_prop_pack)
-            {
-                auto prop_pack = tlv_prop_pack->get_value<tools::tlvpack>();
-                if (!unserialize_props(prop_pack, &props))
-                {
-                    assert(false);
-                    return false;
-                }
-            }
+bool statistics::unserialize_event(tools::tlvpack& _pack)
+{
+    auto curr_event_name = _pack.get_item(statistics_info_types::event_name);
+    if (!curr_event_name)
+    {
+        assert(false);
+        return false;
+    }
+
+    stats_event_names name = curr_event_name->get_value<stats_event_names>();
+
+    auto tlv_event_time = _pack.get_item(statistics_info_types::event_time);
+    auto tlv_event_id = _pack.get_item(statistics_info_types::event_id);
+    if (!tlv_event_time || !tlv_event_id)
+    {
+        assert(false);
+        return false;
+    }
+
+    event_props_type props;
+    const auto tlv_prop_pack = _pack.get_item(statistics_info_types::event_props);
+    assert(tlv_prop_pack);
+    if (tlv_prop_pack)
+    {
+        auto prop_pack = tlv_prop_pack->get_value<tools::tlvpack>();
+        if (!unserialize_props(prop_pack, &props))
+        {
+            assert(false);
+            return false;
+        }
+    }
+
+    const auto tlv_event_count = _pack.get_item(statistics_info_types::event_count);
+
+    auto read_event_time = std::chrono::system_clock::from_time_t(tlv_event_time->get_value<int64_t>());
+    auto read_event_id = tlv_event_id->get_value<int64_t>();
+    auto read_event_count = (tlv_event_count ? tlv_event_count->get_value<int32_t>() : 1);
+    insert_event(name, props, read_event_time, read_event_id, read_event_count);
+
+    return true;
+}
+
+bool statistics::unserialize_segments(tools::binary_stream& _bs)
+{
+    records_in_file_ = 0;
+
+    while (_bs.available())
+    {
+        // the tail is cut if the application was closed during an append
+        if (_bs.available() < sizeof(uint32_t))
+        {
+            need_compact_ = true;
+            break;
+        }
+
+        const auto size = _bs.read<uint32_t>();
+        if (size == 0 || _bs.available() < size)
+        {
+            need_compact_ = true;
+            break;
+        }
+
+        tools::binary_stream bs_record;
+        bs_record.write(_bs.read(size), size);
+
+        tools::tlvpack record;
+        if (!record.unserialize(bs_record))
+        {
+            need_compact_ = true;
+            break;
+        }
 
-            auto read_event_time = std::chrono::system_clock::from_time_t(tlv_event_time->get_value<int64_t>());
-            auto read_event_id = tlv_event_id->get_value<int64_t>();
-            insert_event(name, props, read_event_time, read_event_id);
+        ++records_in_file_;
+
+        if (auto tlv_last_sent_time = record.get_item(statistics_info_types::last_sent_time))
+        {
+            last_sent_time_ = std::chrono::system_clock::from_time_t(tlv_last_sent_time->get_value<int64_t>());
+            continue;
+        }
+
+        if (!unserialize_event(record))
+        {
+            need_compact_ = true;
+            break;
         }
     }
 
@@ -272,20 +380,51 @@ bool statistics::unserialize(tools::binary_stream& _bs)
 
 void statistics::save_if_needed()
 {
-    if (changed_)
+    if (!changed_)
+        return;
+
+    changed_ = false;
+
+    auto bs_data = std::make_shared<tools::binary_stream>();
+    std::wstring file_name = file_name_;
+
+    if (need_compact_ || records_in_file_ > (events_.size() + 1) * compact_ratio)
     {
-        changed_ = false;
+        need_compact_ = false;
 
-        auto bs_data = std::make_shared<tools::binary_stream>();
         serialize(*bs_data);
-        std::wstring file_name = file_name_;
+        records_in_file_ = events_.size() + 1;
+
+        g_core->save_async([bs_data, file_name]
+        {
+            const auto tmp_file_name = file_name + L".tmp";
+            if (!bs_data->save_2_file(tmp_file_name))
+                return -1;
+
+            boost::system::error_code error;
+            boost::filesystem::rename(tmp_file_name, file_name, error);
+
+            return (error ? -1 : 0);
+        });
+    }
+    else
+    {
+        records_in_file_ += serialize_pending(*bs_data);
 
         g_core->save_async([bs_data, file_name]
         {
-            bs_data->save_2_file(file_name);
-            return 0;
+            const auto size = bs_data->available();
+            if (size == 0)
+                return 0;
+
+            auto file = tools::system::open_file_for_write(file_name, std::ios::out | std::ios::binary | std::ios::app);
+            file.write(bs_data->read(size), size);
+
+            return (file.good() ? 0 : -1);
         });
     }
+
+    pending_counts_.clear();
 }
 
 void statistics::clear()
@@ -304,6 +443,10 @@ void statistics::clear()
     events_.clear();
     events_.push_back(last_service_event);
 
+    session_index_.clear();
+    pending_counts_.clear();
+
+    need_compact_ = true;
     changed_ = true;
 
     // reset_session_event_id();
@@ -350,7 +493,7 @@ std::string statistics::events_to_json(events_ci begin, events_ci end, time_t _s
         if (stat_event != begin)
             data_stream << ",";
         data_stream << stat_event->to_string(_start_time);
-        ++events_and_count[stat_event->get_name()];
+        events_and_count[stat_event->get_name()] += stat_event->get_count();
     }
 
     data_stream << "],\"bm\":false,\"bn\":{";
@@ -474,11 +617,98 @@ bool statistics::send(const proxy_settings& _user_proxy, const std::string& post
     return post_request.get();
 }
 
+std::string statistics::make_event_key(stats_event_names _name, const event_props_type& _props)
+{
+    std::string key = std::to_string(static_cast<int32_t>(_name));
+
+    for (const auto& prop : _props)
+    {
+        key += '\0';
+        key += prop.first;
+        key += '\0';
+        key += prop.second;
+    }
+
+    return key;
+}
+
+void statistics::rebuild_session_index()
+{
+    session_index_.clear();
+
+    for (auto i = events_.size(); i > 0; --i)
+    {
+        const auto& stat_event = events_[i - 1];
+        if (stat_event.get_name() == stats_event_names::service_session_start)
+            break;
+
+        session_index_[make_event_key(stat_event.get_name(), stat_event.get_props())] = (i - 1);
+    }
+}
+
+bool statistics::drop_oldest_session()
+{
+    if (events_.size() < 2)
+        return false;
+
+    const auto next_session = std::find_if(std::next(events_.begin()), events_.end(), [](const stats_event& _event)
+    {
+        return (_event.get_name() == stats_event_names::service_session_start);
+    });
+
+    if (next_session == events_.end())
+        return false;
+
+    events_.erase(events_.begin(), next_session);
+
+    rebuild_session_index();
+
+    // the positions have moved, the whole file is written again
+    pending_counts_.clear();
+    need_compact_ = true;
+
+    return true;
+}
+
 void statistics::insert_event(stats_event_names _event_name, const event_props_type& _props,
-                              std::chrono::system_clock::time_point _event_time, int32_t _event_id)
+                              std::chrono::system_clock::time_point _event_time, int32_t _event_id, int32_t _count)
 {
-    events_.emplace_back(_event_name, _event_time, _event_id, _props);
     changed_ = true;
+
+    const auto is_session_start = (_event_name == stats_event_names::service_session_start);
+
+    std::string key;
+
+    if (is_session_start)
+    {
+        session_index_.clear();
+    }
+    else
+    {
+        key = make_event_key(_event_name, _props);
+
+        const auto iter = session_index_.find(key);
+        if (iter != session_index_.end())
+        {
+            events_[iter->second].add_count(_count);
+            pending_counts_[iter->second] += _count;
+
+            return;
+        }
+    }
+
+    // when a single session is full, new kinds of events are lost, known ones are still counted
+    if (events_.size() >= max_stored_events && !drop_oldest_session())
+        return;
+
+    events_.emplace_back(_event_name, _event_time, _event_id, _props, _count);
+
+    const auto position = (events_.size() - 1);
+
+    if (!is_session_start)
+        session_index_[key] = position;
+
+    pending_counts_[position] += _count;
 }
 
 void statistics::insert_event(stats_event_names _event_name, const event_props_type& _props)
@@ -498,10 +728,11 @@ void statistics::insert_event(stats_event_names _event_name)
 }
 
 statistics::stats_event::stats_event(stats_event_names _name,
-                                     std::chrono::system_clock::time_point _event_time, int32_t _event_id, const event_props_type& _props)
+                                     std::chrono::system_clock::time_point _event_time, int32_t _event_id, const event_props_type& _props, int32_t _count)
     : name_(_name)
     , props_(_props)
     , event_time_(_event_time)
+    , count_(_count)
 {
     if (_event_id == -1)
         event_id_ = session_event_id_++; // started from 1
@@ -556,3 +787,13 @@ int32_t statistics::stats_event::get_id() const
 {
     return event_id_;
 }
+
+int32_t statistics::stats_event::get_count() const
+{
+    return count_;
+}
+
+void statistics::stats_event::add_count(int32_t _count)
+{
+    count_ += _count;
+}
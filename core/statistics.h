@@ -10,6 +10,7 @@ namespace core
     namespace tools
     {
         class binary_stream;
+        class tlvpack;
     }
 
     const static std::string flurry_url = "https://data.flurry.com/aah.do";
@@ -31,22 +32,26 @@ namespace core
         {
         private:
 
+            // repeated events of a session with the same props are folded into one with a count
             class stats_event
             {
             public:
                 std::string to_string(time_t _start_time) const;
-                stats_event(stats_event_names _name, std::chrono::system_clock::time_point _event_time, int32_t _event_id, const event_props_type& props);
+                stats_event(stats_event_names _name, std::chrono::system_clock::time_point _event_time, int32_t _event_id, const event_props_type& props, int32_t _count = 1);
                 stats_event_names get_name() const;
                 event_props_type get_props() const;
                 static void reset_session_event_id();
                 std::chrono::system_clock::time_point get_time() const;
                 int32_t get_id() const;
+                int32_t get_count() const;
+                void add_count(int32_t _count);
             private:
                 stats_event_names name_;
                 int32_t event_id_; // natural serial number, starting from 1
                 event_props_type props_;
                 static long long session_event_id_;
                 std::chrono::system_clock::time_point event_time_;
+                int32_t count_;
             };
 
             struct stop_objects
@@ -70,20 +75,39 @@ namespace core
             uint32_t start_send_timer_;
             std::unique_ptr<async_executer> stats_thread_;
             std::vector<stats_event> events_;
+
+            // positions in events_ of the events of the last session, by name and props
+            std::unordered_map<std::string, size_t> session_index_;
+
+            // occurrences added since the last save, by position in events_,
+            // they are appended to the file as records with counts
+            std::map<size_t, int32_t> pending_counts_;
+
+            // the file is rewritten as a whole on the next save
+            bool need_compact_;
+            size_t records_in_file_;
+
             std::string events_to_json(events_ci begin, events_ci end, time_t _start_time) const;
             std::chrono::system_clock::time_point last_sent_time_;
             std::vector<std::string> get_post_data() const;
             static bool send(const proxy_settings& _user_proxy, const std::string& post_data, const std::wstring& _file_name);
 
+            static std::string make_event_key(stats_event_names _name, const event_props_type& _props);
+            void rebuild_session_index();
+            bool drop_oldest_session();
+
             void serialize(tools::binary_stream& _bs) const;
+            size_t serialize_pending(tools::binary_stream& _bs) const;
             bool unserialize(tools::binary_stream& _bs);
+            bool unserialize_segments(tools::binary_stream& _bs);
+            bool unserialize_event(tools::tlvpack& _pack);
             void save_if_needed();
             void send_async();
             bool load();
             void start_save();
             void start_send();
             void insert_event(stats_event_names _event_name, const event_props_type& _props,
-                std::chrono::system_clock::time_point _event_time, int32_t _event_id);
+                std::chrono::system_clock::time_point _event_time, int32_t _event_id, int32_t _count = 1);
             void clear();
             void delayed_start_send();
         public:
@@ -380,6 +380,154 @@ namespace core
 
         std::wstring g_stickers_path;
 
+        //////////////////////////////////////////////////////////////////////////
+        // class pack
+        //////////////////////////////////////////////////////////////////////////
+        const uint32_t pack_signature = 0x4b505453;
+        const uint32_t pack_version = 1;
+
+        pack::pack(const std::wstring& _file_name)
+            :   file_name_(_file_name),
+                indexed_(false),
+                end_(0)
+        {
+        }
+
+        void pack::build_index()
+        {
+            indexed_ = true;
+            index_.clear();
+            end_ = 0;
+
+            const auto file_size = static_cast<int64_t>(tools::system::get_file_size(file_name_));
+            if (file_size == 0)
+                return;
+
+            auto file = tools::system::open_file_for_read(file_name_, std::ios::in | std::ios::binary);
+            if (!file.is_open())
+                return;
+
+            uint32_t header[2] = { 0, 0 };
+            if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != pack_signature || header[1] != pack_version)
+                return;
+
+            end_ = sizeof(header);
+
+            for (;;)
+            {
+                int32_t sticker_id = 0;
+                uint32_t size = 0;
+
+                if (!file.read(reinterpret_cast<char*>(&sticker_id), sizeof(sticker_id)) || !file.read(reinterpret_cast<char*>(&size), sizeof(size)))
+                    break;
+
+                const auto offset = end_ + static_cast<int64_t>(sizeof(sticker_id) + sizeof(size));
+
+                // the record was cut when the application was closed
+                if (offset + size > file_size)
+                    break;
+
+                index_[sticker_id] = entry { offset, size };
+                end_ = offset + size;
+
+                file.seekg(end_);
+            }
+        }
+
+        bool pack::contains(int32_t _sticker_id)
+        {
+            if (!indexed_)
+                build_index();
+
+            return (index_.find(_sticker_id) != index_.end());
+        }
+
+        bool pack::read(int32_t _sticker_id, tools::binary_stream& _data)
+        {
+            if (!indexed_)
+                build_index();
+
+            const auto iter = index_.find(_sticker_id);
+            if (iter == index_.end() || iter->second.size_ == 0)
+                return false;
+
+            auto file = tools::system::open_file_for_read(file_name_, std::ios::in | std::ios::binary);
+            if (!file.is_open())
+                return false;
+
+            file.seekg(iter->second.offset_);
+
+            _data.reserve(iter->second.size_);
+            file.read(_data.alloc_buffer(iter->second.size_), iter->second.size_);
+
+            if (!file.good())
+            {
+                _data.reset();
+                return false;
+            }
+
+            return true;
+        }
+
+        bool pack::append(int32_t _sticker_id, const char* _data, uint32_t _size)
+        {
+            if (!indexed_)
+                build_index();
+
+            const auto is_new = (end_ == 0);
+
+            try
+            {
+                const boost::filesystem::wpath path(file_name_);
+
+                if (is_new)
+                {
+                    tools::system::create_directory_if_not_exists(path.parent_path());
+                }
+                else if (static_cast<int64_t>(tools::system::get_file_size(file_name_)) != end_)
+                {
+                    // drops a record cut by a crash
+                    boost::filesystem::resize_file(path, end_);
+                }
+            }
+            catch (const boost::filesystem::filesystem_error&)
+            {
+                return false;
+            }
+
+            auto file = tools::system::open_file_for_write(file_name_, std::ios::out | std::ios::binary | (is_new ? std::ios::trunc : std::ios::app));
+            if (!file.is_open())
+                return false;
+
+            auto offset = end_;
+
+            if (is_new)
+            {
+                const uint32_t header[2] = { pack_signature, pack_version };
+                file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+                offset = sizeof(header);
+            }
+
+            file.write(reinterpret_cast<const char*>(&_sticker_id), sizeof(_sticker_id));
+            file.write(reinterpret_cast<const char*>(&_size), sizeof(_size));
+            file.write(_data, _size);
+            file.flush();
+
+            if (!file.good())
+            {
+                indexed_ = false;
+                return false;
+            }
+
+            offset += sizeof(_sticker_id) + sizeof(_size);
+
+            index_[_sticker_id] = entry { offset, _size };
+            end_ = offset + _size;
+
+            return true;
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // class cache
         //////////////////////////////////////////////////////////////////////////
@@ -569,6 +717,85 @@ namespace core
             return get_sticker_path(_set.get_id(), _sticker.get_id(), _size);
         }
 
+        std::wstring cache::get_pack_path(int32_t _set_id, sticker_size _size)
+        {
+            std::wstringstream ss_out;
+
+            ss_out << g_stickers_path << L"/" << _set_id << L"/" << _size << L".pack";
+
+            return ss_out.str();
+        }
+
+        std::shared_ptr<pack> cache::get_pack(int32_t _set_id, sticker_size _size)
+        {
+            const auto key = std::make_pair(_set_id, _size);
+
+            auto iter = packs_.find(key);
+            if (iter == packs_.end())
+                iter = packs_.insert(std::make_pair(key, std::make_shared<pack>(get_pack_path(_set_id, _size)))).first;
+
+            return iter->second;
+        }
+
+        bool cache::is_sticker_exist(int32_t _set_id, int32_t _sticker_id, sticker_size _size)
+        {
+            return get_pack(_set_id, _size)->contains(_sticker_id) || core::tools::system::is_exist(get_sticker_path(_set_id, _sticker_id, _size));
+        }
+
+        bool cache::load_sticker(int32_t _set_id, int32_t _sticker_id, sticker_size _size, tools::binary_stream& _data)
+        {
+            if (get_pack(_set_id, _size)->read(_sticker_id, _data))
+                return true;
+
+            // downloaded before the packs
+            return _data.load_from_file(get_sticker_path(_set_id, _sticker_id, _size));
+        }
+
+        void cache::pack_sticker(const download_task& _task)
+        {
+            if (_task.get_sticker_id() == -1)
+                return;
+
+            tools::binary_stream data;
+            if (!data.load_from_file(_task.get_dest_file()))
+                return;
+
+            const auto size = data.available();
+            if (size == 0)
+                return;
+
+            if (!get_pack(_task.get_set_id(), _task.get_size())->append(_task.get_sticker_id(), data.read(size), size))
+                return;
+
+            tools::system::delete_file(_task.get_dest_file());
+
+            // the directory of the sticker is left empty
+            boost::system::error_code error;
+            boost::filesystem::remove(boost::filesystem::wpath(_task.get_dest_file()).parent_path(), error);
+        }
+
+        // stickers requested by the gui go first, then the rest of the set they are from
+        void cache::prioritize_set(int32_t _set_id)
+        {
+            download_tasks requested;
+            download_tasks same_set;
+
+            for (auto iter = stickers_tasks_.begin(); iter != stickers_tasks_.end();)
+            {
+                auto next = std::next(iter);
+
+                if (has_gui_request(iter->get_set_id(), iter->get_sticker_id()))
+                    requested.splice(requested.end(), stickers_tasks_, iter);
+                else if (iter->get_set_id() == _set_id)
+                    same_set.splice(same_set.end(), stickers_tasks_, iter);
+
+                iter = next;
+            }
+
+            stickers_tasks_.splice(stickers_tasks_.begin(), same_set);
+            stickers_tasks_.splice(stickers_tasks_.begin(), requested);
+        }
+
         std::string cache::make_sticker_url(const int32_t _set_id, const int32_t _sticker_id, const core::sticker_size _size) const
         {
             std::stringstream ss_size;
@@ -624,7 +851,7 @@ namespace core
 
                     std::wstring file_name = get_sticker_path(*(*iter), *(*iter_sticker), string_size_2_size(_size));
 
-                    if (!core::tools::system::is_exist(file_name))
+                    if (!is_sticker_exist(set_id, sticker_id, string_size_2_size(_size)))
                     {
                         if (has_gui_request(set_id, sticker_id))
                         {
@@ -763,12 +990,17 @@ namespace core
 
         bool cache::get_next_sticker_task(download_task& _task)
         {
-            if (stickers_tasks_.empty())
-                return false;
+            for (const auto& task : stickers_tasks_)
+            {
+                if (!tasks_in_progress_.insert(task.get_source_url()).second)
+                    continue;
 
-            _task = stickers_tasks_.front();
+                _task = task;
 
-            return true;
+                return true;
+            }
+
+            return false;
         }
 
         void cache::get_sticker(int64_t _seq, int32_t _set_id, int32_t _sticker_id, const sticker_size _size, tools::binary_stream& _data)
@@ -783,11 +1015,13 @@ namespace core
                     stickers_tasks_.erase(iter);
                     stickers_tasks_.push_front(task);
 
+                    prioritize_set(_set_id);
+
                     return;
                 }
             }
 
-            if (!_data.load_from_file(get_sticker_path(_set_id, _sticker_id, _size)))
+            if (!load_sticker(_set_id, _sticker_id, _size, _data))
             {
                 const auto sticker_url = make_sticker_url(_set_id, _sticker_id, _size);
 
@@ -795,6 +1029,8 @@ namespace core
 
                 stickers_tasks_.emplace_front(sticker_url, file_name, _set_id, _sticker_id, _size);
 
+                prioritize_set(_set_id);
+
                 return;
             }
         }
@@ -873,6 +1109,10 @@ namespace core
 
         bool cache::sticker_loaded(const download_task& _task, /*out*/ requests_list& _requests)
         {
+            tasks_in_progress_.erase(_task.get_source_url());
+
+            pack_sticker(_task);
+
             for (auto iter = stickers_tasks_.begin(); iter != stickers_tasks_.end(); ++iter)
             {
                 if (_task.get_source_url() == iter->get_source_url())
@@ -889,6 +1129,11 @@ namespace core
             return false;
         }
 
+        void cache::sticker_failed(const download_task& _task)
+        {
+            tasks_in_progress_.erase(_task.get_source_url());
+        }
+
         bool cache::meta_loaded(const download_task& _task)
         {
             for (auto iter = meta_tasks_.begin(); iter != meta_tasks_.end(); ++iter)
@@ -918,7 +1163,7 @@ namespace core
                 up_to_date_(false),
                 download_meta_in_progress_(false),
                 download_meta_error_(false),
-                download_stickers_in_progess_(false),
+                download_stickers_running_(0),
                 download_stickers_error_(false),
                 flag_meta_need_reload_(false)
         {
@@ -1183,6 +1428,18 @@ namespace core
             return handler;
         }
 
+        void face::on_sticker_failed(const download_task& _task)
+        {
+            auto stickers_cache = cache_;
+
+            thread_->run_async_function([stickers_cache, _task]()->int32_t
+            {
+                stickers_cache->sticker_failed(_task);
+
+                return 0;
+            });
+        }
+
         std::shared_ptr<result_handler<bool>> face::on_metadata_loaded(const download_task& _task)
         {
             auto handler = std::make_shared<result_handler<bool>>();
@@ -1282,14 +1539,14 @@ namespace core
             return download_stickers_error_;
         }
 
-        bool face::is_download_stickers_in_progress() const
+        int32_t face::get_download_stickers_running() const
         {
-            return download_stickers_in_progess_;
+            return download_stickers_running_;
         }
 
-        void face::set_download_stickers_in_progress(const bool _in_progress)
+        void face::set_download_stickers_running(const int32_t _running)
         {
-            download_stickers_in_progess_ = _in_progress;
+            download_stickers_running_ = _running;
         }
 
     }
@@ -218,6 +218,37 @@ namespace core
         typedef std::list<download_task> download_tasks;
         typedef std::list<int64_t> requests_list;
 
+        //////////////////////////////////////////////////////////////////////////
+        // class pack
+        // images of one set and size in one file, {sticker id, size, data}
+        // records are appended one after another and indexed on the first access
+        //////////////////////////////////////////////////////////////////////////
+        class pack
+        {
+            struct entry
+            {
+                int64_t offset_;
+                uint32_t size_;
+            };
+
+            const std::wstring file_name_;
+
+            bool indexed_;
+            int64_t end_;
+
+            std::map<int32_t, entry> index_;
+
+            void build_index();
+
+        public:
+
+            explicit pack(const std::wstring& _file_name);
+
+            bool contains(int32_t _sticker_id);
+            bool read(int32_t _sticker_id, tools::binary_stream& _data);
+            bool append(int32_t _sticker_id, const char* _data, uint32_t _size);
+        };
+
         //////////////////////////////////////////////////////////////////////////
         // class cache
         //////////////////////////////////////////////////////////////////////////
@@ -239,11 +270,23 @@ namespace core
 
             stickers_sets_ids_list gui_requests_;
             //icons_request_sets_list icons_requests_;
-            
+
+            // source urls of the tasks being downloaded now
+            std::set<std::string> tasks_in_progress_;
+
+            typedef std::map<std::pair<int32_t, sticker_size>, std::shared_ptr<pack>> packs_map;
+            packs_map packs_;
+
             requests_list get_sticker_gui_requests(int32_t _set_id, int32_t _sticker_id) const;
             void clear_sticker_gui_requests(int32_t _set_id, int32_t _sticker_id);
             bool has_gui_request(int32_t _set_id, int32_t _sticker_id);
 
+            std::shared_ptr<pack> get_pack(int32_t _set_id, sticker_size _size);
+            bool is_sticker_exist(int32_t _set_id, int32_t _sticker_id, sticker_size _size);
+            bool load_sticker(int32_t _set_id, int32_t _sticker_id, sticker_size _size, tools::binary_stream& _data);
+            void pack_sticker(const download_task& _task);
+            void prioritize_set(int32_t _set_id);
+
             std::string make_sticker_url(const int32_t _set_id, const int32_t _sticker_id, const core::sticker_size _size) const;
             std::string make_sticker_url(const int32_t _set_id, const int32_t _sticker_id, const std::string& _size) const;
 
@@ -267,6 +310,7 @@ namespace core
             static std::wstring get_set_big_icon_path(const int32_t _set_id);
             static std::wstring get_sticker_path(const set& _set, const sticker& _sticker, sticker_size _size);
             static std::wstring get_sticker_path(int32_t _set_id, int32_t _sticker_id, sticker_size _size);
+            static std::wstring get_pack_path(int32_t _set_id, sticker_size _size);
 
             static std::string make_big_icon_url(const int32_t _set_id);
 
@@ -276,6 +320,7 @@ namespace core
             void get_set_icon_big(const int64_t _seq, const int32_t _set_id, tools::binary_stream& _data);
             std::string get_md5() const;
             bool sticker_loaded(const download_task& _task, /*out*/ requests_list&);
+            void sticker_failed(const download_task& _task);
             bool meta_loaded(const download_task& _task);
         };
 
@@ -304,7 +349,7 @@ namespace core
             bool download_meta_in_progress_;
             bool download_meta_error_;
 
-            bool download_stickers_in_progess_;
+            int32_t download_stickers_running_;
             bool download_stickers_error_;
 
             bool flag_meta_need_reload_;
@@ -337,6 +382,7 @@ namespace core
             std::shared_ptr<result_handler<bool, const download_task&>> get_next_meta_task();
             std::shared_ptr<result_handler<bool, const download_task&>> get_next_sticker_task();
             std::shared_ptr<result_handler<bool, const requests_list&>> on_sticker_loaded(const download_task& _task);
+            void on_sticker_failed(const download_task& _task);
             std::shared_ptr<result_handler<bool>> on_metadata_loaded(const download_task& _task);
             std::shared_ptr<result_handler<const std::string&>> get_md5();
 
@@ -360,8 +406,9 @@ namespace core
             void set_download_stickers_error(const bool _is_error);
             bool is_download_stickers_error() const;
 
-            bool is_download_stickers_in_progress() const;
-            void set_download_stickers_in_progress(const bool _in_progress);
+            // the count of stickers being downloaded at once
+            int32_t get_download_stickers_running() const;
+            void set_download_stickers_running(const int32_t _running);
 
         };
     }
@@ -0,0 +1,507 @@
+#include "stdafx.h"
+
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+
+#include "case_fold.h"
+
+namespace
+{
+    // the basic multilingual plane, all code points encoded with up to three bytes (128 KB a table)
+    const uint32_t table_size = 0x10000;
+
+    struct case_tables
+    {
+        uint16_t upper_[table_size];
+        uint16_t lower_[table_size];
+
+        case_tables()
+        {
+            for (uint32_t i = 0; i < table_size; ++i)
+            {
+                upper_[i] = static_cast<uint16_t>(i);
+                lower_[i] = static_cast<uint16_t>(i);
+            }
+
+            // basic latin and latin-1
+            add_range('A', 'Z', 0x20);
+            add_range(0xC0, 0xD6, 0x20);
+            add_range(0xD8, 0xDE, 0x20);
+            add_pair(0x178, 0xFF);
+            upper_[0xB5] = 0x39C;
+
+            // latin extended-a and the regular part of extended-b
+            add_alternating(0x100, 0x12F);
+            lower_[0x130] = 'i';
+            upper_[0x131] = 'I';
+            add_alternating(0x132, 0x137);
+            add_alternating(0x139, 0x148);
+            add_alternating(0x14A, 0x177);
+            add_alternating(0x179, 0x17E);
+            upper_[0x17F] = 'S';
+            add_alternating(0x1CD, 0x1DC);
+            add_alternating(0x1DE, 0x1EF);
+            add_alternating(0x1F8, 0x21F);
+            add_alternating(0x222, 0x233);
+
+            // greek
+            add_pair(0x386, 0x3AC);
+            add_range(0x388, 0x38A, 0x25);
+            add_pair(0x38C, 0x3CC);
+            add_range(0x38E, 0x38F, 0x3F);
+            add_range(0x391, 0x3A1, 0x20);
+            add_range(0x3A3, 0x3AB, 0x20);
+            upper_[0x3C2] = 0x3A3;
+
+            // cyrillic
+            add_range(0x400, 0x40F, 0x50);
+            add_range(0x410, 0x42F, 0x20);
+            add_alternating(0x460, 0x481);
+            add_alternating(0x48A, 0x4BF);
+            add_pair(0x4C0, 0x4CF);
+            add_alternating(0x4C1, 0x4CE);
+            add_alternating(0x4D0, 0x52F);
+
+            // armenian
+            add_range(0x531, 0x556, 0x30);
+
+            // georgian: asomtavruli and nuskhuri, mtavruli and mkhedruli
+            add_range(0x10A0, 0x10C5, 0x1C60);
+            add_pair(0x10C7, 0x2D27);
+            add_pair(0x10CD, 0x2D2D);
+            add_range(0x1C90, 0x1CBA, -0xBC0);
+            add_range(0x1CBD, 0x1CBF, -0xBC0);
+
+            // cherokee
+            add_range(0x13A0, 0x13EF, 0x97D0);
+            add_range(0x13F0, 0x13F5, 0x8);
+
+            // cyrillic extended-c, old forms of the regular letters
+            upper_[0x1C80] = 0x412;
+            upper_[0x1C81] = 0x414;
+            upper_[0x1C82] = 0x41E;
+            upper_[0x1C83] = 0x421;
+            upper_[0x1C84] = 0x422;
+            upper_[0x1C85] = 0x422;
+            upper_[0x1C86] = 0x42A;
+            upper_[0x1C87] = 0x462;
+            upper_[0x1C88] = 0xA64A;
+
+            // latin extended additional (vietnamese)
+            add_alternating(0x1E00, 0x1E95);
+            upper_[0x1E9B] = 0x1E60;
+            lower_[0x1E9E] = 0xDF;
+            add_alternating(0x1EA0, 0x1EFF);
+
+            // greek extended, the letters with iota subscript have their simple upper case mapping
+            add_range(0x1F08, 0x1F0F, -0x8);
+            add_range(0x1F18, 0x1F1D, -0x8);
+            add_range(0x1F28, 0x1F2F, -0x8);
+            add_range(0x1F38, 0x1F3F, -0x8);
+            add_range(0x1F48, 0x1F4D, -0x8);
+            add_pair(0x1F59, 0x1F51);
+            add_pair(0x1F5B, 0x1F53);
+            add_pair(0x1F5D, 0x1F55);
+            add_pair(0x1F5F, 0x1F57);
+            add_range(0x1F68, 0x1F6F, -0x8);
+            add_range(0x1F88, 0x1F8F, -0x8);
+            add_range(0x1F98, 0x1F9F, -0x8);
+            add_range(0x1FA8, 0x1FAF, -0x8);
+            add_range(0x1FB8, 0x1FB9, -0x8);
+            add_range(0x1FBA, 0x1FBB, -0x4A);
+            add_pair(0x1FBC, 0x1FB3);
+            upper_[0x1FBE] = 0x399;
+            add_range(0x1FC8, 0x1FCB, -0x56);
+            add_pair(0x1FCC, 0x1FC3);
+            add_range(0x1FD8, 0x1FD9, -0x8);
+            add_range(0x1FDA, 0x1FDB, -0x64);
+            add_range(0x1FE8, 0x1FE9, -0x8);
+            add_range(0x1FEA, 0x1FEB, -0x70);
+            add_pair(0x1FEC, 0x1FE5);
+            add_range(0x1FF8, 0x1FF9, -0x80);
+            add_range(0x1FFA, 0x1FFB, -0x7E);
+            add_pair(0x1FFC, 0x1FF3);
+
+            // letterlike symbols, roman numerals and circled letters
+            lower_[0x2126] = 0x3C9;
+            lower_[0x212A] = 'k';
+            lower_[0x212B] = 0xE5;
+            add_pair(0x2132, 0x214E);
+            add_range(0x2160, 0x216F, 0x10);
+            add_pair(0x2183, 0x2184);
+            add_range(0x24B6, 0x24CF, 0x1A);
+
+            // glagolitic
+            add_range(0x2C00, 0x2C2F, 0x30);
+
+            // latin extended-c, partly the upper case of ipa letters
+            add_pair(0x23A, 0x2C65);
+            add_pair(0x23E, 0x2C66);
+            add_pair(0x2C60, 0x2C61);
+            add_pair(0x2C62, 0x26B);
+            add_pair(0x2C63, 0x1D7D);
+            add_pair(0x2C64, 0x27D);
+            add_alternating(0x2C67, 0x2C6C);
+            add_pair(0x2C6D, 0x251);
+            add_pair(0x2C6E, 0x271);
+            add_pair(0x2C6F, 0x250);
+            add_pair(0x2C70, 0x252);
+            add_pair(0x2C72, 0x2C73);
+            add_pair(0x2C75, 0x2C76);
+            add_range(0x2C7E, 0x2C7F, -0x2A3F);
+
+            // coptic
+            add_alternating(0x2C80, 0x2CE3);
+            add_alternating(0x2CEB, 0x2CEE);
+            add_pair(0x2CF2, 0x2CF3);
+
+            // cyrillic extended-b
+            add_alternating(0xA640, 0xA66D);
+            add_alternating(0xA680, 0xA69B);
+
+            // latin extended-d
+            add_alternating(0xA722, 0xA72F);
+            add_alternating(0xA732, 0xA76F);
+            add_alternating(0xA779, 0xA77C);
+            add_pair(0xA77D, 0x1D79);
+            add_alternating(0xA77E, 0xA787);
+            add_pair(0xA78B, 0xA78C);
+            add_pair(0xA78D, 0x265);
+            add_alternating(0xA790, 0xA793);
+            add_alternating(0xA796, 0xA7A9);
+            add_pair(0xA7AA, 0x266);
+            add_pair(0xA7AB, 0x25C);
+            add_pair(0xA7AC, 0x261);
+            add_pair(0xA7AD, 0x26C);
+            add_pair(0xA7AE, 0x26A);
+            add_pair(0xA7B0, 0x29E);
+            add_pair(0xA7B1, 0x287);
+            add_pair(0xA7B2, 0x29D);
+            add_pair(0xA7B3, 0xAB53);
+            add_alternating(0xA7B4, 0xA7C3);
+            add_pair(0xA7C4, 0xA794);
+            add_pair(0xA7C5, 0x282);
+            add_pair(0xA7C6, 0x1D8E);
+            add_alternating(0xA7C7, 0xA7CA);
+            add_pair(0xA7D0, 0xA7D1);
+            add_alternating(0xA7D6, 0xA7D9);
+            add_pair(0xA7F5, 0xA7F6);
+
+            // fullwidth latin
+            add_range(0xFF21, 0xFF3A, 0x20);
+        }
+
+        void add_pair(uint32_t _upper, uint32_t _lower)
+        {
+            upper_[_lower] = static_cast<uint16_t>(_upper);
+            lower_[_upper] = static_cast<uint16_t>(_lower);
+        }
+
+        // _offset from the upper letters to the lower ones, negative if the lower ones go first
+        void add_range(uint32_t _first_upper, uint32_t _last_upper, int32_t _offset)
+        {
+            for (auto c = _first_upper; c <= _last_upper; ++c)
+                add_pair(c, static_cast<uint32_t>(static_cast<int32_t>(c) + _offset));
+        }
+
+        // upper and lower letters alternate starting with an upper one
+        void add_alternating(uint32_t _first, uint32_t _last)
+        {
+            for (auto c = _first; c < _last; c += 2)
+                add_pair(c, c + 1);
+        }
+    };
+
+    const case_tables& get_tables()
+    {
+        static const case_tables tables;
+        return tables;
+    }
+
+    template <bool _upper>
+    uint32_t fold(uint32_t _code_point)
+    {
+        if (_code_point < table_size)
+            return (_upper ? get_tables().upper_ : get_tables().lower_)[_code_point];
+
+        // wchar_t has 16 bits on windows
+        if (_code_point > static_cast<uint32_t>(WCHAR_MAX))
+            return _code_point;
+
+        const auto c = static_cast<wint_t>(_code_point);
+        return static_cast<uint32_t>(_upper ? std::towupper(c) : std::towlower(c));
+    }
+
+    const uint64_t ones = 0x0101010101010101ull;
+    const uint64_t high_bits = 0x8080808080808080ull;
+
+    // converts the leading ascii part in place, returns its length
+    template <bool _upper>
+    size_t fold_ascii(char* _data, size_t _size)
+    {
+        const char first = (_upper ? 'a' : 'A');
+        const char last = (_upper ? 'z' : 'Z');
+
+        size_t i = 0;
+
+        for (; i + sizeof(uint64_t) <= _size; i += sizeof(uint64_t))
+        {
+            uint64_t chunk;
+            memcpy(&chunk, _data + i, sizeof(chunk));
+
+            if (chunk & high_bits)
+                break;
+
+            // no byte is above 0x7f, so the additions do not carry into the next byte
+            const auto not_below_first = chunk + ones * (0x80 - first);
+            const auto above_last = chunk + ones * (0x80 - last - 1);
+            const auto letters = (not_below_first ^ above_last) & high_bits;
+
+            chunk ^= (letters >> 2);
+            memcpy(_data + i, &chunk, sizeof(chunk));
+        }
+
+        for (; i < _size; ++i)
+        {
+            const auto c = _data[i];
+            if (c & 0x80)
+                break;
+
+            if (c >= first && c <= last)
+                _data[i] = (c ^ 0x20);
+        }
+
+        return i;
+    }
+
+    // the length of a well-formed sequence, 0 for a broken one
+    size_t decode(const char* _data, size_t _size, uint32_t& _code_point)
+    {
+        const auto lead = static_cast<unsigned char>(_data[0]);
+
+        size_t length = 0;
+        if (lead < 0x80)
+        {
+            _code_point = lead;
+            return 1;
+        }
+        else if ((lead & 0xE0) == 0xC0)
+        {
+            length = 2;
+            _code_point = (lead & 0x1F);
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            _code_point = (lead & 0x0F);
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            length = 4;
+            _code_point = (lead & 0x07);
+        }
+        else
+        {
+            return 0;
+        }
+
+        if (length > _size)
+            return 0;
+
+        for (size_t i = 1; i < length; ++i)
+        {
+            const auto next = static_cast<unsigned char>(_data[i]);
+            if ((next & 0xC0) != 0x80)
+                return 0;
+
+            _code_point = (_code_point << 6) | (next & 0x3F);
+        }
+
+        const auto is_overlong = (length == 2 && _code_point < 0x80) || (length == 3 && _code_point < 0x800) || (length == 4 && _code_point < 0x10000);
+        if (is_overlong || _code_point > 0x10FFFF)
+            return 0;
+
+        return length;
+    }
+
+    size_t encoded_size(uint32_t _code_point)
+    {
+        if (_code_point < 0x80)
+            return 1;
+        if (_code_point < 0x800)
+            return 2;
+        if (_code_point < 0x10000)
+            return 3;
+        return 4;
+    }
+
+    void encode(uint32_t _code_point, char* _out)
+    {
+        switch (encoded_size(_code_point))
+        {
+        case 1:
+            _out[0] = static_cast<char>(_code_point);
+            break;
+        case 2:
+            _out[0] = static_cast<char>(0xC0 | (_code_point >> 6));
+            _out[1] = static_cast<char>(0x80 | (_code_point & 0x3F));
+            break;
+        case 3:
+            _out[0] = static_cast<char>(0xE0 | (_code_point >> 12));
+            _out[1] = static_cast<char>(0x80 | ((_code_point >> 6) & 0x3F));
+            _out[2] = static_cast<char>(0x80 | (_code_point & 0x3F));
+            break;
+        default:
+            _out[0] = static_cast<char>(0xF0 | (_code_point >> 18));
+            _out[1] = static_cast<char>(0x80 | ((_code_point >> 12) & 0x3F));
+            _out[2] = static_cast<char>(0x80 | ((_code_point >> 6) & 0x3F));
+            _out[3] = static_cast<char>(0x80 | (_code_point & 0x3F));
+            break;
+        }
+    }
+
+    template <bool _upper>
+    void append_folded(std::string& _out, const char* _data, size_t _size)
+    {
+        for (size_t i = 0; i < _size;)
+        {
+            uint32_t code_point = 0;
+            const auto length = decode(_data + i, _size - i, code_point);
+            if (length == 0)
+            {
+                _out.push_back(_data[i++]);
+                continue;
+            }
+
+            char buffer[4];
+            const auto folded = fold<_upper>(code_point);
+            encode(folded, buffer);
+
+            _out.append(buffer, encoded_size(folded));
+            i += length;
+        }
+    }
+
+    template <bool _upper>
+    void fold_in_place(std::string& _str)
+    {
+        if (_str.empty())
+            return;
+
+        auto data = &_str[0];
+        const auto size = _str.size();
+
+        size_t read = 0;
+        size_t write = 0;
+
+        while (read < size)
+        {
+            if (!(data[read] & 0x80))
+            {
+                const auto run = fold_ascii<_upper>(data + read, size - read);
+                if (write != read)
+                    memmove(data + write, data + read, run);
+
+                read += run;
+                write += run;
+                continue;
+            }
+
+            uint32_t code_point = 0;
+            const auto length = decode(data + read, size - read, code_point);
+            if (length == 0)
+            {
+                data[write++] = data[read++];
+                continue;
+            }
+
+            const auto folded = fold<_upper>(code_point);
+            const auto folded_length = encoded_size(folded);
+
+            // the rest does not fit into the place left, it goes to a new string
+            if (write + folded_length > read + length)
+            {
+                std::string result(data, write);
+                result.reserve(size + size / 4);
+                append_folded<_upper>(result, data + read, size - read);
+
+                _str.swap(result);
+                return;
+            }
+
+            encode(folded, data + write);
+
+            read += length;
+            write += folded_length;
+        }
+
+        _str.resize(write);
+    }
+
+    template <bool _upper>
+    std::string fold_copy(const char* _data, size_t _size)
+    {
+        std::string result(_data, _size);
+        fold_in_place<_upper>(result);
+
+        return result;
+    }
+}
+
+namespace core
+{
+    namespace tools
+    {
+        namespace case_fold
+        {
+            uint32_t to_upper(uint32_t _code_point)
+            {
+                return fold<true>(_code_point);
+            }
+
+            uint32_t to_lower(uint32_t _code_point)
+            {
+                return fold<false>(_code_point);
+            }
+
+            void to_upper(std::string& _str)
+            {
+                fold_in_place<true>(_str);
+            }
+
+            void to_lower(std::string& _str)
+            {
+                fold_in_place<false>(_str);
+            }
+
+            std::string to_upper(const char* _data, size_t _size)
+            {
+                return fold_copy<true>(_data, _size);
+            }
+
+            std::string to_lower(const char* _data, size_t _size)
+            {
+                return fold_copy<false>(_data, _size);
+            }
+
+            bool is_ascii(const char* _data, size_t _size)
+            {
+                size_t i = 0;
+
+                uint64_t accumulated = 0;
+                for (; i + sizeof(uint64_t) <= _size; i += sizeof(uint64_t))
+                {
+                    uint64_t chunk;
+                    memcpy(&chunk, _data + i, sizeof(chunk));
+                    accumulated |= chunk;
+                }
+
+                for (; i < _size; ++i)
+                    accumulated |= static_cast<unsigned char>(_data[i]);
+
+                return !(accumulated & high_bits);
+            }
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace core
+{
+    namespace tools
+    {
+        // UTF-8 case conversion without going through std::wstring:
+        // ascii runs are converted eight bytes at a time, the code points up to 0xFFFF
+        // (the sequences of up to three bytes) by a table, the rest by towupper/towlower
+        namespace case_fold
+        {
+            uint32_t to_upper(uint32_t _code_point);
+            uint32_t to_lower(uint32_t _code_point);
+
+            // in place, the string is reallocated only if a code point changes its encoded length
+            void to_upper(std::string& _str);
+            void to_lower(std::string& _str);
+
+            std::string to_upper(const char* _data, size_t _size);
+            std::string to_lower(const char* _data, size_t _size);
+
+            bool is_ascii(const char* _data, size_t _size);
+        }
+    }
+}
@@ -0,0 +1,233 @@
+#include "stdafx.h"
+
+#include "metrics.h"
+
+namespace
+{
+    struct registry
+    {
+        boost::mutex mutex_;
+
+        std::map<std::string, std::unique_ptr<core::metrics::counter>> counters_;
+        std::map<std::string, std::unique_ptr<core::metrics::histogram>> histograms_;
+    };
+
+    registry& get_registry()
+    {
+        static registry instance;
+        return instance;
+    }
+
+    size_t get_highest_bit(uint64_t _value)
+    {
+        size_t result = 0;
+
+        for (size_t shift = 32; shift > 0; shift /= 2)
+        {
+            if (_value >> shift)
+            {
+                _value >>= shift;
+                result += shift;
+            }
+        }
+
+        return result;
+    }
+
+    void update_max(std::atomic<uint64_t>& _max, uint64_t _value)
+    {
+        auto current = _max.load(std::memory_order_relaxed);
+        while (current < _value && !_max.compare_exchange_weak(current, _value, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+namespace core
+{
+    namespace metrics
+    {
+        counter::counter()
+            : value_(0)
+        {
+        }
+
+        void counter::add(int64_t _value)
+        {
+            value_.fetch_add(_value, std::memory_order_relaxed);
+        }
+
+        void counter::set(int64_t _value)
+        {
+            value_.store(_value, std::memory_order_relaxed);
+        }
+
+        int64_t counter::get() const
+        {
+            return value_.load(std::memory_order_relaxed);
+        }
+
+        histogram_snapshot::histogram_snapshot()
+            : count_(0)
+            , sum_(0)
+            , max_(0)
+        {
+        }
+
+        uint64_t histogram_snapshot::get_percentile(double _percent) const
+        {
+            if (count_ == 0)
+                return 0;
+
+            const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(_percent / 100.0 * count_)));
+
+            uint64_t seen = 0;
+            for (size_t i = 0; i < buckets_.size(); ++i)
+            {
+                seen += buckets_[i];
+                if (seen >= rank)
+                    return std::min(histogram::get_bucket_high(i), max_);
+            }
+
+            return max_;
+        }
+
+        uint64_t histogram_snapshot::get_mean() const
+        {
+            return (count_ == 0 ? 0 : sum_ / count_);
+        }
+
+        histogram::histogram()
+            : count_(0)
+            , sum_(0)
+            , max_(0)
+        {
+            for (auto& bucket : buckets_)
+                bucket.store(0, std::memory_order_relaxed);
+        }
+
+        void histogram::record(uint64_t _value)
+        {
+            buckets_[get_bucket_index(_value)].fetch_add(1, std::memory_order_relaxed);
+
+            count_.fetch_add(1, std::memory_order_relaxed);
+            sum_.fetch_add(_value, std::memory_order_relaxed);
+
+            update_max(max_, _value);
+        }
+
+        void histogram::record(std::chrono::steady_clock::duration _duration)
+        {
+            const auto us = std::chrono::duration_cast<std::chrono::microseconds>(_duration).count();
+
+            record(static_cast<uint64_t>(std::max<int64_t>(us, 0)));
+        }
+
+        histogram_snapshot histogram::get_snapshot() const
+        {
+            histogram_snapshot snapshot;
+            snapshot.buckets_.reserve(buckets_count);
+
+            // the buckets are not read atomically as a whole, the count is taken from them to stay consistent
+            for (const auto& bucket : buckets_)
+            {
+                const auto value = bucket.load(std::memory_order_relaxed);
+                snapshot.buckets_.push_back(value);
+                snapshot.count_ += value;
+            }
+
+            snapshot.sum_ = sum_.load(std::memory_order_relaxed);
+            snapshot.max_ = max_.load(std::memory_order_relaxed);
+
+            return snapshot;
+        }
+
+        size_t histogram::get_bucket_index(uint64_t _value)
+        {
+            const uint64_t max_value = (1ull << max_value_bits) - 1;
+            _value = std::min(_value, max_value);
+
+            if (_value < 2 * sub_bucket_count)
+                return static_cast<size_t>(_value);
+
+            const auto shift = get_highest_bit(_value) - sub_bucket_bits;
+
+            return shift * sub_bucket_count + static_cast<size_t>(_value >> shift);
+        }
+
+        uint64_t histogram::get_bucket_high(size_t _index)
+        {
+            if (_index < 2 * sub_bucket_count)
+                return _index;
+
+            const auto shift = _index / sub_bucket_count - 1;
+            const uint64_t top = _index % sub_bucket_count + sub_bucket_count;
+
+            return ((top + 1) << shift) - 1;
+        }
+
+        auto_timer::auto_timer(histogram& _histogram)
+            : histogram_(_histogram)
+            , start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        auto_timer::~auto_timer()
+        {
+            histogram_.record(std::chrono::steady_clock::now() - start_);
+        }
+
+        counter& get_counter(const char* _name)
+        {
+            auto& reg = get_registry();
+
+            boost::lock_guard<boost::mutex> lock(reg.mutex_);
+
+            auto& result = reg.counters_[_name];
+            if (!result)
+                result = std::make_unique<counter>();
+
+            return *result;
+        }
+
+        histogram& get_histogram(const char* _name)
+        {
+            auto& reg = get_registry();
+
+            boost::lock_guard<boost::mutex> lock(reg.mutex_);
+
+            auto& result = reg.histograms_[_name];
+            if (!result)
+                result = std::make_unique<histogram>();
+
+            return *result;
+        }
+
+        std::string dump()
+        {
+            auto& reg = get_registry();
+
+            std::stringstream ss;
+
+            boost::lock_guard<boost::mutex> lock(reg.mutex_);
+
+            for (const auto& item : reg.counters_)
+                ss << item.first << ": " << item.second->get() << "\r\n";
+
+            for (const auto& item : reg.histograms_)
+            {
+                const auto snapshot = item.second->get_snapshot();
+
+                ss << item.first << " (us): count=" << snapshot.count_
+                    << " mean=" << snapshot.get_mean()
+                    << " p50=" << snapshot.get_percentile(50)
+                    << " p90=" << snapshot.get_percentile(90)
+                    << " p99=" << snapshot.get_percentile(99)
+                    << " p999=" << snapshot.get_percentile(99.9)
+                    << " max=" << snapshot.max_ << "\r\n";
+            }
+
+            return ss.str();
+        }
+    }
+}
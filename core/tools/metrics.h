@@ -0,0 +1,89 @@
+#pragma once
+
+namespace core
+{
+    namespace metrics
+    {
+        // all metrics are registered once and live until the process exits,
+        // updates are lock-free and may come from any thread
+
+        // a counter which is set instead of added to works as a gauge
+        class counter : boost::noncopyable
+        {
+        public:
+            counter();
+
+            void add(int64_t _value = 1);
+            void set(int64_t _value);
+
+            int64_t get() const;
+
+        private:
+            std::atomic<int64_t> value_;
+        };
+
+        struct histogram_snapshot
+        {
+            histogram_snapshot();
+
+            uint64_t get_percentile(double _percent) const;
+            uint64_t get_mean() const;
+
+            uint64_t count_;
+            uint64_t sum_;
+            uint64_t max_;
+
+            std::vector<uint64_t> buckets_;
+        };
+
+        // latency histogram in microseconds with hdr-style buckets:
+        // every power of two is split into 16 linear sub-buckets,
+        // so a reported value is off by no more than 1/16
+        class histogram : boost::noncopyable
+        {
+        public:
+            static const size_t sub_bucket_bits = 4;
+            static const size_t sub_bucket_count = (1 << sub_bucket_bits);
+            static const size_t max_value_bits = 40;
+            static const size_t buckets_count = 2 * sub_bucket_count + (max_value_bits - sub_bucket_bits - 1) * sub_bucket_count;
+
+            histogram();
+
+            void record(uint64_t _value);
+            void record(std::chrono::steady_clock::duration _duration);
+
+            histogram_snapshot get_snapshot() const;
+
+            static size_t get_bucket_index(uint64_t _value);
+
+            // the highest value which falls into the bucket
+            static uint64_t get_bucket_high(size_t _index);
+
+        private:
+            std::array<std::atomic<uint64_t>, buckets_count> buckets_;
+
+            std::atomic<uint64_t> count_;
+            std::atomic<uint64_t> sum_;
+            std::atomic<uint64_t> max_;
+        };
+
+        class auto_timer : boost::noncopyable
+        {
+        public:
+            explicit auto_timer(histogram& _histogram);
+            ~auto_timer();
+
+        private:
+            histogram& histogram_;
+
+            const std::chrono::steady_clock::time_point start_;
+        };
+
+        // keep the returned reference in a function-local static, lookups take a lock
+        counter& get_counter(const char* _name);
+        histogram& get_histogram(const char* _name);
+
+        // one line per metric, sorted by name
+        std::string dump();
+    }
+}
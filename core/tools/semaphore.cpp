@@ -27,4 +27,15 @@ void semaphore::wait()
 
     cv_.wait(lock, [&]{ return count_ > 0; });
     --count_;
+}
+
+bool semaphore::wait_for(std::chrono::milliseconds _timeout)
+{
+    boost::unique_lock<boost::mutex> lock(mtx_);
+
+    if (!cv_.wait_for(lock, boost::chrono::milliseconds(_timeout.count()), [&]{ return count_ > 0; }))
+        return false;
+
+    --count_;
+    return true;
 }
\ No newline at end of file
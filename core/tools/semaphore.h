@@ -20,6 +20,9 @@ namespace core
             void notify();
             void wait();
 
+            // false if the count stayed zero for the whole _timeout
+            bool wait_for(std::chrono::milliseconds _timeout);
+
             semaphore(unsigned long count = 0);
             virtual ~semaphore();
         };
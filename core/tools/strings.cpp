@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "strings.h"
 #include "system.h"
+#include "case_fold.h"
 
 #include <codecvt>
 #include <locale>
@@ -288,8 +289,8 @@ namespace core
 
             std::string str(_str, _str + _length);
 
-            auto lower = system::to_lower(str);
-            auto upper = system::to_upper(str);
+            auto lower = case_fold::to_lower(_str, _length);
+            auto upper = case_fold::to_upper(_str, _length);
 
             if (lower.empty() || (lower.size() == 1 && lower[0] == '\0'))
                 lower = std::move(str);
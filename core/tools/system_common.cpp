@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "system.h"
+#include "case_fold.h"
 
 #include "../../external/minizip/unzip.h"
 
@@ -329,4 +330,18 @@ namespace core { namespace tools { namespace system {
             ? static_cast<size_t>(file.tellg())
             : 0;
     }
+
+    std::string to_upper(const std::string& str)
+    {
+        std::string upper(str);
+        case_fold::to_upper(upper);
+        return upper;
+    }
+
+    std::string to_lower(const std::string& str)
+    {
+        std::string lower(str);
+        case_fold::to_lower(lower);
+        return lower;
+    }
 }}}
@@ -2,6 +2,7 @@
 #include "threadpool.h"
 
 #include "../utils.h"
+#include "metrics.h"
 
 #ifdef _WIN32
     #include "../common.shared/win32/crash_handler.h"
@@ -42,8 +43,16 @@ threadpool::threadpool(const unsigned count, std::function<void()> _on_thread_ex
     }
 }
 
+threadpool::queued_task::queued_task(task _task)
+    : task_(std::move(_task))
+    , queued_(std::chrono::steady_clock::now())
+{
+}
+
 bool threadpool::run_task_impl()
 {
+    static auto& queue_wait = metrics::get_histogram("threadpool.queue_wait");
+
     task nextTask;
 
     {
@@ -59,7 +68,9 @@ bool threadpool::run_task_impl()
             return false;
         }
 
-        nextTask = tasks_.front();
+        nextTask = std::move(tasks_.front().task_);
+        queue_wait.record(std::chrono::steady_clock::now() - tasks_.front().queued_);
+
         tasks_.pop_front();
     }
     if (nextTask)
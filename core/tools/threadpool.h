@@ -28,7 +28,16 @@ namespace core
             std::vector<std::thread::id> threads_ids_;
             boost::mutex queue_mutex_;
             boost::condition_variable condition_;
-            std::deque<task> tasks_;
+
+            struct queued_task
+            {
+                queued_task(task _task);
+
+                task task_;
+                std::chrono::steady_clock::time_point queued_;
+            };
+
+            std::deque<queued_task> tasks_;
             std::atomic<bool> stop_;
 
             bool run_task_impl();
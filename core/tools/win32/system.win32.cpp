@@ -131,16 +131,6 @@ std::wstring get_user_downloads_dir()
 	return cached_path;
 }
 
-std::string to_upper(const std::string& str)
-{
-    return boost::locale::to_upper(str);
-}
-
-std::string to_lower(const std::string& str)
-{
-    return boost::locale::to_lower(str);
-}
-
 namespace
 {
 	std::wstring get_user_downloads_dir_xp()
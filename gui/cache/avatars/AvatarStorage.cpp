@@ -12,51 +12,76 @@ namespace
 {
     QString CreateKey(const QString& _aimId, const int _sizePx);
 
+    QString CreateRoundedKey(const QString& _aimId, const int _sizePx, const QString& _state, const bool _miniIcons);
+
+    int GetPixmapBytes(const QPixmap& _pixmap);
+
     static int CLEANUP_TIMEOUT = 5 * 60 * 1000; //5min
 
     static int CREATE_TIMEOUT = 2 * 60 * 1000; //2min
 
     static int REQUEST_TIMEOUT = 15 * 1000; //15 sec
+
+    // loaded, scaled and rounded avatars together
+    const qint64 MAX_CACHE_BYTES = 64 * 1024 * 1024;
+
+    // rounded avatars of one task, a scroll of the contact list is split between a few threads
+    const size_t ROUND_BATCH_SIZE = 8;
+
+    // results of all tasks in flight come within one repaint of the views
+    const int NOTIFY_ROUNDED_TIMEOUT = 16;
 }
 
 namespace Logic
 {
     AvatarStorage::AvatarStorage()
-        : Timer_(new QTimer(this))
+        : CacheBytes_(0)
+        , RoundTicket_(0)
+        , Timer_(new QTimer(this))
+        , RoundTimer_(new QTimer(this))
+        , NotifyTimer_(new QTimer(this))
     {
         Timer_->setSingleShot(false);
         Timer_->setInterval(CLEANUP_TIMEOUT);
         Timer_->start();
 
+        RoundTimer_->setSingleShot(true);
+        RoundTimer_->setInterval(0);
+
+        NotifyTimer_->setSingleShot(true);
+        NotifyTimer_->setInterval(NOTIFY_ROUNDED_TIMEOUT);
+
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::avatarLoaded, this, &AvatarStorage::avatarLoaded, Qt::QueuedConnection);
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::avatarUpdated, this, [this](const QString& contact) {
             updateAvatar(contact);
         }, Qt::QueuedConnection);
         connect(Ui::GetDispatcher(), &Ui::core_dispatcher::chatInfo, this, &AvatarStorage::chatInfo, Qt::QueuedConnection);
         connect(Timer_, &QTimer::timeout, this, &AvatarStorage::cleanup, Qt::QueuedConnection);
+        connect(RoundTimer_, &QTimer::timeout, this, &AvatarStorage::startRounding);
+        connect(NotifyTimer_, &QTimer::timeout, this, &AvatarStorage::notifyRounded);
     }
 
     AvatarStorage::~AvatarStorage()
     {
     }
 
-    const QPixmapSCptr& AvatarStorage::Get(const QString& _aimId, const QString& _displayName, const int _sizePx, bool& _isDefault, bool _regenerate)
+    QPixmapSCptr AvatarStorage::Get(const QString& _aimId, const QString& _displayName, const int _sizePx, bool& _isDefault, bool _regenerate)
     {
         assert(_sizePx > 0);
 
-        TimesCache_[_aimId] = QDateTime::currentDateTime();
+        TimesCache_[_aimId] = QDateTime::currentDateTimeUtc();
 
         Out _isDefault = !LoadedAvatars_.contains(_aimId);
         const auto key = CreateKey(_aimId, _sizePx);
 
-        auto iterByAimIdAndSize = AvatarsByAimIdAndSize_.find(key);
-        if (iterByAimIdAndSize != AvatarsByAimIdAndSize_.end())
+        auto avatarByAimIdAndSize = Find(key);
+        if (avatarByAimIdAndSize)
         {
-            return iterByAimIdAndSize->second;
+            return avatarByAimIdAndSize;
         }
 
-        auto iterByAimId = AvatarsByAimId_.find(_aimId);
-        if (iterByAimId == AvatarsByAimId_.end())
+        auto avatarByAimId = Find(_aimId);
+        if (!avatarByAimId)
         {
             auto drawDisplayName = _displayName.trimmed();
             if (drawDisplayName.isEmpty())
@@ -67,39 +92,35 @@ namespace Logic
             auto defaultAvatar = Utils::getDefaultAvatar(_aimId, drawDisplayName, _sizePx);
             assert(defaultAvatar);
 
-            const auto result = AvatarsByAimId_.emplace(_aimId, std::make_shared<QPixmap>(std::move(defaultAvatar)));
-            assert(result.second);
-
-            iterByAimId = result.first;
+            avatarByAimId = std::make_shared<QPixmap>(std::move(defaultAvatar));
+            Insert(_aimId, _aimId, avatarByAimId);
         }
 
-        const auto &avatarByAimId = *iterByAimId->second;
-        assert(!avatarByAimId.isNull());
+        assert(!avatarByAimId->isNull());
 
-        const auto regenerateAvatar = ((avatarByAimId.width() < _sizePx) && _isDefault) && _aimId != _displayName;
+        const auto regenerateAvatar = ((avatarByAimId->width() < _sizePx) && _isDefault) && _aimId != _displayName;
         if (regenerateAvatar || _regenerate)
         {
-            AvatarsByAimId_.erase(iterByAimId);
+            Remove(_aimId);
             CleanupSecondaryCaches(_aimId);
-            return Get(_aimId, _displayName, _sizePx, _isDefault, _regenerate);
+            return Get(_aimId, _displayName, _sizePx, _isDefault, false);
         }
 
-        int avatarWidth = avatarByAimId.width();
-        int avatarHeight = avatarByAimId.height();
+        int avatarWidth = avatarByAimId->width();
+        int avatarHeight = avatarByAimId->height();
         QPixmap scaledImage;
         if (avatarHeight >= avatarWidth)
-            scaledImage = avatarByAimId.scaledToWidth(_sizePx, Qt::SmoothTransformation);
+            scaledImage = avatarByAimId->scaledToWidth(_sizePx, Qt::SmoothTransformation);
         else
-            scaledImage = avatarByAimId.scaledToHeight(_sizePx, Qt::SmoothTransformation);
+            scaledImage = avatarByAimId->scaledToHeight(_sizePx, Qt::SmoothTransformation);
 
-        const auto result = AvatarsByAimIdAndSize_.emplace(key, std::make_shared<QPixmap>(std::move(scaledImage)));
-        assert(result.second);
+        avatarByAimIdAndSize = std::make_shared<QPixmap>(std::move(scaledImage));
+        Insert(key, _aimId, avatarByAimIdAndSize);
 
         if (_aimId == ql1s("mail"))
-            return result.first->second;
+            return avatarByAimIdAndSize;
 
-        auto requestedAvatarsIter = RequestedAvatars_.find(_aimId);
-        if (requestedAvatarsIter == RequestedAvatars_.end() || (avatarByAimId.width() < _sizePx && avatarByAimId.height() < _sizePx))
+        if (!RequestedAvatars_.contains(_aimId) || (avatarByAimId->width() < _sizePx && avatarByAimId->height() < _sizePx))
         {
             Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
             collection.set_value_as_qstring("contact", _aimId);
@@ -118,26 +139,25 @@ namespace Logic
             Ui::GetDispatcher()->post_message_to_core(qsl("avatars/show"), collection.get());
         }
 
-        return result.first->second;
+        return avatarByAimIdAndSize;
     }
 
     void AvatarStorage::SetAvatar(const QString& _aimId, const QPixmap& _pixmap)
     {
         assert(!_aimId.isEmpty());
 
-        auto iter = AvatarsByAimId_.find(_aimId);
-        if (iter == AvatarsByAimId_.end())
+        const auto avatar = Find(_aimId);
+        if (!avatar)
             return;
 
-        const auto size = iter->second->height();
+        const auto size = avatar->height();
         auto scaled = _pixmap.scaled(size, size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
 
-        AvatarsByAimId_[_aimId] = std::make_shared<QPixmap>(std::move(scaled));
+        Insert(_aimId, _aimId, std::make_shared<QPixmap>(std::move(scaled)));
 
         CleanupSecondaryCaches(_aimId);
 
-        LoadedAvatars_.removeAll(_aimId);
-        LoadedAvatars_ << _aimId;
+        LoadedAvatars_.insert(_aimId);
 
         emit avatarChanged(_aimId);
     }
@@ -147,23 +167,19 @@ namespace Logic
         if (!force && LoadedAvatars_.contains(_aimId))
             return;
 
-        if (TimesCache_.find(_aimId) != TimesCache_.end())
+        if (TimesCache_.contains(_aimId))
         {
-            auto iter = AvatarsByAimId_.find(_aimId);
-            if (iter != AvatarsByAimId_.end())
+            const auto iter = CacheIndex_.constFind(_aimId);
+            if (iter != CacheIndex_.cend())
             {
                 Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
                 collection.set_value_as_qstring("contact", _aimId);
-                collection.set_value_as_int("size", iter->second->height());
+                collection.set_value_as_int("size", iter.value()->Pixmap_->height());
                 collection.set_value_as_bool("force", true);
                 Ui::GetDispatcher()->post_message_to_core(qsl("avatars/get"), collection.get());
             }
 
-            AvatarsByAimId_.erase(_aimId);
-            CleanupSecondaryCaches(_aimId);
-            RequestedAvatars_.erase(_aimId);
-            LoadedAvatars_.removeAll(_aimId);
-            TimesCache_.erase(_aimId);
+            RemoveAvatar(_aimId);
         }
     }
 
@@ -176,18 +192,59 @@ namespace Logic
         Ui::GetDispatcher()->post_message_to_core(qsl("avatars/get"), collection.get());
     }
 
-    const QPixmapSCptr& AvatarStorage::GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, bool& _isDefault, bool _regenerate, bool mini_icons)
+    QPixmapSCptr AvatarStorage::GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, bool& _isDefault, bool _regenerate, bool mini_icons)
     {
         assert(_sizePx > 0);
 
-        const auto &avatar = Get(_aimId, _displayName, _sizePx, _isDefault, _regenerate);
+        const auto avatar = Get(_aimId, _displayName, _sizePx, _isDefault, _regenerate);
         if (avatar->isNull())
         {
             assert(!"avatar is null");
             return avatar;
         }
 
-        return GetRounded(*avatar, _aimId, _state, mini_icons, _isDefault);
+        return GetRounded(*avatar, _aimId, _state, mini_icons);
+    }
+
+    QPixmapSCptr AvatarStorage::GetRoundedAsync(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, bool& _isDefault, bool mini_icons)
+    {
+        assert(_sizePx > 0);
+
+        const auto avatar = Get(_aimId, _displayName, _sizePx, _isDefault, false);
+        if (avatar->isNull())
+        {
+            assert(!"avatar is null");
+            return avatar;
+        }
+
+        const auto key = CreateRoundedKey(_aimId, avatar->width(), _state, mini_icons);
+
+        auto rounded = Find(key);
+        if (rounded)
+        {
+            return rounded;
+        }
+
+        if (!RoundingKeys_.contains(key))
+        {
+            const auto ticket = ++RoundTicket_;
+            RoundingKeys_.insert(key, ticket);
+            RoundQueue_.push_back(RoundAvatarJob{ ticket, key, _aimId, avatar->toImage(), _state, mini_icons });
+
+            if (!RoundTimer_->isActive())
+                RoundTimer_->start();
+        }
+
+        // the state has changed, keep showing the previous one until the new one is ready
+        const auto prefix = CreateKey(_aimId, avatar->width()) % ql1c('/');
+        for (const auto& otherKey : KeysByAimId_.value(_aimId))
+        {
+            if (otherKey.startsWith(prefix))
+                return CacheIndex_.value(otherKey)->Pixmap_;
+        }
+
+        static const QPixmapSCptr empty = std::make_shared<QPixmap>();
+        return empty;
     }
 
     QString AvatarStorage::GetLocal(const QString& _aimId, const QString& _displayName, const int _sizePx)
@@ -224,7 +281,7 @@ namespace Logic
         {
             if (!LoadedAvatarsFails_.contains(_aimId))
             {
-                LoadedAvatarsFails_ << _aimId;
+                LoadedAvatarsFails_.insert(_aimId);
                 Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
                 collection.set_value_as_qstring("contact", _aimId);
                 collection.set_value_as_int("size", _size);
@@ -237,24 +294,15 @@ namespace Logic
         }
 
         assert(!_aimId.isEmpty());
-        LoadedAvatarsFails_.removeAll(_aimId);
+        LoadedAvatarsFails_.remove(_aimId);
 
         QPixmapSCptr avatar(_pixmap);
         auto scaledImage = avatar->scaled(_size, _size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-        QPixmapSCptr cache = std::make_shared<QPixmap>(std::move(scaledImage));
-        auto iterPixmap = AvatarsByAimId_.find(_aimId);
-        if (iterPixmap != AvatarsByAimId_.end())
-        {
-            iterPixmap->second = cache;
-        }
-        else
-        {
-            AvatarsByAimId_.emplace(_aimId, cache);
-        }
+        Insert(_aimId, _aimId, std::make_shared<QPixmap>(std::move(scaledImage)));
 
         CleanupSecondaryCaches(_aimId);
 
-        LoadedAvatars_ << _aimId;
+        LoadedAvatars_.insert(_aimId);
 
         emit avatarChanged(_aimId);
     }
@@ -289,100 +337,212 @@ namespace Logic
         if (LoadedAvatars_.contains(_aimId))
             return;
 
-        if (AvatarsByAimId_.find(_aimId) != AvatarsByAimId_.end())
-            AvatarsByAimId_.erase(_aimId);
+        Remove(_aimId);
         CleanupSecondaryCaches(_aimId);
         emit avatarChanged(_aimId);
     }
 
     void AvatarStorage::cleanup()
     {
-        const QDateTime now = QDateTime::currentDateTime();
+        const QDateTime now = QDateTime::currentDateTimeUtc();
         auto historyPage = Utils::InterConnector::instance().getHistoryPage(Logic::getContactListModel()->selectedContact());
-        for (auto iter = TimesCache_.begin(); iter != TimesCache_.end();)
+
+        QStringList expired;
+        for (auto iter = TimesCache_.begin(); iter != TimesCache_.end(); ++iter)
         {
-            if (iter->second.msecsTo(now) >= CLEANUP_TIMEOUT)
-            {
-                auto aimId = iter->first;
-                if (Logic::getContactListModel()->contains(aimId) || (historyPage && historyPage->contains(aimId)))
-                {
-                    iter->second = now;
-                    ++iter;
-                    continue;
-                }
-
-                AvatarsByAimId_.erase(aimId);
-                CleanupSecondaryCaches(aimId);
-                RequestedAvatars_.erase(aimId);
-                LoadedAvatars_.removeAll(aimId);
-                iter = TimesCache_.erase(iter);
-            }
-            else
+            if (iter.value().msecsTo(now) < CLEANUP_TIMEOUT)
+                continue;
+
+            const auto& aimId = iter.key();
+            if (Logic::getContactListModel()->contains(aimId) || (historyPage && historyPage->contains(aimId)))
             {
-                ++iter;
+                iter.value() = now;
+                continue;
             }
+
+            expired << aimId;
         }
+
+        for (const auto& aimId : expired)
+            RemoveAvatar(aimId);
     }
 
-    // TODO : use two-step hash here
-    void AvatarStorage::CleanupSecondaryCaches(const QString& _aimId)
+    void AvatarStorage::startRounding()
     {
-        const auto cleanupSecondaryCache = [&_aimId](CacheMap &cache)
+        for (size_t i = 0; i < RoundQueue_.size(); i += ROUND_BATCH_SIZE)
         {
-            for (auto i = cache.begin(); i != cache.end(); ++i)
-            {
-                const auto &key = i->first;
-                if (!key.startsWith(_aimId))
-                {
-                    continue;
-                }
-
-                for(;;)
-                {
-                    i = cache.erase(i);
-
-                    if (i == cache.end())
-                    {
-                        break;
-                    }
-
-                    const auto &k = i->first;
-                    if (!k.startsWith(_aimId))
-                    {
-                        break;
-                    }
-                }
+            const auto first = RoundQueue_.begin() + i;
+            const auto last = RoundQueue_.begin() + std::min(i + ROUND_BATCH_SIZE, RoundQueue_.size());
+
+            auto task = new RoundAvatarTask(std::vector<RoundAvatarJob>(std::make_move_iterator(first), std::make_move_iterator(last)));
+
+            const auto succeed = QObject::connect(
+                task, &RoundAvatarTask::roundedSignal,
+                this, &AvatarStorage::avatarRounded
+            );
+            assert(succeed);
+            (void)succeed;
+
+            QThreadPool::globalInstance()->start(task);
+        }
+
+        RoundQueue_.clear();
+    }
+
+    void AvatarStorage::avatarRounded(quint64 _ticket, const QString& _key, const QString& _aimId, const QImage& _rounded)
+    {
+        // the avatar has been changed or dropped while this one was rendered
+        const auto iter = RoundingKeys_.find(_key);
+        if (iter == RoundingKeys_.end() || iter.value() != _ticket)
+            return;
+
+        RoundingKeys_.erase(iter);
+
+        QPixmap rounded = QPixmap::fromImage(_rounded);
+        Utils::check_pixel_ratio(rounded);
+
+        Insert(_key, _aimId, std::make_shared<QPixmap>(std::move(rounded)));
+
+        RoundedAimIds_.insert(_aimId);
+        if (!NotifyTimer_->isActive())
+            NotifyTimer_->start();
+    }
+
+    void AvatarStorage::notifyRounded()
+    {
+        const auto aimIds = RoundedAimIds_;
+        RoundedAimIds_.clear();
+
+        for (const auto& aimId : aimIds)
+            emit avatarChanged(aimId);
+    }
+
+    QPixmapSCptr AvatarStorage::Find(const QString& _key)
+    {
+        const auto iter = CacheIndex_.constFind(_key);
+        if (iter == CacheIndex_.cend())
+            return QPixmapSCptr();
+
+        const auto entry = iter.value();
+
+        // scaled and rounded avatars are made from the loaded one, it is as recently used as they are
+        if (entry->Key_ != entry->AimId_)
+        {
+            const auto source = CacheIndex_.constFind(entry->AimId_);
+            if (source != CacheIndex_.cend())
+                Cache_.splice(Cache_.end(), Cache_, source.value());
+        }
+
+        Cache_.splice(Cache_.end(), Cache_, entry);
+
+        return entry->Pixmap_;
+    }
+
+    void AvatarStorage::Insert(const QString& _key, const QString& _aimId, QPixmapSCptr _pixmap)
+    {
+        assert(_pixmap);
+
+        Remove(_key);
+
+        const auto bytes = GetPixmapBytes(*_pixmap);
+
+        Cache_.push_back(CacheEntry{ _key, _aimId, std::move(_pixmap), bytes });
+        CacheIndex_.insert(_key, std::prev(Cache_.end()));
+        KeysByAimId_[_aimId].insert(_key);
+        CacheBytes_ += bytes;
+
+        Evict();
+    }
+
+    void AvatarStorage::Remove(const QString& _key)
+    {
+        const auto iter = CacheIndex_.find(_key);
+        if (iter == CacheIndex_.end())
+            return;
+
+        const auto entry = iter.value();
+        CacheIndex_.erase(iter);
+
+        const auto keys = KeysByAimId_.find(entry->AimId_);
+        if (keys != KeysByAimId_.end())
+        {
+            keys->remove(_key);
+            if (keys->isEmpty())
+                KeysByAimId_.erase(keys);
+        }
+
+        CacheBytes_ -= entry->Bytes_;
+        Cache_.erase(entry);
+    }
 
+    void AvatarStorage::RemoveAvatar(const QString& _aimId)
+    {
+        Remove(_aimId);
+        CleanupSecondaryCaches(_aimId);
+        RequestedAvatars_.remove(_aimId);
+        LoadedAvatars_.remove(_aimId);
+        TimesCache_.remove(_aimId);
+    }
+
+    void AvatarStorage::Evict()
+    {
+        // the newest entry is kept even if it does not fit
+        while (CacheBytes_ > MAX_CACHE_BYTES && Cache_.size() > 1)
+        {
+            // a loaded avatar goes only after all the avatars made from it, it has to be requested again
+            const auto newest = std::prev(Cache_.end());
+            auto victim = Cache_.begin();
+            while (victim != newest && victim->Key_ == victim->AimId_ && KeysByAimId_.value(victim->AimId_).size() > 1)
+                ++victim;
+
+            if (victim == newest)
                 break;
-            }
-        };
 
-        cleanupSecondaryCache(RoundedAvatarsByAimIdAndSize_);
-        cleanupSecondaryCache(AvatarsByAimIdAndSize_);
+            const auto key = victim->Key_;
+            const auto aimId = victim->AimId_;
+
+            if (key == aimId)
+                RemoveAvatar(aimId);
+            else
+                Remove(key);
+        }
     }
 
-    const QPixmapSCptr& AvatarStorage::GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons, bool _isDefault)
+    void AvatarStorage::CleanupSecondaryCaches(const QString& _aimId)
+    {
+        for (const auto& key : KeysByAimId_.value(_aimId))
+        {
+            if (key != _aimId)
+                Remove(key);
+        }
+
+        const auto prefix = _aimId % ql1c('/');
+        for (auto iter = RoundingKeys_.begin(); iter != RoundingKeys_.end();)
+        {
+            if (iter.key().startsWith(prefix))
+                iter = RoundingKeys_.erase(iter);
+            else
+                ++iter;
+        }
+    }
+
+    QPixmapSCptr AvatarStorage::GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons)
     {
         assert(!_avatar.isNull());
 
-        const QString key = _aimId
-        % ql1c('/')
-        % QString::number(_avatar.width())
-        % ql1c('/')
-        % _state;
+        const auto key = CreateRoundedKey(_aimId, _avatar.width(), _state, mini_icons);
 
-        auto i = RoundedAvatarsByAimIdAndSize_.find(key);
-        if (i == RoundedAvatarsByAimIdAndSize_.end())
+        auto rounded = Find(key);
+        if (!rounded)
         {
-            auto roundedAvatar = Utils::roundImage(_avatar, _state, _isDefault, mini_icons);
-            i = RoundedAvatarsByAimIdAndSize_
-                .emplace(
-                    key,
-                    std::make_shared<QPixmap>(std::move(roundedAvatar)))
-                .first;
+            rounded = std::make_shared<QPixmap>(Utils::roundImage(_avatar, _state, false, mini_icons));
+            Insert(key, _aimId, rounded);
+
+            // rendered here already, the background result would be the same
+            RoundingKeys_.remove(key);
         }
 
-        return i->second;
+        return rounded;
     }
 
     AvatarStorage* GetAvatarStorage()
@@ -399,4 +559,14 @@ namespace
         assert(_sizePx > 0);
         return _aimId % ql1c('/') % QString::number(_sizePx);
     }
+
+    QString CreateRoundedKey(const QString& _aimId, const int _sizePx, const QString& _state, const bool _miniIcons)
+    {
+        return CreateKey(_aimId, _sizePx) % ql1c('/') % _state % (_miniIcons ? ql1s("/mini") : ql1s("/"));
+    }
+
+    int GetPixmapBytes(const QPixmap& _pixmap)
+    {
+        return _pixmap.width() * _pixmap.height() * std::max(_pixmap.depth(), 8) / 8;
+    }
 }
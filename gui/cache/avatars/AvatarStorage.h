@@ -3,6 +3,8 @@
 #include "../../types/contact.h"
 #include "../../types/chat.h"
 
+#include "RoundAvatarTask.h"
+
 namespace Logic
 {
     typedef std::shared_ptr<const QPixmap> QPixmapSCptr;
@@ -23,15 +25,25 @@ namespace Logic
 
         void cleanup();
 
+        void startRounding();
+
+        void avatarRounded(quint64 _ticket, const QString& _key, const QString& _aimId, const QImage& _rounded);
+
+        void notifyRounded();
+
     public Q_SLOTS:
         void updateAvatar(const QString& _aimId, bool force = true);
 
     public:
         ~AvatarStorage();
 
-        const QPixmapSCptr& Get(const QString& _aimId, const QString& _displayName, const int _sizePx, bool& _isDefault, bool _regenerate);
+        QPixmapSCptr Get(const QString& _aimId, const QString& _displayName, const int _sizePx, bool& _isDefault, bool _regenerate);
+
+        QPixmapSCptr GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, bool& _isDefault, bool _regenerate, bool mini_icons);
 
-        const QPixmapSCptr& GetRounded(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, bool& _isDefault, bool _regenerate, bool mini_icons);
+        // for views repainted on avatarChanged: a missing rounded avatar is rendered in the background,
+        // meanwhile another state of the same avatar or an empty pixmap is returned
+        QPixmapSCptr GetRoundedAsync(const QString& _aimId, const QString& _displayName, const int _sizePx, const QString& _state, bool& _isDefault, bool mini_icons);
 
         QString GetLocal(const QString& _aimId, const QString& _displayName, const int _sizePx);
 
@@ -41,31 +53,67 @@ namespace Logic
         void SetAvatar(const QString& _aimId, const QPixmap& _pixmap);
 
     private:
-        typedef std::map<QString, QPixmapSCptr> CacheMap;
+        // one list for the loaded, scaled and rounded avatars, the least recently used go first
+        struct CacheEntry
+        {
+            QString Key_;
+
+            QString AimId_;
+
+            QPixmapSCptr Pixmap_;
+
+            int Bytes_;
+        };
+
+        typedef std::list<CacheEntry> CacheList;
 
         AvatarStorage();
 
+        QPixmapSCptr Find(const QString& _key);
+
+        void Insert(const QString& _key, const QString& _aimId, QPixmapSCptr _pixmap);
+
+        void Remove(const QString& _key);
+
+        void RemoveAvatar(const QString& _aimId);
+
+        void Evict();
+
         void CleanupSecondaryCaches(const QString& _aimId);
 
-        const QPixmapSCptr& GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons, bool _isDefault);
+        QPixmapSCptr GetRounded(const QPixmap& _avatar, const QString& _aimId, const QString& _state, bool mini_icons);
 
-        CacheMap AvatarsByAimIdAndSize_;
+        CacheList Cache_;
 
-        CacheMap AvatarsByAimId_;
+        QHash<QString, CacheList::iterator> CacheIndex_;
 
-        CacheMap RoundedAvatarsByAimIdAndSize_;
+        QHash<QString, QSet<QString>> KeysByAimId_;
 
-        std::set<QString> RequestedAvatars_;
+        qint64 CacheBytes_;
 
-        QStringList LoadedAvatars_;
+        QSet<QString> RequestedAvatars_;
 
-        QStringList LoadedAvatarsFails_;
+        QSet<QString> LoadedAvatars_;
+
+        QSet<QString> LoadedAvatarsFails_;
 
         QMap<QString, int> ChatInfoRequested_;
 
-        std::map<QString, QDateTime> TimesCache_;
+        QHash<QString, QDateTime> TimesCache_;
+
+        std::vector<RoundAvatarJob> RoundQueue_;
+
+        QHash<QString, quint64> RoundingKeys_;
+
+        quint64 RoundTicket_;
+
+        QSet<QString> RoundedAimIds_;
 
         QTimer* Timer_;
+
+        QTimer* RoundTimer_;
+
+        QTimer* NotifyTimer_;
     };
 
     AvatarStorage* GetAvatarStorage();
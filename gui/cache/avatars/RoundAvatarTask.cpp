@@ -0,0 +1,26 @@
+#include "stdafx.h"
+
+#include "../../utils/utils.h"
+
+#include "RoundAvatarTask.h"
+
+namespace Logic
+{
+
+    RoundAvatarTask::RoundAvatarTask(std::vector<RoundAvatarJob> _jobs)
+        : Jobs_(std::move(_jobs))
+    {
+        assert(!Jobs_.empty());
+    }
+
+    void RoundAvatarTask::run()
+    {
+        for (const auto& job : Jobs_)
+        {
+            assert(!job.Avatar_.isNull());
+
+            emit roundedSignal(job.Ticket_, job.Key_, job.AimId_, Utils::roundImage(job.Avatar_, job.State_, job.MiniIcons_));
+        }
+    }
+
+}
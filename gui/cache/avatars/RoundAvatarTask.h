@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Logic
+{
+    struct RoundAvatarJob
+    {
+        quint64 Ticket_;
+
+        QString Key_;
+
+        QString AimId_;
+
+        QImage Avatar_;
+
+        QString State_;
+
+        bool MiniIcons_;
+    };
+
+    class RoundAvatarTask
+        : public QObject
+        , public QRunnable
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        void roundedSignal(quint64 _ticket, QString _key, QString _aimId, QImage _rounded);
+
+    public:
+        RoundAvatarTask(std::vector<RoundAvatarJob> _jobs);
+
+        void run();
+
+    private:
+        std::vector<RoundAvatarJob> Jobs_;
+
+    };
+
+}
@@ -39,7 +39,27 @@ namespace
 
     EmojiSetsMap EmojiSetBySize_;
 
-    std::unordered_map<int64_t, const QImage> EmojiCache_;
+    // sizes of the loaded sprite sheets, most recently used first
+    std::deque<int32_t> EmojiSetsUsage_;
+
+    const size_t MaxLoadedEmojiSets = 2;
+
+    // slices of all sizes share one lru with a byte budget
+    typedef std::list<std::pair<int64_t, QImage>> EmojiAtlasList;
+
+    EmojiAtlasList EmojiAtlas_;
+
+    std::unordered_map<int64_t, EmojiAtlasList::iterator> EmojiAtlasIndex_;
+
+    int64_t EmojiAtlasBytes_ = 0;
+
+    const int64_t MaxEmojiAtlasBytes = 4 * 1024 * 1024;
+
+    QImage FindInAtlas(const int64_t _key);
+
+    void PutToAtlas(const int64_t _key, const QImage& _image);
+
+    void TouchEmojiSet(const int32_t _sizePx);
 
     int32_t GetEmojiSizeForCurrentUiScale();
 
@@ -74,17 +94,21 @@ namespace Emoji
 
     void Cleanup()
     {
-        EmojiCache_.clear();
+        EmojiAtlas_.clear();
+        EmojiAtlasIndex_.clear();
+        EmojiAtlasBytes_ = 0;
+
         EmojiSetBySize_.clear();
+        EmojiSetsUsage_.clear();
     }
 
-    const QImage& GetEmoji(const uint32_t _main, const uint32_t _ext, const EmojiSizePx _size)
+    QImage GetEmoji(const uint32_t _main, const uint32_t _ext, const EmojiSizePx _size)
     {
         assert(_main > 0);
         assert(_size >= EmojiSizePx::Min);
         assert(_size <= EmojiSizePx::Max);
 
-        static QImage empty;
+        const QImage empty;
 
         Loading_.waitForFinished();
         if (!Loading_.result())
@@ -102,11 +126,11 @@ namespace Emoji
         assert(info->Index_ >= 0);
 
         const auto key = MakeCacheKey(info->Index_, sizeToSearch);
-        auto cacheIter = EmojiCache_.find(key);
-        if (cacheIter != EmojiCache_.end())
+
+        const auto cached = FindInAtlas(key);
+        if (!cached.isNull())
         {
-            assert(!cacheIter->second.isNull());
-            return cacheIter->second;
+            return cached;
         }
 
         QImage image;
@@ -149,10 +173,9 @@ namespace Emoji
             image = emojiSetIter->second.copy(r);
         }
 
-        const auto result = EmojiCache_.emplace(key, std::move(image));
-        assert(result.second);
+        PutToAtlas(key, image);
 
-        return result.first->second;
+        return image;
     }
 
     EmojiSizePx GetNearestSizeAvailable(const int32_t _sizePx)
@@ -265,6 +288,8 @@ namespace
         auto emojiSetIter = EmojiSetBySize_.find(_meta.SizePx_);
         if (emojiSetIter != EmojiSetBySize_.end())
         {
+            TouchEmojiSet(_meta.SizePx_);
+
             return emojiSetIter;
         }
 
@@ -275,9 +300,61 @@ namespace
             return EmojiSetBySize_.end();
         }
 
+        // whole sheets are large, only keep the ones in use
+        while (EmojiSetsUsage_.size() >= MaxLoadedEmojiSets)
+        {
+            EmojiSetBySize_.erase(EmojiSetsUsage_.back());
+            EmojiSetsUsage_.pop_back();
+        }
+
+        EmojiSetsUsage_.push_front(_meta.SizePx_);
+
         return EmojiSetBySize_.emplace(_meta.SizePx_, std::move(setImg)).first;
     }
 
+    void TouchEmojiSet(const int32_t _sizePx)
+    {
+        if (!EmojiSetsUsage_.empty() && EmojiSetsUsage_.front() == _sizePx)
+        {
+            return;
+        }
+
+        EmojiSetsUsage_.erase(std::remove(EmojiSetsUsage_.begin(), EmojiSetsUsage_.end(), _sizePx), EmojiSetsUsage_.end());
+        EmojiSetsUsage_.push_front(_sizePx);
+    }
+
+    QImage FindInAtlas(const int64_t _key)
+    {
+        const auto iter = EmojiAtlasIndex_.find(_key);
+        if (iter == EmojiAtlasIndex_.end())
+        {
+            return QImage();
+        }
+
+        EmojiAtlas_.splice(EmojiAtlas_.begin(), EmojiAtlas_, iter->second);
+
+        return iter->second->second;
+    }
+
+    void PutToAtlas(const int64_t _key, const QImage& _image)
+    {
+        if (_image.isNull() || EmojiAtlasIndex_.count(_key))
+        {
+            return;
+        }
+
+        EmojiAtlas_.emplace_front(_key, _image);
+        EmojiAtlasIndex_.emplace(_key, EmojiAtlas_.begin());
+        EmojiAtlasBytes_ += _image.byteCount();
+
+        while (EmojiAtlasBytes_ > MaxEmojiAtlasBytes && EmojiAtlas_.size() > 1)
+        {
+            EmojiAtlasBytes_ -= EmojiAtlas_.back().second.byteCount();
+            EmojiAtlasIndex_.erase(EmojiAtlas_.back().first);
+            EmojiAtlas_.pop_back();
+        }
+    }
+
     int64_t MakeCacheKey(const int32_t _index, const int32_t _sizePx)
     {
         return ((int64_t)_index | ((int64_t)_sizePx << 32));
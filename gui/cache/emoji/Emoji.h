@@ -24,7 +24,7 @@ namespace Emoji
 
     void Cleanup();
 
-    const QImage& GetEmoji(const uint32_t _main, const uint32_t _ext, const EmojiSizePx size = EmojiSizePx::Auto);
+    QImage GetEmoji(const uint32_t _main, const uint32_t _ext, const EmojiSizePx size = EmojiSizePx::Auto);
 
     EmojiSizePx GetFirstLesserOrEqualSizeAvailable(const int32_t _sizePx);
 
@@ -6,98 +6,146 @@ namespace
 {
     using namespace Emoji;
 
-    std::vector<EmojiRecordSptr> EmojiIndexByOrder_;
+    struct EmojiCategoryRange
+    {
+        const char* Name_;
+
+        int First_;
+
+        int Count_;
+    };
 
-    std::unordered_map<uint64_t, EmojiRecordSptr> EmojiIndexByCodepoint_;
+    #include "EmojiIndexData.cpp"
 
-    std::map<QString, EmojiRecordSptrVec> EmojiIndexByCategory_;
+    const uint16_t EmptySlot = 0xffff;
 
-    QStringList EmojiCategories_;
+    QStringList EmojiCategoryNames_;
+
+    std::unordered_map<int, EmojiRecordPtrVec> EmojiIndexByCategory_;
 
     uint64_t MakeComplexCodepoint(const uint32_t codepoint, const uint32_t extendedCodepoint)
     {
         return ((uint64_t)codepoint) | ((uint64_t)extendedCodepoint << 32);
     }
-}
 
-namespace Emoji
-{
-    EmojiRecord::EmojiRecord(const QString& _category, const int _index, const unsigned _codepoint, const unsigned _extendedCodepoint, const QString& _name)
-        : Category_(_category)
-        , Index_(_index)
-        , Name_(_name)
-        , Codepoint_(_codepoint)
-        , ExtendedCodepoint_(_extendedCodepoint)
+    // must match hash_codepoint in make_emoji_index.py
+    uint32_t HashCodepoint(const uint64_t _codepoint, const uint32_t _seed)
     {
-        assert(!Category_.isEmpty());
-        assert(!Name_.isEmpty());
-        assert(Index_ >= 0);
-        assert(Codepoint_ > 0);
+        auto h = _codepoint + 0x9e3779b97f4a7c15ULL * (_seed + 1);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+
+        return (uint32_t)h;
     }
 
-    void InitEmojiDb()
+    bool IsAvailable(const EmojiRecord& _record)
     {
-        #include "EmojiIndexData.cpp"
-        assert(!EmojiIndexByOrder_.empty());
-
-        for (const auto &record : EmojiIndexByOrder_)
+#if defined(__APPLE__)
+        switch (_record.Exclusion_)
         {
-            const auto &category = record->Category_;
-            assert(!category.isEmpty());
-
-            if (!EmojiCategories_.contains(category))
-            {
-                EmojiCategories_.append(category);
-            }
-
-            const auto extendedCodepoint = MakeComplexCodepoint(record->Codepoint_, record->ExtendedCodepoint_);
-            EmojiIndexByCodepoint_.emplace(extendedCodepoint, record);
+            case EmojiExclusion::Mac:
+                return false;
+            case EmojiExclusion::Mac_10_11:
+                return QSysInfo().macVersion() > QSysInfo::MV_10_11;
+            case EmojiExclusion::Mac_10_10:
+                return QSysInfo().macVersion() > QSysInfo::MV_10_10;
+            case EmojiExclusion::Mac_10_9:
+                return QSysInfo().macVersion() > QSysInfo::MV_10_9;
+            default:
+                return true;
+        }
+#else
+        return true;
+#endif
+    }
+}
 
-            auto iter = EmojiIndexByCategory_.find(category);
-            if (iter == EmojiIndexByCategory_.end())
-            {
-                EmojiRecordSptrVec v;
-                v.reserve(EmojiIndexByCodepoint_.size());
-                iter = EmojiIndexByCategory_.emplace(category, std::move(v)).first;
-            }
+namespace Emoji
+{
+    void InitEmojiDb()
+    {
+        static_assert(sizeof(EmojiIndex_) / sizeof(EmojiIndex_[0]) < EmptySlot, "emoji index does not fit the hash slots");
 
-            iter->second.push_back(record);
-        }
+        assert(GetEmojiInfoByCodepoint(EmojiIndex_[0].Codepoint_, EmojiIndex_[0].ExtendedCodepoint_) == &EmojiIndex_[0]);
     }
 
-    const EmojiRecordSptr& GetEmojiInfoByCodepoint(const uint32_t _codepoint, const uint32_t _extendedCodepoint)
+    EmojiRecordPtr GetEmojiInfoByCodepoint(const uint32_t _codepoint, const uint32_t _extendedCodepoint)
     {
         assert(_codepoint > 0);
-        assert(!EmojiIndexByCodepoint_.empty());
 
         const auto complexCodepoint = MakeComplexCodepoint(_codepoint, _extendedCodepoint);
-        const auto iter = EmojiIndexByCodepoint_.find(complexCodepoint);
-        if (iter == EmojiIndexByCodepoint_.end())
+
+        const auto seed = EmojiHashSeeds_[HashCodepoint(complexCodepoint, 0) % EmojiHashBuckets];
+        const auto slot = EmojiHashSlots_[HashCodepoint(complexCodepoint, seed) % EmojiHashSlotsCount];
+        if (slot == EmptySlot)
         {
             return EmptyEmoji;
         }
 
-        return iter->second;
+        const auto& record = EmojiIndex_[slot];
+        if (record.Codepoint_ != _codepoint || record.ExtendedCodepoint_ != _extendedCodepoint || !IsAvailable(record))
+        {
+            return EmptyEmoji;
+        }
+
+        return &record;
     }
 
     const QStringList& GetEmojiCategories()
     {
-        assert(!EmojiCategories_.isEmpty());
-        return EmojiCategories_;
+        if (EmojiCategoryNames_.isEmpty())
+        {
+            for (const auto& category : EmojiCategories_)
+            {
+                EmojiCategoryNames_.append(QString::fromLatin1(category.Name_));
+            }
+        }
+
+        return EmojiCategoryNames_;
     }
 
-    const EmojiRecordSptrVec& GetEmojiInfoByCategory(const QString& _category)
+    const EmojiRecordPtrVec& GetEmojiInfoByCategory(const QString& _category)
     {
         assert(!_category.isEmpty());
 
-        static const EmojiRecordSptrVec empty;
+        static const EmojiRecordPtrVec empty;
 
-        const auto iter = EmojiIndexByCategory_.find(_category);
-        if (iter == EmojiIndexByCategory_.end())
+        const auto categoryIter = std::find_if(
+            std::begin(EmojiCategories_),
+            std::end(EmojiCategories_),
+            [&_category](const EmojiCategoryRange& _range)
+            {
+                return _category == QLatin1String(_range.Name_);
+            }
+        );
+
+        if (categoryIter == std::end(EmojiCategories_))
         {
             return empty;
         }
 
+        const auto categoryIndex = (int)(categoryIter - std::begin(EmojiCategories_));
+
+        auto iter = EmojiIndexByCategory_.find(categoryIndex);
+        if (iter == EmojiIndexByCategory_.end())
+        {
+            EmojiRecordPtrVec v;
+            v.reserve(categoryIter->Count_);
+
+            for (auto i = categoryIter->First_; i < categoryIter->First_ + categoryIter->Count_; ++i)
+            {
+                if (IsAvailable(EmojiIndex_[i]))
+                {
+                    v.push_back(&EmojiIndex_[i]);
+                }
+            }
+
+            iter = EmojiIndexByCategory_.emplace(categoryIndex, std::move(v)).first;
+        }
+
         return iter->second;
     }
 }
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+# Rebuilds the hash tables and category ranges of EmojiIndexData.cpp from its record list.
+# Edit the records (keep categories contiguous), then run: python3 make_emoji_index.py
+
+import os, re, sys
+
+DATA_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "EmojiIndexData.cpp")
+
+HASH_BUCKETS = 512
+HASH_SLOTS = 2048
+EMPTY_SLOT = 0xffff
+
+MASK64 = (1 << 64) - 1
+
+RECORD_RE = re.compile(r'^\s*\{ "(\w+)", (\d+), (0x[0-9a-f]+), (0x[0-9a-f]+), "([^"]+)", EmojiExclusion::(\w+) \},?$')
+
+
+def hash_codepoint(codepoint, seed):
+    # must match HashCodepoint in EmojiDb.cpp
+    h = (codepoint + 0x9e3779b97f4a7c15 * (seed + 1)) & MASK64
+    h ^= h >> 33
+    h = (h * 0xff51afd7ed558ccd) & MASK64
+    h ^= h >> 33
+    h = (h * 0xc4ceb9fe1a85ec53) & MASK64
+    h ^= h >> 33
+    return h & 0xffffffff
+
+
+def complex_codepoint(record):
+    return int(record[2], 16) | (int(record[3], 16) << 32)
+
+
+def read_records():
+    records = []
+    with open(DATA_FILE, encoding="utf-8-sig") as f:
+        for line in f:
+            m = RECORD_RE.match(line)
+            if m:
+                records.append(m.groups())
+    return records
+
+
+def build_hash(records):
+    buckets = [[] for _ in range(HASH_BUCKETS)]
+    for index, record in enumerate(records):
+        key = complex_codepoint(record)
+        buckets[hash_codepoint(key, 0) % HASH_BUCKETS].append((key, index))
+
+    seeds = [0] * HASH_BUCKETS
+    slots = [EMPTY_SLOT] * HASH_SLOTS
+
+    for bucket in sorted(range(HASH_BUCKETS), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            break
+        seed = 1
+        while True:
+            taken = [hash_codepoint(key, seed) % HASH_SLOTS for key, _ in buckets[bucket]]
+            if len(set(taken)) == len(taken) and all(slots[s] == EMPTY_SLOT for s in taken):
+                break
+            seed += 1
+            if seed > 0xffff:
+                sys.exit("no seed for bucket %d, increase HASH_SLOTS" % bucket)
+        seeds[bucket] = seed
+        for s, (_, index) in zip(taken, buckets[bucket]):
+            slots[s] = index
+
+    return seeds, slots
+
+
+def build_categories(records):
+    categories = []
+    for index, record in enumerate(records):
+        if categories and categories[-1][0] == record[0]:
+            categories[-1][2] += 1
+            continue
+        if any(c[0] == record[0] for c in categories):
+            sys.exit("category '%s' is not contiguous" % record[0])
+        categories.append([record[0], index, 1])
+    return categories
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    records = read_records()
+    if not records:
+        sys.exit("no records found in " + DATA_FILE)
+    if len(set(complex_codepoint(r) for r in records)) != len(records):
+        sys.exit("duplicate codepoints")
+
+    seeds, slots = build_hash(records)
+    categories = build_categories(records)
+
+    out = []
+    out.append("// Generated by make_emoji_index.py from the records below, do not edit the tables by hand.")
+    out.append("// Included by EmojiDb.cpp, not compiled on its own.")
+    out.append("")
+    out.append("const EmojiRecord EmojiIndex_[] =")
+    out.append("{")
+    for r in records:
+        out.append('    { "%s", %s, %s, %s, "%s", EmojiExclusion::%s },' % r)
+    out.append("};")
+    out.append("")
+    out.append("const EmojiCategoryRange EmojiCategories_[] =")
+    out.append("{")
+    for name, first, count in categories:
+        out.append('    { "%s", %d, %d },' % (name, first, count))
+    out.append("};")
+    out.append("")
+    out.append("const uint32_t EmojiHashBuckets = %d;" % HASH_BUCKETS)
+    out.append("")
+    out.append("const uint16_t EmojiHashSeeds_[EmojiHashBuckets] =")
+    out.append("{")
+    out.append(format_array(seeds))
+    out.append("};")
+    out.append("")
+    out.append("const uint32_t EmojiHashSlotsCount = %d;" % HASH_SLOTS)
+    out.append("")
+    out.append("const uint16_t EmojiHashSlots_[EmojiHashSlotsCount] =")
+    out.append("{")
+    out.append(format_array(["0x%x" % s if s == EMPTY_SLOT else s for s in slots]))
+    out.append("};")
+    out.append("")
+
+    with open(DATA_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -12,6 +12,7 @@
 #include "utils/gui_coll_helper.h"
 #include "utils/InterConnector.h"
 #include "utils/LoadPixmapFromDataTask.h"
+#include "utils/UnserializeMessagesTask.h"
 #include "utils/uid.h"
 #include "utils/utils.h"
 #include "cache/stickers/stickers.h"
@@ -472,6 +473,7 @@ void core_dispatcher::initMessageMap()
     REGISTER_IM_MESSAGE("core/logins", onCoreLogins);
     REGISTER_IM_MESSAGE("theme_settings", onThemeSettings);
     REGISTER_IM_MESSAGE("archive/images/get/result", onArchiveImagesGetResult);
+    REGISTER_IM_MESSAGE("archive/images/built", onArchiveImagesBuilt);
     REGISTER_IM_MESSAGE("archive/messages/get/result", onArchiveMessagesGetResult);
     REGISTER_IM_MESSAGE("messages/received/dlg_state", onMessagesReceivedDlgState);
     REGISTER_IM_MESSAGE("messages/received/server", onMessagesReceivedServer);
@@ -998,7 +1000,10 @@ void core_dispatcher::onMessagesReceivedSenders(const int64_t _seq, core::coll_h
         sendersAimIds = toContainerOfString<QVector<QString>>(array);
     }
 
-    emit messagesReceived(aimId, sendersAimIds);
+    emitInOrder(aimId, [this, aimId, sendersAimIds]
+    {
+        emit messagesReceived(aimId, sendersAimIds);
+    });
 }
 
 void core_dispatcher::onTyping(const int64_t _seq, core::coll_helper _params)
@@ -1331,33 +1336,106 @@ void core_dispatcher::onArchiveImagesGetResult(const int64_t _seq, core::coll_he
     emit getImagesResult(Data::UnserializeImages(_params));
 }
 
+void core_dispatcher::onArchiveImagesBuilt(const int64_t _seq, core::coll_helper _params)
+{
+    emit imagesBuilt(_params.get<QString>("contact"));
+}
+
 void core_dispatcher::onArchiveMessages(Ui::MessagesBuddiesOpt _type, const int64_t _seq, core::coll_helper _params)
 {
-    const auto myAimid = _params.get<QString>("my_aimid");
+    unserializeMessages(std::make_shared<Utils::UnserializeMessagesJob>(_params, false, _type, _seq));
+}
 
-    const auto result = Data::UnserializeMessageBuddies(&_params, myAimid);
+void core_dispatcher::unserializeMessages(std::shared_ptr<Utils::UnserializeMessagesJob> _job)
+{
+    const auto contact = _job->Params_.get<QString>("contact");
 
-    if (!result.introMessages.isEmpty())
-        emit messageBuddies(result.introMessages, result.aimId, Ui::MessagesBuddiesOpt::Intro, result.havePending, _seq, result.lastMsgId);
+    unserializeQueues_[contact].push_back(_job);
 
-    emit messageBuddies(result.messages, result.aimId, _type, result.havePending, _seq, result.lastMsgId);
+    auto task = new Utils::UnserializeMessagesTask(std::move(_job));
 
-    if (_params.is_value_exist("deleted"))
-    {
-        QVector<int64_t> deletedIds;
+    const auto succeeded = QObject::connect(
+        task, &Utils::UnserializeMessagesTask::unserializedSignal,
+        this,
+        [this, contact]
+        {
+            emitArchiveMessages(contact);
+        },
+        Qt::QueuedConnection);
+    assert(succeeded);
 
-        const auto deletedIdsArray = _params.get_value_as_array("deleted");
-        assert(!deletedIdsArray->empty());
-        const auto size = deletedIdsArray->size();
-        deletedIds.reserve(size);
-        for (auto i = 0; i < size; ++i)
-            deletedIds.push_back(deletedIdsArray->get_at(i)->get_as_int64());
+    QThreadPool::globalInstance()->start(task);
+}
 
-        emit messagesDeleted(result.aimId, deletedIds);
+void core_dispatcher::emitInOrder(const QString& _contact, std::function<void()> _signal)
+{
+    // nothing of the contact is being unserialized, there is nothing to wait for
+    const auto queue = unserializeQueues_.find(_contact);
+    if (queue == unserializeQueues_.end())
+    {
+        _signal();
+        return;
     }
 
-    if (!result.modifications.isEmpty())
-        emit messagesModified(result.aimId, result.modifications);
+    queue->push_back(std::make_shared<Utils::UnserializeMessagesJob>(std::move(_signal)));
+}
+
+void core_dispatcher::emitArchiveMessages(const QString& _contact)
+{
+    for (;;)
+    {
+        // the handlers may queue new collections, so the queue is looked up for each one
+        auto queue = unserializeQueues_.find(_contact);
+        if (queue == unserializeQueues_.end())
+            return;
+
+        if (queue->empty() || !queue->front()->Ready_)
+            return;
+
+        const auto job = queue->front();
+
+        queue->pop_front();
+        if (queue->empty())
+            unserializeQueues_.erase(queue);
+
+        if (job->Signal_)
+        {
+            job->Signal_();
+            continue;
+        }
+
+        if (job->ServerIds_)
+        {
+            auto& result = job->ServerMessagesIds_;
+            Data::ResolveFriendlyNames(result.UpdatedMessages_);
+
+            if (!result.AllIds_.isEmpty())
+                emit messageIdsFromServer(result.AllIds_, result.AimId_, job->Seq_);
+
+            if (!result.DeletedIds_.isEmpty())
+                emit messagesDeleted(result.AimId_, result.DeletedIds_);
+            if (!result.UpdatedMessages_.isEmpty())
+                emit messagesModified(result.AimId_, result.UpdatedMessages_);
+
+            continue;
+        }
+
+        auto& result = job->Messages_;
+        Data::ResolveFriendlyNames(result.messages);
+        Data::ResolveFriendlyNames(result.introMessages);
+        Data::ResolveFriendlyNames(result.modifications);
+
+        if (!result.introMessages.isEmpty())
+            emit messageBuddies(result.introMessages, result.aimId, Ui::MessagesBuddiesOpt::Intro, result.havePending, job->Seq_, result.lastMsgId);
+
+        emit messageBuddies(result.messages, result.aimId, job->Type_, result.havePending, job->Seq_, result.lastMsgId);
+
+        if (!job->DeletedIds_.isEmpty())
+            emit messagesDeleted(result.aimId, job->DeletedIds_);
+
+        if (!result.modifications.isEmpty())
+            emit messagesModified(result.aimId, result.modifications);
+    }
 }
 
 void core_dispatcher::onArchiveMessagesGetResult(const int64_t _seq, core::coll_helper _params)
@@ -1372,14 +1450,8 @@ void core_dispatcher::onMessagesReceivedDlgState(const int64_t _seq, core::coll_
 
 void core_dispatcher::onMessagesReceivedServer(const int64_t _seq, core::coll_helper _params)
 {
-    const auto result = Data::UnserializeServerMessagesIds(_params);
-    if (!result.AllIds_.isEmpty())
-        emit messageIdsFromServer(result.AllIds_, result.AimId_, _seq);
-
-    if (!result.DeletedIds_.isEmpty())
-        emit messagesDeleted(result.AimId_, result.DeletedIds_);
-    if (!result.UpdatedMessages_.isEmpty())
-        emit messagesModified(result.AimId_, result.UpdatedMessages_);
+    // goes through the same queue to stay in order with the archive messages of the contact
+    unserializeMessages(std::make_shared<Utils::UnserializeMessagesJob>(_params, true, Ui::MessagesBuddiesOpt::Requested, _seq));
 }
 
 void core_dispatcher::onArchiveMessagesPending(const int64_t _seq, core::coll_helper _params)
@@ -1405,7 +1477,10 @@ void core_dispatcher::onMessagesDelUpTo(const int64_t _seq, core::coll_helper _p
     const auto contact = _params.get<QString>("contact");
     assert(!contact.isEmpty());
 
-    emit messagesDeletedUpTo(contact, id);
+    emitInOrder(contact, [this, contact, id]
+    {
+        emit messagesDeletedUpTo(contact, id);
+    });
 }
 
 void core_dispatcher::onDlgStates(const int64_t _seq, core::coll_helper _params)
@@ -41,6 +41,7 @@ namespace launch
 namespace Utils
 {
     struct ProxySettings;
+    struct UnserializeMessagesJob;
 }
 
 namespace stickers
@@ -114,6 +115,7 @@ Q_SIGNALS:
         void im_created();
         void loginComplete();
         void getImagesResult(const Data::ImageListPtr& images);
+        void imagesBuilt(const QString& _aimId);
         void messageBuddies(const Data::MessageBuddies&, const QString&, Ui::MessagesBuddiesOpt, bool, qint64, int64_t last_msg_id);
         void messageIdsFromServer(const QVector<qint64>&, const QString&, qint64);
         void getSmsResult(int64_t, int _errCode, int _codeLength);
@@ -317,6 +319,7 @@ Q_SIGNALS:
         void onCoreLogins(const int64_t _seq, core::coll_helper _params);
         void onThemeSettings(const int64_t _seq, core::coll_helper _params);
         void onArchiveImagesGetResult(const int64_t _seq, core::coll_helper _params);
+        void onArchiveImagesBuilt(const int64_t _seq, core::coll_helper _params);
         void onArchiveMessagesGetResult(const int64_t _seq, core::coll_helper _params);
         void onMessagesReceivedDlgState(const int64_t _seq, core::coll_helper _params);
         void onMessagesReceivedServer(const int64_t _seq, core::coll_helper _params);
@@ -425,6 +428,12 @@ Q_SIGNALS:
 
         void onEventTyping(core::coll_helper _params, bool _isTyping);
 
+        void unserializeMessages(std::shared_ptr<Utils::UnserializeMessagesJob> _job);
+        void emitArchiveMessages(const QString& _contact);
+
+        // emits at once, or after the collections of the contact which are still being unserialized
+        void emitInOrder(const QString& _contact, std::function<void()> _signal);
+
     private:
 
         std::unordered_map<std::string, message_function> messages_map_;
@@ -436,6 +445,10 @@ Q_SIGNALS:
 
         std::unordered_map<int64_t, callback_info> callbacks_;
 
+        // messages collections being unserialized on the thread pool,
+        // they are emitted in the order they came from core for each contact
+        QHash<QString, std::deque<std::shared_ptr<Utils::UnserializeMessagesJob>>> unserializeQueues_;
+
         qint64 lastTimeCallbacksCleanedUp_;
 
         bool isStatsEnabled_;
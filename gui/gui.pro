@@ -29,6 +29,7 @@ SOURCES += \
     stdafx.cpp \
     cache/countries.cpp \
     cache/avatars/AvatarStorage.cpp \
+    cache/avatars/RoundAvatarTask.cpp \
     cache/emoji/Emoji.cpp \
     cache/emoji/EmojiDb.cpp \
     cache/emoji/EmojiIndexData.cpp \
@@ -166,6 +167,7 @@ SOURCES += \
     main_window/GroupChatOperations.cpp \
     utils/LoadPixmapFromDataTask.cpp \
     utils/LoadPixmapFromFile.cpp \
+    utils/UnserializeMessagesTask.cpp \
     main_window/history_control/ContentWidgets/FileSharingWidget.cpp \
     main_window/history_control/ContentWidgets/ImagePreviewWidget.cpp \
     main_window/history_control/ContentWidgets/MessageContentWidget.cpp \
@@ -229,6 +231,7 @@ SOURCES += \
     controls/TransparentScrollBar.cpp \
     utils/exif.cpp \
     main_window/mplayer/FFMpegPlayer.cpp \
+    main_window/mplayer/FramesCache.cpp \
     main_window/mplayer/MultimediaViewer.cpp \
     main_window/mplayer/VideoPlayer.cpp \
     controls/ToolTipEx.cpp \
@@ -256,6 +259,7 @@ HEADERS  += \
     stdafx.h \
     cache/countries.h \
     cache/avatars/AvatarStorage.h \
+    cache/avatars/RoundAvatarTask.h \
     cache/emoji/Emoji.h \
     cache/emoji/EmojiDb.h \
     cache/stickers/stickers.h \
@@ -401,6 +405,7 @@ HEADERS  += \
     main_window/GroupChatOperations.h \
     utils/LoadPixmapFromDataTask.h \
     utils/LoadPixmapFromFileTask.h \
+    utils/UnserializeMessagesTask.h \
     main_window/history_control/ContentWidgets/FileSharingWidget.h \
     main_window/history_control/ContentWidgets/ImagePreviewWidget.h \
     main_window/history_control/ContentWidgets/MessageContentWidget.h \
@@ -466,6 +471,7 @@ HEADERS  += \
     utils/exif.h \
     main_window/mplayer/ffmpeg.h \
     main_window/mplayer/FFMpegPlayer.h \
+    main_window/mplayer/FramesCache.h \
     main_window/mplayer/MultimediaViewer.h \
     main_window/mplayer/VideoPlayer.h \
     controls/ToolTipEx.h \
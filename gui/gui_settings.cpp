@@ -4,177 +4,175 @@
 #include "utils/gui_coll_helper.h"
 #include "my_info.h"
 
-namespace Ui
+namespace
 {
-    qt_gui_settings::qt_gui_settings()
-        :
-        shadowWidth_(0)
+    std::vector<Ui::settings_slot_base*>& get_registered_slots()
     {
-
+        static std::vector<Ui::settings_slot_base*> registered;
+        return registered;
     }
+}
 
-    template<> void qt_gui_settings::set_value<QString>(const QString& _name, const QString& _value)
+namespace Ui
+{
+    namespace settings
     {
-        const QByteArray arr = _value.toUtf8();
-        set_value_simple_data(_name, arr.data(), arr.size() + 1);
+        settings_slot<bool> cl_groups_enabled(settings_cl_groups_enabled, false);
+        settings_slot<bool> show_popular_contacts(settings_show_popular_contacts, true);
+        settings_slot<bool> show_last_message(settings_show_last_message, true);
+        settings_slot<bool> hide_message_timestamps(settings_hide_message_timestamps, true);
+        settings_slot<bool> show_video_and_images(settings_show_video_and_images, true);
+        settings_slot<bool> autoplay_video(settings_autoplay_video, true);
+        settings_slot<bool> sounds_enabled(settings_sounds_enabled, true);
+        settings_slot<bool> window_maximized(settings_window_maximized, false);
     }
 
-    template<> QString qt_gui_settings::get_value<QString>(const QString& _name, const QString& _defaultValue) const
+    template<> QString decode_settings_value<QString>(const std::vector<char>& _data, const QString& _defaultValue)
     {
-        std::vector<char> data;
-        if (!get_value_simple_data(_name, data))
+        if (_data.empty())
             return _defaultValue;
 
-        return &data[0];
+        // stored with the terminating zero
+        const auto size = (_data.back() == '\0' ? _data.size() - 1 : _data.size());
+
+        return QString::fromUtf8(&_data[0], (int)size);
     }
 
-    template<> QString qt_gui_settings::get_value<QString>(const char* _name, const QString& _defaultValue) const
+    template<> std::vector<int32_t> decode_settings_value<std::vector<int32_t>>(const std::vector<char>& _data, const std::vector<int32_t>& _defaultValue)
     {
-        std::vector<char> data;
-        if (!get_value_simple_data(_name, data))
+        if (_data.empty())
             return _defaultValue;
 
-        return &data[0];
-    }
+        if ((_data.size() % sizeof(int32_t)) != 0)
+        {
+            assert(false);
+            return _defaultValue;
+        }
 
-    template<> void qt_gui_settings::set_value<int>(const QString& _name, const int& _value)
-    {
-        set_value_simple(_name, _value);
-    }
+        std::vector<int32_t> out_data(_data.size() / sizeof(int32_t));
+        ::memcpy(&out_data[0], &_data[0], _data.size());
 
-    template <> int qt_gui_settings::get_value<int>(const QString& _name, const int& _defaultValue) const
-    {
-        return get_value_simple(_name, _defaultValue);
+        return out_data;
     }
 
-    template <> int qt_gui_settings::get_value<int>(const char* _name, const int& _defaultValue) const
+    template<> QRect decode_settings_value<QRect>(const std::vector<char>& _data, const QRect& _defaultValue)
     {
-        return get_value_simple(_name, _defaultValue);
-    }
+        if (_data.size() != sizeof(int32_t[4]))
+        {
+            assert(false);
+            return _defaultValue;
+        }
 
-    template<> void qt_gui_settings::set_value<double>(const QString& _name, const double& _value)
-    {
-        set_value_simple(_name, _value);
-    }
+        int32_t buffer[4];
+        ::memcpy(buffer, &_data[0], sizeof(buffer));
 
-    template <> double qt_gui_settings::get_value<double>(const QString& _name, const double& _defaultValue) const
-    {
-        return get_value_simple(_name, _defaultValue);
+        return QRect(buffer[0], buffer[1], buffer[2], buffer[3]);
     }
 
-    template <> double qt_gui_settings::get_value<double>(const char* _name, const double& _defaultValue) const
+    settings_slot_base::settings_slot_base(const char* _name)
+        : name_(_name)
     {
-        return get_value_simple(_name, _defaultValue);
+        get_registered_slots().push_back(this);
     }
 
-    template<> void qt_gui_settings::set_value<bool>(const QString& _name, const bool& _value)
+    settings_slot_base::~settings_slot_base()
     {
-        set_value_simple(_name, _value);
+        auto& registered = get_registered_slots();
+        registered.erase(std::remove(registered.begin(), registered.end(), this), registered.end());
     }
 
-    template <> bool qt_gui_settings::get_value<bool>(const QString& _name, const bool& _defaultValue) const
+    const char* settings_slot_base::get_name() const
     {
-        return get_value_simple(_name, _defaultValue);
+        return name_;
     }
 
-    template <> bool qt_gui_settings::get_value<bool>(const char* _name, const bool& _defaultValue) const
+    qt_gui_settings::qt_gui_settings()
+        : post_scheduled_(false)
+        , shadowWidth_(0)
     {
-        return get_value_simple(_name, _defaultValue);
+
     }
 
-    template<> void qt_gui_settings::set_value<std::vector<int32_t>>(const QString& _name, const std::vector<int32_t>& _value)
+    void qt_gui_settings::update_slots(const QString& _name, const std::vector<char>* _data)
     {
-        if (_value.empty())
+        for (auto slot : get_registered_slots())
         {
-            set_value_simple_data(_name, 0, 0);
-
-            return;
+            if (_name == QLatin1String(slot->get_name()))
+                slot->update(_data);
         }
-
-        set_value_simple_data(_name, (const char*)&_value[0], (int)_value.size() * sizeof(int32_t));
     }
 
-    template<> std::vector<int32_t> qt_gui_settings::get_value<std::vector<int32_t>>(const QString& _name, const std::vector<int32_t>& _defaultValue) const
+    void qt_gui_settings::set_value_simple_data(const QString& _name, const char* _data, int _len, bool _postToCore)
     {
-        std::vector<char> data;
-        if (!get_value_simple_data(_name, data))
-            return _defaultValue;
-
-        if (data.empty())
-            return _defaultValue;
-
-        if ((data.size() % sizeof(int32_t)) != 0)
+        auto& val = values_[_name];
+        if (!_len)
         {
-            assert(false);
-            return _defaultValue;
+            val.data_.clear();
+            update_slots(_name, nullptr);
+            return;
         }
 
-        std::vector<int32_t> out_data(data.size()/sizeof(int32_t));
-        ::memcpy(&out_data[0], &data[0], data.size());
-
-        return out_data;
-    }
-
-    template<> std::vector<int32_t> qt_gui_settings::get_value<std::vector<int32_t>>(const char* _name, const std::vector<int32_t>& _defaultValue) const
-    {
-        std::vector<char> data;
-        if (!get_value_simple_data(_name, data))
-            return _defaultValue;
+        if (val.data_.size() == (size_t)_len && ::memcmp(&val.data_[0], _data, _len) == 0)
+            return;
 
-        if (data.empty())
-            return _defaultValue;
+        val.data_.assign(_data, _data + _len);
+        update_slots(_name, &val.data_);
 
-        if ((data.size() % sizeof(int32_t)) != 0)
+        if (_postToCore)
         {
-            assert(false);
-            return _defaultValue;
+            pending_values_.insert(_name);
+
+            if (!post_scheduled_)
+            {
+                post_scheduled_ = true;
+                QTimer::singleShot(0, this, [this]()
+                {
+                    post_pending_values_to_core();
+                });
+            }
         }
 
-        std::vector<int32_t> out_data(data.size() / sizeof(int32_t));
-        ::memcpy(&out_data[0], &data[0], data.size());
+        emit changed(_name);
+    }
 
-        return out_data;
+    template<> void qt_gui_settings::set_value<QString>(const QString& _name, const QString& _value)
+    {
+        const QByteArray arr = _value.toUtf8();
+        set_value_simple_data(_name, arr.data(), arr.size() + 1);
     }
 
-    template<> void qt_gui_settings::set_value<QRect>(const QString& _name, const QRect& _value)
+    template<> void qt_gui_settings::set_value<int>(const QString& _name, const int& _value)
     {
-        int32_t buffer[4] = {_value.left(), _value.top(), _value.width(), _value.height()};
+        set_value_simple(_name, _value);
+    }
 
-        set_value_simple_data(_name, (const char*) buffer, sizeof(buffer));
+    template<> void qt_gui_settings::set_value<double>(const QString& _name, const double& _value)
+    {
+        set_value_simple(_name, _value);
     }
 
-    template<> QRect qt_gui_settings::get_value<QRect>(const QString& _name, const QRect& _defaultValue) const
+    template<> void qt_gui_settings::set_value<bool>(const QString& _name, const bool& _value)
     {
-        std::vector<char> data;
-        if (!get_value_simple_data(_name, data))
-            return _defaultValue;
+        set_value_simple(_name, _value);
+    }
 
-        if (data.size() != sizeof(int32_t[4]))
+    template<> void qt_gui_settings::set_value<std::vector<int32_t>>(const QString& _name, const std::vector<int32_t>& _value)
+    {
+        if (_value.empty())
         {
-            assert(false);
-            return _defaultValue;
-        }
+            set_value_simple_data(_name, 0, 0);
 
-        int32_t* buffer = (int32_t*) &data[0];
+            return;
+        }
 
-        return QRect(buffer[0], buffer[1], buffer[2], buffer[3]);
+        set_value_simple_data(_name, (const char*)&_value[0], (int)_value.size() * sizeof(int32_t));
     }
 
-    template<> QRect qt_gui_settings::get_value<QRect>(const char* _name, const QRect& _defaultValue) const
+    template<> void qt_gui_settings::set_value<QRect>(const QString& _name, const QRect& _value)
     {
-        std::vector<char> data;
-        if (!get_value_simple_data(_name, data))
-            return _defaultValue;
-
-        if (data.size() != sizeof(int32_t[4]))
-        {
-            assert(false);
-            return _defaultValue;
-        }
-
-        int32_t* buffer = (int32_t*)&data[0];
+        int32_t buffer[4] = {_value.left(), _value.top(), _value.width(), _value.height()};
 
-        return QRect(buffer[0], buffer[1], buffer[2], buffer[3]);
+        set_value_simple_data(_name, (const char*) buffer, sizeof(buffer));
     }
 
 
@@ -190,7 +188,7 @@ namespace Ui
 
     int qt_gui_settings::get_current_shadow_width() const
     {
-        return (get_value<bool>(settings_window_maximized, false) == true ? 0 : shadowWidth_);
+        return (settings::window_maximized.get() ? 0 : shadowWidth_);
     }
 
     void qt_gui_settings::unserialize(core::coll_helper _collection)
@@ -221,17 +219,41 @@ namespace Ui
 
 
 
-    void qt_gui_settings::post_value_to_core(const QString& _name, const settings_value& _val) const
+    void qt_gui_settings::post_pending_values_to_core()
     {
+        post_scheduled_ = false;
+
+        if (pending_values_.empty())
+            return;
+
         Ui::gui_coll_helper cl_coll(GetDispatcher()->create_collection(), true);
 
-        core::ifptr<core::istream> data_stream(cl_coll->create_stream());
+        core::ifptr<core::iarray> values_array(cl_coll->create_array());
+        values_array->reserve((int)pending_values_.size());
+
+        for (const auto& name : pending_values_)
+        {
+            const auto data = find_value_data(name);
+            if (!data)
+                continue;
+
+            Ui::gui_coll_helper coll_value(GetDispatcher()->create_collection(), true);
+
+            core::ifptr<core::istream> data_stream(coll_value->create_stream());
+            if (!data->empty())
+                data_stream->write((const uint8_t*) &(*data)[0], (uint32_t)data->size());
+
+            coll_value.set_value_as_qstring("name", name);
+            coll_value.set_value_as_stream("value", data_stream.get());
+
+            core::ifptr<core::ivalue> val(coll_value->create_value());
+            val->set_as_collection(coll_value.get());
+            values_array->push_back(val.get());
+        }
 
-        if (_val.data_.size())
-            data_stream->write((const uint8_t*) &_val.data_[0], (uint32_t)_val.data_.size());
+        pending_values_.clear();
 
-        cl_coll.set_value_as_qstring("name", _name);
-        cl_coll.set_value_as_stream("value", data_stream.get());
+        cl_coll.set_value_as_array("values", values_array.get());
 
         GetDispatcher()->post_message_to_core(qsl("settings/value/set"), cl_coll.get());
     }
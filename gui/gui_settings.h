@@ -7,6 +7,87 @@ namespace Ui
     const int period_for_stats_settings_ms = 1e3 * 60 * 24;
     const int period_for_start_stats_settings_ms = 1e3 * 60 * 1;
 
+    // decodes the raw bytes kept for a value, _defaultValue is returned for a malformed one
+    template <class t_>
+    t_ decode_settings_value(const std::vector<char>& _data, const t_& _defaultValue)
+    {
+        if (_data.size() != sizeof(t_))
+        {
+            assert(false);
+            return _defaultValue;
+        }
+
+        t_ val;
+        ::memcpy(&val, &_data[0], sizeof(t_));
+
+        return val;
+    }
+
+    template<> QString decode_settings_value<QString>(const std::vector<char>& _data, const QString& _defaultValue);
+    template<> std::vector<int32_t> decode_settings_value<std::vector<int32_t>>(const std::vector<char>& _data, const std::vector<int32_t>& _defaultValue);
+    template<> QRect decode_settings_value<QRect>(const std::vector<char>& _data, const QRect& _defaultValue);
+
+    // a value of a known setting kept decoded, reading it is a plain load;
+    // slots are static objects which qt_gui_settings updates whenever the value with their name changes
+    class settings_slot_base
+    {
+        friend class qt_gui_settings;
+
+    public:
+        explicit settings_slot_base(const char* _name);
+        virtual ~settings_slot_base();
+
+        const char* get_name() const;
+
+    protected:
+        // nullptr when the value was removed
+        virtual void update(const std::vector<char>* _data) = 0;
+
+    private:
+        const char* name_;
+    };
+
+    template <class t_>
+    class settings_slot : public settings_slot_base
+    {
+    public:
+        settings_slot(const char* _name, const t_& _defaultValue)
+            : settings_slot_base(_name)
+            , default_(_defaultValue)
+            , value_(_defaultValue)
+        {
+        }
+
+        const t_& get() const
+        {
+            return value_;
+        }
+
+        void set(const t_& _value) const;
+
+    protected:
+        void update(const std::vector<char>* _data) override
+        {
+            value_ = (_data ? decode_settings_value(*_data, default_) : default_);
+        }
+
+    private:
+        const t_ default_;
+        t_ value_;
+    };
+
+    namespace settings
+    {
+        extern settings_slot<bool> cl_groups_enabled;
+        extern settings_slot<bool> show_popular_contacts;
+        extern settings_slot<bool> show_last_message;
+        extern settings_slot<bool> hide_message_timestamps;
+        extern settings_slot<bool> show_video_and_images;
+        extern settings_slot<bool> autoplay_video;
+        extern settings_slot<bool> sounds_enabled;
+        extern settings_slot<bool> window_maximized;
+    }
+
     class qt_gui_settings : public QObject
     {
         Q_OBJECT
@@ -25,25 +106,14 @@ Q_SIGNALS:
 
         std::map<QString, settings_value, StringComparator>   values_;
 
-        void post_value_to_core(const QString& _name, const settings_value& _val) const;
-
-        void set_value_simple_data(const QString& _name, const char* _data, int _len, bool _postToCore = true)
-        {
-            auto& val = values_[_name];
-            if (!_len)
-            {
-                val.data_.clear();
-                return;
-            }
-
-            val.data_.resize(_len);
-            memcpy(&val.data_[0], _data, _len);
+        // values changed since the last post, sent to core in one message
+        std::set<QString> pending_values_;
+        bool post_scheduled_;
 
-            if (_postToCore)
-                post_value_to_core(_name, val);
+        void post_pending_values_to_core();
+        void update_slots(const QString& _name, const std::vector<char>* _data);
 
-            emit changed(_name);
-        }
+        void set_value_simple_data(const QString& _name, const char* _data, int _len, bool _postToCore = true);
 
         template <class t_>
         void set_value_simple(const QString& _name, const t_& _value)
@@ -52,33 +122,28 @@ Q_SIGNALS:
         }
 
         template <class t_>
-        bool get_value_simple_data(const t_& _name, std::vector<char>& _data) const
+        const std::vector<char>* find_value_data(const t_& _name) const
         {
             auto iter = values_.find(_name);
             if (iter == values_.end())
-                return false;
+                return nullptr;
 
-            _data = iter->second.data_;
-            return true;
+            return &iter->second.data_;
+        }
+
+        const std::vector<char>* find_value_data(const char* _name) const
+        {
+            return find_value_data(QLatin1String(_name));
         }
 
         template <class t_, class u_>
         t_ get_value_simple(const u_& _name, const t_& _defaultValue) const
         {
-            std::vector<char> data;
-            if (!get_value_simple_data(_name, data))
+            const auto data = find_value_data(_name);
+            if (!data)
                 return _defaultValue;
 
-            if (data.size() != sizeof(t_))
-            {
-                assert(false);
-                return _defaultValue;
-            }
-
-            t_ val;
-            ::memcpy(&val, &data[0], sizeof(t_));
-
-            return val;
+            return decode_settings_value(*data, _defaultValue);
         }
 
     public:
@@ -92,15 +157,13 @@ Q_SIGNALS:
         template <class t_>
         t_ get_value(const QString& _name, const t_& _defaultValue) const
         {
-            assert(false);
-            return _defaultValue;
+            return get_value_simple(_name, _defaultValue);
         }
 
         template <class t_>
         t_ get_value(const char* _name, const t_& _defaultValue) const
         {
-            assert(false);
-            return _defaultValue;
+            return get_value_simple(_name, _defaultValue);
         }
 
         template <class t_>
@@ -128,25 +191,19 @@ Q_SIGNALS:
     };
 
     template<> void qt_gui_settings::set_value<QString>(const QString& _name, const QString& _value);
-    template<> QString qt_gui_settings::get_value<QString>(const QString& _name, const QString& _defaultValue) const;
-    template<> QString qt_gui_settings::get_value<QString>(const char* _name, const QString& _defaultValue) const;
     template<> void qt_gui_settings::set_value<int>(const QString& _name, const int& _value);
-    template <> int qt_gui_settings::get_value<int>(const QString& _name, const int& _defaultValue) const;
-    template <> int qt_gui_settings::get_value<int>(const char* _name, const int& _defaultValue) const;
     template<> void qt_gui_settings::set_value<double>(const QString& _name, const double& _value);
-    template <> double qt_gui_settings::get_value<double>(const QString& _name, const double& _defaultValue) const;
-    template <> double qt_gui_settings::get_value<double>(const char* _name, const double& _defaultValue) const;
     template<> void qt_gui_settings::set_value<bool>(const QString& _name, const bool& _value);
-    template <> bool qt_gui_settings::get_value<bool>(const QString& _name, const bool& _defaultValue) const;
-    template <> bool qt_gui_settings::get_value<bool>(const char* _name, const bool& _defaultValue) const;
     template<> void qt_gui_settings::set_value<std::vector<int32_t>>(const QString& _name, const std::vector<int32_t>& _value);
-    template<> std::vector<int32_t> qt_gui_settings::get_value<std::vector<int32_t>>(const QString& _name, const std::vector<int32_t>& _defaultValue) const;
-    template<> std::vector<int32_t> qt_gui_settings::get_value<std::vector<int32_t>>(const char* _name, const std::vector<int32_t>& _defaultValue) const;
     template<> void qt_gui_settings::set_value<QRect>(const QString& _name, const QRect& _value);
-    template<> QRect qt_gui_settings::get_value<QRect>(const QString& _name, const QRect& _defaultValue) const;
-    template<> QRect qt_gui_settings::get_value<QRect>(const char* _name, const QRect& _defaultValue) const;
 
     qt_gui_settings* get_gui_settings();
 
+    template <class t_>
+    void settings_slot<t_>::set(const t_& _value) const
+    {
+        get_gui_settings()->set_value<t_>(QLatin1String(get_name()), _value);
+    }
+
     std::string get_account_setting_name(const std::string& settingName);
 }
\ No newline at end of file
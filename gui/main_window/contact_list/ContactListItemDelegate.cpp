@@ -123,10 +123,10 @@ namespace Logic
             const auto isMultichat = Logic::getContactListModel()->isChat(aimId);
             auto isDefault = false;
 
-            const auto &avatar = Logic::GetAvatarStorage()->GetRounded(
+            const auto avatar = Logic::GetAvatarStorage()->GetRoundedAsync(
                 aimId, displayName, Utils::scale_bitmap(ContactList::GetContactListParams().getAvatarSize()),
                 isMultichat ? QString() : state,
-                isDefault, false /* _regenerate */ ,
+                isDefault,
                 ContactList::GetContactListParams().isCL());
             const ContactList::VisualDataBase visData(aimId, *avatar, state, status, isHovered, isSelected, displayName, hasLastSeen, lastSeen
                 , isChecked, isChatMember, isOfficial, false /* draw last read */, QPixmap() /* last seen avatar*/, role, 0 /* unread count */, QString() /* search_term */, false, false);
@@ -198,7 +198,7 @@ namespace Logic
 
     void ContactListModel::rebuildVisibleIndex()
     {
-        const auto groups_enabled = Ui::get_gui_settings()->get_value<bool>(settings_cl_groups_enabled, false);
+        const auto groups_enabled = Ui::settings::cl_groups_enabled.get();
 
         visible_indexes_.clear();
         for (const auto &order_index : sorted_index_cl_)
@@ -465,7 +465,7 @@ namespace Logic
     {
         ContactListSorting::contact_sort_pred less = ContactListSorting::ItemLessThanNoGroups(current);
 
-        if (Ui::get_gui_settings()->get_value<bool>(settings_cl_groups_enabled, false))
+        if (Ui::settings::cl_groups_enabled.get())
             less = ContactListSorting::ItemLessThan();
 
         return less;
@@ -476,7 +476,7 @@ namespace Logic
         _list.resize(contacts_.size());
         std::iota(_list.begin(), _list.end(), 0);
 
-        auto show_popular_contacts = Ui::get_gui_settings()->get_value<bool>(settings_show_popular_contacts, true);
+        auto show_popular_contacts = Ui::settings::show_popular_contacts.get();
         if (show_popular_contacts)
         {
             std::sort(_list.begin(), _list.end(), [this](const int& a, const int& b)
@@ -486,8 +486,8 @@ namespace Logic
 
                 if (fc.get_outgoing_msg_count() == sc.get_outgoing_msg_count())
                 {
-                    const auto fdlg = Logic::getRecentsModel()->getDlgState(fc.get_aimid());
-                    const auto sdlg = Logic::getRecentsModel()->getDlgState(sc.get_aimid());
+                    const auto& fdlg = Logic::getRecentsModel()->findDlgState(fc.get_aimid());
+                    const auto& sdlg = Logic::getRecentsModel()->findDlgState(sc.get_aimid());
 
                     if (fdlg.Time_ != -1 && sdlg.Time_ != -1)
                         return fdlg.Time_ > sdlg.Time_;
@@ -38,13 +38,12 @@ namespace Logic
         }
 
         bool isDef = false;
-        auto avatar = Logic::GetAvatarStorage()->GetRounded(
+        auto avatar = Logic::GetAvatarStorage()->GetRoundedAsync(
             item.aimId_,
             item.friendlyName_,
             Utils::scale_bitmap(avatarSize()),
             QString(),//Logic::getContactListModel()->getState(_item.aimId_),
             isDef,
-            false,
             false
         );
 
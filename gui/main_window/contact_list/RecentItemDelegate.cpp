@@ -101,13 +101,12 @@ namespace Logic
 
         auto displayName = (isMail || _dlg.isFromGlobalSearch_) ? _dlg.Friendly_ : Logic::getContactListModel()->getDisplayName(_dlg.AimId_);
 
-        auto avatar = GetAvatarStorage()->GetRounded(
+        auto avatar = GetAvatarStorage()->GetRoundedAsync(
             aimId,
             displayName,
             Utils::scale_bitmap(ContactList::GetRecentsParams(curViewParams.regim_).getAvatarSize()),
             state,
             isDefaultAvatar,
-            false,
             ContactList::GetRecentsParams(curViewParams.regim_).isCL()
         );
 
@@ -147,13 +146,12 @@ namespace Logic
         {
             if (isLastRead && !Logic::GetMessagesModel()->hasPending(_dlg.AimId_))
             {
-                lastReadAvatar = *GetAvatarStorage()->GetRounded(
+                lastReadAvatar = *GetAvatarStorage()->GetRoundedAsync(
                     _dlg.AimId_,
                     displayName,
                     Utils::scale_bitmap(ContactList::GetRecentsParams(curViewParams.regim_).getLastReadAvatarSize()),
                     QString(),
                     isDefaultAvatar,
-                    false,
                     ContactList::GetRecentsParams(curViewParams.regim_).isCL()
                 );
                 isDrawLastRead = true;
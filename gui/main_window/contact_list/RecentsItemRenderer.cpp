@@ -51,7 +51,7 @@ namespace ContactList
 
     static bool showLastMessage()
     {
-        return Ui::get_gui_settings()->get_value<bool>(settings_show_last_message, true);
+        return Ui::settings::show_last_message.get();
     }
 
     void RenderRecentsItem(QPainter &_painter, const RecentItemVisualData &_item, const ViewParams& _viewParams, const QRect& _itemRect)
@@ -25,6 +25,8 @@ namespace Logic
 		: CustomAbstractListModel(parent)
 		, Timer_(new QTimer(this))
         , FavoritesCount_(0)
+        , RecentsUnreads_(0)
+        , FavoritesUnreads_(0)
         , FavoritesVisible_(true)
         , FavoritesHeadVisible_(true)
 	{
@@ -100,30 +102,40 @@ namespace Logic
 		return QAbstractItemModel::flags(i) | Qt::ItemIsEnabled;
 	}
 
+    RecentsModel::DialogSlot::DialogSlot()
+        : Index_(-1)
+        , Unreads_(0)
+        , Favorite_(false)
+    {
+    }
+
     void RecentsModel::contactChanged(const QString& aimId)
     {
-        int i = Indexes_[aimId];
-        if (i != -1)
-        {
-            const auto idx = index(i);
-            emit dataChanged(idx, idx);
-        }
+        const auto slot = Slots_.find(aimId);
+        if (slot == Slots_.end())
+            return;
+
+        // the contact could be muted or unmuted
+        const auto unreads = totalUnreads();
+        uncountUnreads(*slot);
+        countUnreads(*slot);
+
+        const auto idx = index(slot->Index_);
+        emit dataChanged(idx, idx);
+
+        if (unreads != totalUnreads())
+            emit updated();
     }
 
 	void RecentsModel::activeDialogHide(const QString& aimId)
 	{
-		Data::DlgState state;
-		state.AimId_ = aimId;
-		auto iter = std::find(Dialogs_.begin(), Dialogs_.end(), state);
-		if (iter != Dialogs_.end())
+		const auto slot = Slots_.find(aimId);
+		if (slot != Slots_.end())
         {
-            if (iter->FavoriteTime_ != -1)
-                --FavoritesCount_;
+            const auto i = slot->Index_;
 
-            QString hideContact = iter->AimId_;
-            contactChanged(hideContact);
-            Indexes_[iter->AimId_] = -1;
-            Dialogs_.erase(iter);
+            contactChanged(aimId);
+            eraseDialog(i);
             if (Logic::getContactListModel()->selectedContact() == aimId)
                 Logic::getContactListModel()->setCurrent(QString(), -1, true);
             if (Dialogs_.empty() && !Logic::getUnknownsModel()->itemsCount())
@@ -146,10 +158,10 @@ namespace Logic
             if (!_dlgState.Official_ && !_dlgState.Chat_ && (!contactItem || (contactItem && contactItem->is_not_auth())))
                 continue;
 
-            auto iter = std::find(Dialogs_.begin(), Dialogs_.end(), _dlgState);
-            if (iter != Dialogs_.end())
+            const auto slot = Slots_.find(_dlgState.AimId_);
+            if (slot != Slots_.end())
             {
-                auto &existingDlgState = *iter;
+                auto &existingDlgState = Dialogs_[slot->Index_];
 
                 if (existingDlgState.FavoriteTime_ != _dlgState.FavoriteTime_)
                 {
@@ -170,7 +182,9 @@ namespace Logic
 
                 const auto existingText = existingDlgState.GetText();
 
+                uncountUnreads(*slot);
                 existingDlgState = _dlgState;
+                countUnreads(*slot);
 
                 const auto mustRecoverText = (!existingDlgState.HasText() && existingDlgState.HasLastMsgId());
                 if (mustRecoverText)
@@ -183,20 +197,16 @@ namespace Logic
                     if (!Timer_->isActive())
                         Timer_->start(SORT_TIMEOUT);
 
-                    int dist = (int)std::distance(Dialogs_.begin(), iter);
-                    const auto idx = index(dist);
+                    const auto idx = index(slot->Index_);
                     emit dataChanged(idx, idx);
                 }
             }
             else if (!_dlgState.GetText().isEmpty() || _dlgState.FavoriteTime_ != -1)
             {
+                addDialog(_dlgState);
+
                 if (_dlgState.FavoriteTime_ != -1)
-                {
-                    ++FavoritesCount_;
                     emit favoriteChanged(_dlgState.AimId_);
-                }
-
-                Dialogs_.push_back(_dlgState);
 
                 if (_dlgState.FavoriteTime_ != -1)
                 {
@@ -233,23 +243,19 @@ namespace Logic
 
     void RecentsModel::unknownToRecents(const Data::DlgState& dlgState)
     {
-        auto iter = std::find(Dialogs_.begin(), Dialogs_.end(), dlgState);
-        if (iter == Dialogs_.end() && (!dlgState.GetText().isEmpty() || dlgState.FavoriteTime_ != -1))
+        if (!Slots_.contains(dlgState.AimId_) && (!dlgState.GetText().isEmpty() || dlgState.FavoriteTime_ != -1))
         {
+            addDialog(dlgState);
             if (dlgState.FavoriteTime_ != -1)
-            {
-                ++FavoritesCount_;
                 emit favoriteChanged(dlgState.AimId_);
-            }
-            Dialogs_.push_back(dlgState);
             sortDialogs();
         }
     }
 
     bool RecentsModel::lessRecents(const QString& _aimid1, const QString& _aimid2)
     {
-        auto first = getDlgState(_aimid1);
-        auto second = getDlgState(_aimid2);
+        const auto& first = findDlgState(_aimid1);
+        const auto& second = findDlgState(_aimid2);
 
         if (first.FavoriteTime_ == -1 && second.FavoriteTime_ == -1)
             return first.Time_ > second.Time_;
@@ -284,13 +290,7 @@ namespace Logic
 
         });
 
-		Indexes_.clear();
-		int i = 0;
-		for (const auto& iter : Dialogs_)
-		{
-			Indexes_[iter.AimId_] = i;
-			++i;
-		}
+		updateIndexes(0);
 
 		emit dataChanged(index(0), index(rowCount()));
 		emit orderChanged();
@@ -308,10 +308,8 @@ namespace Logic
 
 	Data::DlgState RecentsModel::getDlgState(const QString& aimId, bool fromDialog)
 	{
-		Data::DlgState state;
-        auto iter = std::find_if(Dialogs_.begin(), Dialogs_.end(), [&aimId](const Data::DlgState &item) { return item.AimId_ == aimId; });
-		if (iter != Dialogs_.end())
-			state = *iter;
+		// a copy, sendLastRead below changes the dialog
+		Data::DlgState state = findDlgState(aimId);
 
 		if (fromDialog)
 			sendLastRead(aimId);
@@ -319,6 +317,17 @@ namespace Logic
 		return state;
 	}
 
+    const Data::DlgState& RecentsModel::findDlgState(const QString& _aimId) const
+    {
+        static const Data::DlgState empty;
+
+        const auto slot = Slots_.constFind(_aimId);
+        if (slot == Slots_.constEnd())
+            return empty;
+
+        return Dialogs_[slot->Index_];
+    }
+
     void RecentsModel::toggleFavoritesVisible()
     {
         FavoritesVisible_ = !FavoritesVisible_;
@@ -334,20 +343,24 @@ namespace Logic
 
 	void RecentsModel::sendLastRead(const QString& aimId)
 	{
-		Data::DlgState state;
-		state.AimId_ = aimId.isEmpty() ? Logic::getContactListModel()->selectedContact() : aimId;
-		std::vector<Data::DlgState>::iterator iter = std::find(Dialogs_.begin(), Dialogs_.end(), state);
-		if (iter != Dialogs_.end() && (iter->UnreadCount_ != 0 || iter->YoursLastRead_ < iter->LastMsgId_))
+		const auto contact = aimId.isEmpty() ? Logic::getContactListModel()->selectedContact() : aimId;
+		const auto slot = Slots_.find(contact);
+		if (slot == Slots_.end())
+			return;
+
+		auto& state = Dialogs_[slot->Index_];
+		if (state.UnreadCount_ != 0 || state.YoursLastRead_ < state.LastMsgId_)
 		{
-			iter->UnreadCount_ = 0;
+			uncountUnreads(*slot);
+			state.UnreadCount_ = 0;
+			countUnreads(*slot);
 
 			Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
-			collection.set_value_as_qstring("contact", state.AimId_);
-			collection.set_value_as_int64("message", iter->LastMsgId_);
+			collection.set_value_as_qstring("contact", contact);
+			collection.set_value_as_int64("message", state.LastMsgId_);
 			Ui::GetDispatcher()->post_message_to_core(qsl("dlg_state/set_last_read"), collection.get());
 
-			int ind = (int)std::distance(Dialogs_.begin(), iter);
-            const auto idx = index(ind);
+            const auto idx = index(slot->Index_);
 			emit dataChanged(idx, idx);
 			emit updated();
 		}
@@ -390,11 +403,9 @@ namespace Logic
 
     bool RecentsModel::isFavorite(const QString& aimid) const
     {
-        Data::DlgState state;
-        state.AimId_ = aimid;
-        std::vector<Data::DlgState>::const_iterator iter = std::find(Dialogs_.begin(), Dialogs_.end(), state);
-        if (iter != Dialogs_.end())
-            return iter->FavoriteTime_ != -1;
+        const auto slot = Slots_.constFind(aimid);
+        if (slot != Slots_.constEnd())
+            return slot->Favorite_;
 
         return false;
     }
@@ -435,18 +446,11 @@ namespace Logic
 
 	QModelIndex RecentsModel::contactIndex(const QString& aimId) const
 	{
-		int i = 0;
-		for (const auto& iter : Dialogs_)
-		{
-			if (iter.AimId_ == aimId)
-            {
-                break;
-            }
-			++i;
-		}
-
-        if (i < (int)Dialogs_.size())
+        const auto slot = Slots_.constFind(aimId);
+        if (slot != Slots_.constEnd())
         {
+            auto i = slot->Index_;
+
             if (FavoritesCount_)
             {
                 if (i >= visibleContactsInFavorites())
@@ -481,35 +485,17 @@ namespace Logic
 
 	int RecentsModel::totalUnreads() const
 	{
-		int result = 0;
-		for (auto iter : Dialogs_)
-		{
-			if (!Logic::getContactListModel()->isMuted(iter.AimId_))
-				result += iter.UnreadCount_;
-		}
-		return result;
+		return RecentsUnreads_ + FavoritesUnreads_;
 	}
 
     int RecentsModel::recentsUnreads() const
     {
-        int result = 0;
-        for (const auto& iter : Dialogs_)
-        {
-            if (!Logic::getContactListModel()->isMuted(iter.AimId_) && iter.FavoriteTime_ == -1)
-                result += iter.UnreadCount_;
-        }
-        return result;
+        return RecentsUnreads_;
     }
 
     int RecentsModel::favoritesUnreads() const
     {
-        int result = 0;
-        for (const auto& iter : Dialogs_)
-        {
-            if (!Logic::getContactListModel()->isMuted(iter.AimId_) && iter.FavoriteTime_ != -1)
-                result += iter.UnreadCount_;
-        }
-        return result;
+        return FavoritesUnreads_;
     }
 
     QString RecentsModel::nextUnreadAimId() const
@@ -528,24 +514,18 @@ namespace Logic
 
     QString RecentsModel::nextAimId(const QString& aimId) const
     {
-        for (size_t i = 0; i < Dialogs_.size(); i++)
-        {
-            const Data::DlgState& iter = Dialogs_.at(i);
-            if (iter.AimId_ == aimId && i < Dialogs_.size() - 1)
-                return Dialogs_.at(i + 1).AimId_;
-        }
+        const auto slot = Slots_.constFind(aimId);
+        if (slot != Slots_.constEnd() && slot->Index_ < (int)Dialogs_.size() - 1)
+            return Dialogs_[slot->Index_ + 1].AimId_;
 
         return QString();
     }
 
     QString RecentsModel::prevAimId(const QString& aimId) const
     {
-        for (size_t i = 0; i < Dialogs_.size(); i++)
-        {
-            const Data::DlgState& iter = Dialogs_.at(i);
-            if (iter.AimId_ == aimId && i > 0)
-                return Dialogs_.at(i - 1).AimId_;
-        }
+        const auto slot = Slots_.constFind(aimId);
+        if (slot != Slots_.constEnd() && slot->Index_ > 0)
+            return Dialogs_[slot->Index_ - 1].AimId_;
 
         return QString();
     }
@@ -610,6 +590,64 @@ namespace Logic
         FavoritesHeadVisible_ = _isVisible;
     }
 
+    void RecentsModel::addDialog(const Data::DlgState& _state)
+    {
+        assert(!Slots_.contains(_state.AimId_));
+
+        if (_state.FavoriteTime_ != -1)
+            ++FavoritesCount_;
+
+        Dialogs_.push_back(_state);
+
+        auto& slot = Slots_[_state.AimId_];
+        slot.Index_ = (int)Dialogs_.size() - 1;
+        countUnreads(slot);
+    }
+
+    void RecentsModel::eraseDialog(int _index)
+    {
+        const auto iter = Dialogs_.begin() + _index;
+
+        const auto slot = Slots_.find(iter->AimId_);
+        assert(slot != Slots_.end());
+
+        uncountUnreads(*slot);
+        Slots_.erase(slot);
+
+        if (iter->FavoriteTime_ != -1)
+            --FavoritesCount_;
+
+        Dialogs_.erase(iter);
+        updateIndexes(_index);
+    }
+
+    void RecentsModel::updateIndexes(int _from)
+    {
+        for (int i = _from; i < (int)Dialogs_.size(); ++i)
+            Slots_[Dialogs_[i].AimId_].Index_ = i;
+    }
+
+    void RecentsModel::countUnreads(DialogSlot& _slot)
+    {
+        const auto& state = Dialogs_[_slot.Index_];
+
+        _slot.Unreads_ = Logic::getContactListModel()->isMuted(state.AimId_) ? 0 : (int)state.UnreadCount_;
+        _slot.Favorite_ = (state.FavoriteTime_ != -1);
+
+        if (_slot.Favorite_)
+            FavoritesUnreads_ += _slot.Unreads_;
+        else
+            RecentsUnreads_ += _slot.Unreads_;
+    }
+
+    void RecentsModel::uncountUnreads(const DialogSlot& _slot)
+    {
+        if (_slot.Favorite_)
+            FavoritesUnreads_ -= _slot.Unreads_;
+        else
+            RecentsUnreads_ -= _slot.Unreads_;
+    }
+
     bool RecentsModel::isServiceAimId(const QString& _aimId) const
     {
         return _aimId.startsWith(ql1c('~')) && _aimId.endsWith(ql1c('~'));
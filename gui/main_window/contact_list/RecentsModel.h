@@ -42,6 +42,9 @@ namespace Logic
 		Qt::ItemFlags flags(const QModelIndex &index) const;
 
 		Data::DlgState getDlgState(const QString& aimId = QString(), bool fromDialog = false);
+
+        // an empty state when there is no such dialog, valid until the dialogs change
+        const Data::DlgState& findDlgState(const QString& _aimId) const;
         void unknownToRecents(const Data::DlgState&);
 
         void toggleFavoritesVisible();
@@ -90,10 +93,30 @@ namespace Logic
         int getRecentsHeaderIndex() const;
         int getVisibleServiceItemInFavorites() const;
 
+        struct DialogSlot
+        {
+            DialogSlot();
+
+            int Index_;
+
+            // what the dialog has added to the unread counters
+            int Unreads_;
+            bool Favorite_;
+        };
+
+        void addDialog(const Data::DlgState& _state);
+        void eraseDialog(int _index);
+        void updateIndexes(int _from);
+
+        void countUnreads(DialogSlot& _slot);
+        void uncountUnreads(const DialogSlot& _slot);
+
 		std::vector<Data::DlgState> Dialogs_;
-		QHash<QString, int> Indexes_;
+		QHash<QString, DialogSlot> Slots_;
 		QTimer* Timer_;
         quint16 FavoritesCount_;
+        int RecentsUnreads_;
+        int FavoritesUnreads_;
         bool FavoritesVisible_;
         bool FavoritesHeadVisible_;
 	};
@@ -78,13 +78,12 @@ namespace Logic
 
         bool isDefault = false;
 
-        const auto avatar = *GetAvatarStorage()->GetRounded(
+        const auto avatar = *GetAvatarStorage()->GetRoundedAsync(
             _dlg.AimId_,
             QString(),
             Utils::scale_bitmap(ContactList::GetRecentsParams(viewParams_.regim_).getAvatarSize()),
             state,
             isDefault,
-            false,
             ContactList::GetRecentsParams(viewParams_.regim_).isCL()
         );
 
@@ -107,10 +106,10 @@ namespace Logic
 
         if (!isMultichat && isOutgoing && isLastRead && !Logic::GetMessagesModel()->hasPending(_dlg.AimId_))
         {
-            lastReadAvatar = *GetAvatarStorage()->GetRounded(
+            lastReadAvatar = *GetAvatarStorage()->GetRoundedAsync(
                 _dlg.AimId_, QString(),
                 Utils::scale_bitmap(ContactList::GetRecentsParams(viewParams_.regim_).getLastReadAvatarSize()),
-                QString(), isDefault, false, ContactList::GetRecentsParams(viewParams_.regim_).isCL());
+                QString(), isDefault, ContactList::GetRecentsParams(viewParams_.regim_).isCL());
             isDrawLastRead = true;
         }
 
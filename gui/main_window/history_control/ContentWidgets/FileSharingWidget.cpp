@@ -188,7 +188,7 @@ namespace HistoryControl
         , PreviewDownloadId_(-1)
         , IsCtrlButtonHovered_(false)
         , IsVisible_(false)
-        , autoplayVideo_(Ui::get_gui_settings()->get_value<bool>(settings_autoplay_video, true))
+        , autoplayVideo_(Ui::settings::autoplay_video.get())
         , ShareButton_(nullptr)
         , ref_(new bool(false))
     {
@@ -215,7 +215,7 @@ namespace HistoryControl
         , FileDownloadId_(-1)
         , PreviewDownloadId_(-1)
         , IsCtrlButtonHovered_(false)
-        , autoplayVideo_(Ui::get_gui_settings()->get_value<bool>(settings_autoplay_video, true))
+        , autoplayVideo_(Ui::settings::autoplay_video.get())
         , ShareButton_(nullptr)
         , IsInPreloadDistance_(true)
         , ref_(new bool(false))
@@ -2246,7 +2246,7 @@ namespace HistoryControl
 
         if (isGifOrVideo() && !isFullImageDownloading())
         {
-            if (isGif() || Ui::get_gui_settings()->get_value<bool>(settings_autoplay_video, true))
+            if (isGif() || Ui::settings::autoplay_video.get())
             {
                 setState(State::ImageFile_Downloading);
                 startDownloadingFullImage();
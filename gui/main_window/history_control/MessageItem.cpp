@@ -522,7 +522,7 @@ namespace Ui
         if (!TimeWidget_)
             return;
 
-        if (get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true))
+        if (Ui::settings::hide_message_timestamps.get())
         {
             TimeWidget_->hideAnimated();
 
@@ -1428,7 +1428,7 @@ namespace Ui
 
     void MessageItem::showHiddenControls()
     {
-        if (TimeWidget_ && isVisible() && get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true))
+        if (TimeWidget_ && isVisible() && Ui::settings::hide_message_timestamps.get())
             TimeWidget_->showAnimated();
 
         showMessageStatus();
@@ -1439,7 +1439,7 @@ namespace Ui
         const bool canHide = TimeWidget_
             && !bubbleHovered_
             && isVisible()
-            && get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true);
+            && Ui::settings::hide_message_timestamps.get();
 
         if (canHide)
             TimeWidget_->hideAnimated();
@@ -96,7 +96,7 @@ namespace Ui
 
     void MessageTimeWidget::showIfNeeded()
     {
-        if (!get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true))
+        if (!Ui::settings::hide_message_timestamps.get())
             showAnimated();
     }
 }
\ No newline at end of file
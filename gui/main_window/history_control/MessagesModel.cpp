@@ -34,6 +34,31 @@
 
 namespace
 {
+    // the least recently used inactive dialogs are trimmed when all the dialogs take more
+    const size_t dialogsMemoryBudget = 32 * 1024 * 1024;
+
+    // messages left in a trimmed dialog, the rest is requested from the archive again when it is opened
+    const int trimmedDialogTailSize = 5;
+
+    const std::chrono::milliseconds memoryCheckTimeout = std::chrono::seconds(10);
+
+    size_t getMessageMemoryUsage(const Logic::Message& _message)
+    {
+        // a map node is the value and about four pointers
+        size_t result = sizeof(Logic::MessagesMap::value_type) + 4 * sizeof(void*);
+
+        const auto buddy = _message.getBuddy();
+        if (!buddy)
+            return result;
+
+        result += sizeof(Data::MessageBuddy) + (buddy->GetText().size() + buddy->InternalId_.size()) * sizeof(QChar);
+
+        for (const auto& quote : buddy->Quotes_)
+            result += sizeof(Data::Quote) + quote.text_.size() * sizeof(QChar);
+
+        return result;
+    }
+
     QString NormalizeAimId(const QString& _aimId)
     {
         const int pos = _aimId.indexOf(ql1s("@uin.icq"));
@@ -670,6 +695,48 @@ namespace Logic
         return postponeUpdate_;
     }
 
+    void ContactDialog::setLastUsed(quint64 _lastUsed) noexcept
+    {
+        lastUsed_ = _lastUsed;
+    }
+
+    quint64 ContactDialog::getLastUsed() const noexcept
+    {
+        return lastUsed_;
+    }
+
+    void ContactDialog::setActive(bool _active) noexcept
+    {
+        active_ = _active;
+    }
+
+    bool ContactDialog::isActive() const noexcept
+    {
+        return active_;
+    }
+
+    size_t ContactDialog::getMemoryUsage() const
+    {
+        size_t result = 0;
+
+        if (messages_)
+        {
+            for (const auto& message : *messages_)
+                result += getMessageMemoryUsage(message.second);
+        }
+
+        if (pendingMessages_)
+        {
+            for (const auto& message : *pendingMessages_)
+                result += getMessageMemoryUsage(message.second);
+        }
+
+        if (dateItems_)
+            result += dateItems_->size() * (sizeof(DatesMap::value_type) + 4 * sizeof(void*));
+
+        return result;
+    }
+
     MessagesMap& ContactDialog::getMessages()
     {
         if (!messages_)
@@ -935,9 +1002,16 @@ namespace Logic
 
     MessagesModel::MessagesModel(QObject *parent)
         : QObject(parent)
+        , useCounter_(0)
+        , memoryCheckTimer_(new QTimer(this))
         , itemWidth_(0)
     {
         setObjectName(qsl("MessagesModel"));
+
+        memoryCheckTimer_->setSingleShot(true);
+        memoryCheckTimer_->setInterval(memoryCheckTimeout.count());
+        connect(memoryCheckTimer_, &QTimer::timeout, this, &MessagesModel::checkMemoryBudget);
+
         const bool connections[] = {
         connect(
             Ui::GetDispatcher(),
@@ -1539,6 +1613,9 @@ namespace Logic
         assert(_option > Ui::MessagesBuddiesOpt::Min);
         assert(_option < Ui::MessagesBuddiesOpt::Max);
 
+        if (!memoryCheckTimer_->isActive())
+            memoryCheckTimer_->start();
+
         auto regim = model_regim::normal_load;
         if (seqAndJumpBottom_.contains(_seq))
             regim = model_regim::jump_to_bottom;
@@ -2431,7 +2508,7 @@ namespace Logic
 
         std::unique_ptr<HistoryControl::MessageContentWidget> item;
 
-        const auto previewsEnabled = Ui::get_gui_settings()->get_value<bool>(settings_show_video_and_images, true);
+        const auto previewsEnabled = Ui::settings::show_video_and_images.get();
 
 
         item = std::make_unique<HistoryControl::FileSharingWidget>(
@@ -2835,7 +2912,7 @@ namespace Logic
                 _msg.AimId_;
 
 
-        const bool previewsEnabled = Ui::get_gui_settings()->get_value<bool>(settings_show_video_and_images, true);
+        const bool previewsEnabled = Ui::settings::show_video_and_images.get();
         const bool isSitePreview = ((previewsEnabled && (_msg.GetPreviewableLinkType() == preview_type::site)));
         const bool is_not_auth = (!_msg.Chat_ && Logic::getContactListModel()->isNotAuth(_msg.AimId_));
 
@@ -3105,6 +3182,8 @@ namespace Logic
             return;
 
         auto& d = getContactDialog(_contact);
+        d.setActive(true);
+        d.setLastUsed(++useCounter_);
         d.setInitMessage(_messageId);
         d.setFirstUnreadMessage(-1);
         d.setMessageCountAfter(_dlgState.UnreadCount_);
@@ -3150,6 +3229,7 @@ namespace Logic
         std::map<MessageKey, Ui::HistoryControlPageItem*> result;
 
         auto& dialog = getContactDialog(aimId);
+        dialog.setLastUsed(++useCounter_);
         const auto& dialogMessages = dialog.getMessages();
         const auto& pendingMessages = dialog.getPendingMessages();
 
@@ -3221,6 +3301,7 @@ namespace Logic
     {
         CHECK_THREAD
         auto& dialog = getContactDialog(aimId);
+        dialog.setLastUsed(++useCounter_);
         auto& dialogMessages = dialog.getMessages();
         auto& pendingMessages = dialog.getPendingMessages();
 
@@ -3690,6 +3771,122 @@ namespace Logic
         return SendersVector();
     }
 
+    void MessagesModel::checkMemoryBudget()
+    {
+        CHECK_THREAD
+        size_t usage = 0;
+
+        std::vector<std::pair<quint64, QString>> inactive;
+
+        for (auto iter = dialogs_.cbegin(); iter != dialogs_.cend(); ++iter)
+        {
+            const auto& dialog = *iter.value();
+
+            usage += dialog.getMemoryUsage();
+
+            if (!dialog.isActive())
+                inactive.emplace_back(dialog.getLastUsed(), iter.key());
+        }
+
+        if (usage <= dialogsMemoryBudget)
+            return;
+
+        // the least recently used go first
+        std::sort(inactive.begin(), inactive.end());
+
+        for (const auto& item : inactive)
+        {
+            if (usage <= dialogsMemoryBudget)
+                return;
+
+            const auto& dialog = *dialogs_[item.second];
+
+            const auto before = dialog.getMemoryUsage();
+            trimDialog(item.second, trimmedDialogTailSize);
+            usage -= (before - dialog.getMemoryUsage());
+        }
+
+        // the tails are still too big, the dialogs are dropped and requested again when they are opened
+        for (const auto& item : inactive)
+        {
+            if (usage <= dialogsMemoryBudget)
+                return;
+
+            const auto& dialog = *dialogs_[item.second];
+            if (dialog.hasPending())
+                continue;
+
+            usage -= dialog.getMemoryUsage();
+            removeDialog(item.second);
+        }
+    }
+
+    void MessagesModel::trimDialog(const QString& _aimId, const int _count)
+    {
+        CHECK_THREAD
+        assert(_count > 0);
+
+        auto& dialog = getContactDialog(_aimId);
+        auto& dialogMessages = dialog.getMessages();
+
+        // the oldest message to keep, pending messages and dates are not counted
+        auto first = dialogMessages.end();
+        auto count = 0;
+        for (auto iter = dialogMessages.rbegin(); iter != dialogMessages.rend() && count < _count; ++iter)
+        {
+            if (!iter->first.isPending() && !iter->first.isDate())
+            {
+                first = std::prev(iter.base());
+                ++count;
+            }
+        }
+
+        if (count < _count)
+            return;
+
+        const auto firstBuddy = first->second.getBuddy();
+        const auto firstDate = (firstBuddy ? firstBuddy->GetDate() : QDate());
+
+        QVector<MessageKey> deletedValues;
+
+        for (auto iter = dialogMessages.begin(); iter != first;)
+        {
+            if (iter->first.isPending())
+            {
+                ++iter;
+                continue;
+            }
+
+            if (iter->first.isDate())
+            {
+                // the date of the tail stays above it
+                if (iter->second.getDate() == firstDate)
+                {
+                    ++iter;
+                    continue;
+                }
+
+                dialog.removeDateItem(iter->second.getDate());
+            }
+
+            deletedValues << iter->first;
+            iter = dialogMessages.erase(iter);
+        }
+
+        if (deletedValues.isEmpty())
+            return;
+
+        const auto& key = dialogMessages.cbegin()->first;
+        if (dialog.getLastKey() < key)
+            dialog.setLastKey(key);
+
+        dialog.setLastRequestedMessage(-1);
+
+        emitDeleted(deletedValues, _aimId);
+
+        updateDateItems(_aimId);
+    }
+
     ContactDialog& MessagesModel::getContactDialog(const QString& _aimid)
     {
         CHECK_THREAD
@@ -333,6 +333,9 @@ namespace Logic
         scroll_mode_type scrollMode_ = scroll_mode_type::none;
         bool postponeUpdate_ = false;
 
+        quint64 lastUsed_ = 0;
+        bool active_ = false;
+
     public:
         void setLastRequestedMessage(const qint64 _message);
         qint64 getLastRequestedMessage() const;
@@ -351,6 +354,17 @@ namespace Logic
         void enablePostponeUpdate(bool _enable) noexcept;
         bool isPostponeUpdateEnabled() const noexcept;
 
+        // the model's use counter value when the dialog was used last time
+        void setLastUsed(quint64 _lastUsed) noexcept;
+        quint64 getLastUsed() const noexcept;
+
+        // a dialog is active while it has a history page, the inactive ones may be trimmed or dropped
+        void setActive(bool _active) noexcept;
+        bool isActive() const noexcept;
+
+        // estimated size of the messages held by the dialog in bytes
+        size_t getMemoryUsage() const;
+
         MessagesMap& getMessages();
         MessagesMap& getPendingMessages();
         DatesMap& getDatesMap();
@@ -588,9 +602,14 @@ namespace Logic
 
         void requestNewMessages(const QString& _aimId, const QVector<qint64>& _ids, MessagesMap& _messages);
 
+        void checkMemoryBudget();
+        void trimDialog(const QString& _aimId, const int _count);
+
     private:
 
         QHash<QString, std::shared_ptr<ContactDialog>> dialogs_;
+        quint64 useCounter_;
+        QTimer* memoryCheckTimer_;
 
         QStringList requestedContact_;
         QStringList failedUploads_;
@@ -366,7 +366,7 @@ namespace Ui
 
     void VoipEventItem::hideEvent(QHideEvent *)
     {
-        if (TimeWidget_ && get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true))
+        if (TimeWidget_ && Ui::settings::hide_message_timestamps.get())
             TimeWidget_->hide();
     }
 
@@ -457,7 +457,7 @@ namespace Ui
 
     void VoipEventItem::showHiddenControls()
     {
-        if (get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true) && isVisible() && TimeWidget_)
+        if (Ui::settings::hide_message_timestamps.get() && isVisible() && TimeWidget_)
             TimeWidget_->showAnimated();
 
         showMessageStatus();
@@ -465,7 +465,7 @@ namespace Ui
 
     void VoipEventItem::hideHiddenControls()
     {
-        const bool canHide = get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true)
+        const bool canHide = Ui::settings::hide_message_timestamps.get()
             && isVisible()
             && TimeWidget_
             && !IsBubbleHovered_;
@@ -735,7 +735,7 @@ void ComplexMessageItem::paintEvent(QPaintEvent *event)
 
 void ComplexMessageItem::hideEvent(QHideEvent *)
 {
-    if (TimeWidget_ && get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true))
+    if (TimeWidget_ && Ui::settings::hide_message_timestamps.get())
         TimeWidget_->hideAnimated();
 }
 
@@ -1494,7 +1494,7 @@ void ComplexMessageItem::contextMenuHide()
 
 void ComplexMessageItem::showHiddenControls()
 {
-    if (TimeWidget_ && isVisible() && get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true))
+    if (TimeWidget_ && isVisible() && Ui::settings::hide_message_timestamps.get())
         TimeWidget_->showAnimated();
 
     showMessageStatus();
@@ -1505,7 +1505,7 @@ void ComplexMessageItem::hideHiddenControls()
     const bool canHide = TimeWidget_
         && !bubbleHovered_
         && isVisible()
-        && get_gui_settings()->get_value<bool>(settings_hide_message_timestamps, true);
+        && Ui::settings::hide_message_timestamps.get();
 
     if (canHide)
         TimeWidget_->hideAnimated();
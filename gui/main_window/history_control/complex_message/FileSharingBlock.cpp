@@ -1120,7 +1120,7 @@ void FileSharingBlock::onDownloading(const int64_t _bytesTransferred, const int6
 
 void FileSharingBlock::onMetainfoDownloaded()
 {
-    if (isGifImage() || (isVideo() && get_gui_settings()->get_value<bool>(settings_autoplay_video, true)))
+    if (isGifImage() || (isVideo() && Ui::settings::autoplay_video.get()))
     {
         startDownloading(false);
     }
@@ -22,7 +22,7 @@ bool Ui::ComplexMessage::ChunkIterator::hasNext() const
 
 static inline bool isPreviewsEnabled()
 {
-    return Ui::get_gui_settings()->get_value<bool>(settings_show_video_and_images, true);
+    return Ui::settings::show_video_and_images.get();
 }
 
 Ui::ComplexMessage::TextChunk Ui::ComplexMessage::ChunkIterator::current(bool _allowSnipet) const
@@ -25,6 +25,9 @@ namespace Ui
     const int max_video_w = 1280;
     const int max_video_h = 720;
 
+    const int32_t maxVideoDecodeWorkers = 4;
+    const int32_t maxPooledFrames = 8;
+
     const int64_t empty_pts = -1000000;
 
     bool ThreadMessagesQueue::getMessage(ThreadMessage& _message, std::function<bool()> _isQuit, int32_t _wait_timeout)
@@ -158,6 +161,47 @@ namespace Ui
     }
 
 
+    //////////////////////////////////////////////////////////////////////////
+    // VideoFramePool
+    //////////////////////////////////////////////////////////////////////////
+    VideoFramePool::VideoFramePool(int32_t _maxFrames)
+        : maxFrames_(_maxFrames)
+    {
+    }
+
+    QImage VideoFramePool::acquire(const QSize& _size)
+    {
+        // the frame is free when the gui has dropped all its copies of it
+        for (auto iter = frames_.begin(); iter != frames_.end(); ++iter)
+        {
+            if (iter->size() == _size && iter->isDetached())
+            {
+                QImage frame = std::move(*iter);
+                frames_.erase(iter);
+                return frame;
+            }
+        }
+
+        return QImage(_size, QImage::Format_RGBA8888);
+    }
+
+    void VideoFramePool::release(QImage&& _frame)
+    {
+        if (_frame.isNull())
+            return;
+
+        frames_.push_back(std::move(_frame));
+
+        if ((int32_t) frames_.size() > maxFrames_)
+            frames_.pop_front();
+    }
+
+    void VideoFramePool::clear()
+    {
+        frames_.clear();
+    }
+
+
     MediaData::MediaData()
         : syncWithAudio_(false)
         , videoStream_(nullptr)
@@ -168,7 +212,6 @@ namespace Ui
         , audioQueue_(QSharedPointer<PacketQueue>::create())
         , needUpdateSwsContext_(false)
         , swsContext_(nullptr)
-        , frameRGB_(nullptr)
         , width_(0)
         , height_(0)
         , rotation_(0)
@@ -201,6 +244,13 @@ namespace Ui
         : quit_(false)
         , curr_id_(0)
     {
+        const auto workers = std::max(1, std::min(QThread::idealThreadCount() / 2, maxVideoDecodeWorkers));
+
+        for (int32_t i = 0; i < workers; ++i)
+            videoThreadMessagesQueues_.push_back(std::make_unique<ThreadMessagesQueue>());
+
+        videoWorkersLoad_.assign(workers, 0);
+
         QObject::connect(this, &VideoContext::audioQuit, this, &VideoContext::onAudioQuit);
         QObject::connect(this, &VideoContext::videoQuit, this, &VideoContext::onVideoQuit);
         QObject::connect(this, &VideoContext::demuxQuit, this, &VideoContext::onDemuxQuit);
@@ -256,9 +306,55 @@ namespace Ui
             activeVideos_.erase(_videoId);
         }
 
+        releaseVideoWorker(_videoId);
+
         getMediaContainer()->stopMedia(_videoId);
     }
 
+    int32_t VideoContext::getVideoWorkersCount() const
+    {
+        return (int32_t) videoThreadMessagesQueues_.size();
+    }
+
+    int32_t VideoContext::getVideoWorker(uint32_t _videoId)
+    {
+        std::lock_guard<std::mutex> lock(videoWorkersMutex_);
+
+        auto iter = videoWorkers_.find(_videoId);
+        if (iter != videoWorkers_.end())
+            return iter->second;
+
+        const auto worker = int32_t(std::min_element(videoWorkersLoad_.begin(), videoWorkersLoad_.end()) - videoWorkersLoad_.begin());
+
+        ++videoWorkersLoad_[worker];
+        videoWorkers_[_videoId] = worker;
+
+        return worker;
+    }
+
+    int32_t VideoContext::findVideoWorker(uint32_t _videoId) const
+    {
+        std::lock_guard<std::mutex> lock(videoWorkersMutex_);
+
+        auto iter = videoWorkers_.find(_videoId);
+        if (iter == videoWorkers_.end())
+            return -1;
+
+        return iter->second;
+    }
+
+    void VideoContext::releaseVideoWorker(uint32_t _videoId)
+    {
+        std::lock_guard<std::mutex> lock(videoWorkersMutex_);
+
+        auto iter = videoWorkers_.find(_videoId);
+        if (iter == videoWorkers_.end())
+            return;
+
+        --videoWorkersLoad_[iter->second];
+        videoWorkers_.erase(iter);
+    }
+
     ffmpeg::AVStream* VideoContext::openStream(int32_t _type, ffmpeg::AVFormatContext* _context)
     {
         ffmpeg::AVStream* stream = 0;
@@ -1264,7 +1360,28 @@ namespace Ui
 
     void VideoContext::postVideoThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
     {
-        videoThreadMessagesQueue_.pushMessage(_message, _forward, _clear_others);
+        if (_message.message_ == thread_message_type::tmt_wake_up)
+        {
+            for (auto& queue : videoThreadMessagesQueues_)
+                queue->pushMessage(_message, _forward, _clear_others);
+
+            return;
+        }
+
+        // only tmt_init pins a worker, so a late message of a closed video doesn't pin it again
+        const auto worker = (_message.message_ == thread_message_type::tmt_init)
+            ? getVideoWorker(_message.videoId_)
+            : findVideoWorker(_message.videoId_);
+
+        if (worker != -1)
+        {
+            videoThreadMessagesQueues_[worker]->pushMessage(_message, _forward, _clear_others);
+            return;
+        }
+
+        // the worker answers tmt_quit of an unknown video with videoQuit, the rest it skips anyway
+        if (_message.message_ == thread_message_type::tmt_quit)
+            videoThreadMessagesQueues_.front()->pushMessage(_message, _forward, _clear_others);
     }
 
     void VideoContext::postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others)
@@ -1289,7 +1406,9 @@ namespace Ui
 
     void VideoContext::clearMessageQueue()
     {
-        videoThreadMessagesQueue_.clear();
+        for (auto& queue : videoThreadMessagesQueues_)
+            queue->clear();
+
         audioThreadMessageQueue_.clear();
         demuxThreadMessageQueue_.clear();
     }
@@ -1304,9 +1423,9 @@ namespace Ui
         _media.audioData_.state_ = _state;
     }
 
-    bool VideoContext::getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout)
+    bool VideoContext::getVideoThreadMessage(int32_t _worker, ThreadMessage& _message, int32_t _waitTimeout)
     {
-        return videoThreadMessagesQueue_.getMessage(_message, [this]{return isQuit();}, _waitTimeout);
+        return videoThreadMessagesQueues_[_worker]->getMessage(_message, [this]{return isQuit();}, _waitTimeout);
     }
 
     bool VideoContext::updateScaleContext(MediaData& _media, const QSize _sz)
@@ -1325,15 +1444,9 @@ namespace Ui
 
     void VideoContext::freeScaleContext(MediaData& _media)
     {
-        if (_media.frameRGB_)
-        {
-            ffmpeg::av_frame_unref(_media.frameRGB_);
-            ffmpeg::av_frame_free(&_media.frameRGB_);
-        }
-
-        _media.frameRGB_ = 0;
-
         sws_freeContext(_media.swsContext_);
+
+        _media.swsContext_ = nullptr;
     }
 
     bool VideoContext::enableAudio(MediaData& _media) const
@@ -1881,12 +1994,55 @@ namespace Ui
     //////////////////////////////////////////////////////////////////////////
     // VideoDecodeThread
     //////////////////////////////////////////////////////////////////////////
-    VideoDecodeThread::VideoDecodeThread(VideoContext& _ctx)
-        :   ctx_(_ctx)
+    VideoDecodeThread::VideoDecodeThread(VideoContext& _ctx, int32_t _worker)
+        :   ctx_(_ctx),
+            worker_(_worker),
+            framePool_(maxPooledFrames)
     {
 
     }
 
+    bool VideoDecodeThread::scaleFrame(ffmpeg::AVFrame* _frame, MediaData& _media, /*OUT*/QImage& _image)
+    {
+        QSize scaledSize(_frame->width, _frame->height);
+
+        if (_frame->width < _frame->height)
+            scaledSize.transpose();
+
+        if (scaledSize.width() > max_video_w || scaledSize.height() > max_video_h)
+            scaledSize.scale(max_video_w, max_video_h, Qt::KeepAspectRatio);
+
+        if (_frame->width < _frame->height)
+            scaledSize.transpose();
+
+        // update scale context
+        if ((_media.needUpdateSwsContext_) || (_frame->format != -1 && _frame->format != _media.codecContext_->pix_fmt) || !_media.swsContext_)
+        {
+            _media.needUpdateSwsContext_ = false;
+            _media.swsContext_ = sws_getCachedContext(
+                _media.swsContext_,
+                _frame->width,
+                _frame->height,
+                ffmpeg::AVPixelFormat(_frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGBA, SWS_POINT, 0, 0, 0);
+        }
+
+        if (!_media.swsContext_)
+            return false;
+
+        // scale straight into a pooled frame, no intermediate buffer
+        _image = framePool_.acquire(scaledSize);
+
+        if (_image.isNull())
+            return false;
+
+        uint8_t* dstData[4] = { _image.bits(), nullptr, nullptr, nullptr };
+        int dstLinesize[4] = { _image.bytesPerLine(), 0, 0, 0 };
+
+        ffmpeg::sws_scale(_media.swsContext_, _frame->data, _frame->linesize, 0, _frame->height, dstData, dstLinesize);
+
+        return true;
+    }
+
     void VideoDecodeThread::prepareCtx(MediaData& _media)
     {
         int32_t w = std::max(ctx_.getWidth(_media), ctx_.getHeight(_media));
@@ -1910,7 +2066,7 @@ namespace Ui
 
         while (!ctx_.isQuit())
         {
-            if (ctx_.getVideoThreadMessage(msg, waitMsgTimeout))
+            if (ctx_.getVideoThreadMessage(worker_, msg, waitMsgTimeout))
             {
                 auto videoId = msg.videoId_;
 
@@ -1930,6 +2086,8 @@ namespace Ui
                     }
                     else if (msg.message_ == thread_message_type::tmt_quit)
                     {
+                        ctx_.releaseVideoWorker(videoId);
+
                         emit ctx_.videoQuit(videoId);
 
                         continue;
@@ -1958,6 +2116,8 @@ namespace Ui
                             ctx_.freeScaleContext(media);
                         }
 
+                        ctx_.releaseVideoWorker(videoId);
+
                         emit ctx_.videoQuit(videoId);
 
                         break;
@@ -2007,8 +2167,10 @@ namespace Ui
                     }
                     case thread_message_type::tmt_get_next_video_frame:
                     {
+                        // paused players are off-screen or hidden, their frames would be dropped anyway
                         if (videoData[videoId].current_state_ == decode_thread_state::dts_end_of_media ||
-                            videoData[videoId].current_state_ == decode_thread_state::dts_failed)
+                            videoData[videoId].current_state_ == decode_thread_state::dts_failed ||
+                            videoData[videoId].current_state_ == decode_thread_state::dts_paused)
                         {
                             break;
                         }
@@ -2041,74 +2203,25 @@ namespace Ui
                                 break;
                             }
 
-                            QSize scaledSize(frame->width, frame->height);
-
-                            if (frame->width < frame->height)
-                                scaledSize.transpose();
-
-                            if (scaledSize.width() > max_video_w || scaledSize.height() > max_video_h)
-                                scaledSize.scale(max_video_w, max_video_h, Qt::KeepAspectRatio);
-
-                            if (frame->width < frame->height)
-                                scaledSize.transpose();
-
-                            // update scale context
-                            if ((media.needUpdateSwsContext_) || (frame->format != -1 && frame->format != media.codecContext_->pix_fmt) || !media.swsContext_)
-                            {
-                                if (media.frameRGB_)
-                                {
-                                    ffmpeg::av_frame_unref(media.frameRGB_);
-                                    ffmpeg::av_frame_free(&media.frameRGB_);
-
-                                    media.frameRGB_ = 0;
-                                }
-
-                                media.needUpdateSwsContext_ = false;
-                                media.swsContext_ = sws_getCachedContext(
-                                    media.swsContext_,
-                                    frame->width,
-                                    frame->height,
-                                    ffmpeg::AVPixelFormat(frame->format), scaledSize.width(), scaledSize.height(), ffmpeg::AV_PIX_FMT_RGBA, SWS_POINT, 0, 0, 0);
-
-                                int align = 256;
-                                while (1)
-                                {
-                                    if (frame->linesize[0] % align == 0)
-                                        break;
-
-                                    align = align / 2;
-                                }
-
-                                media.frameRGB_ = ffmpeg::av_frame_alloc();
-                                int numBytes = ffmpeg::av_image_get_buffer_size(ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
-                                media.scaledBuffer_.resize(numBytes);
-                                av_image_fill_arrays(media.frameRGB_->data, media.frameRGB_->linesize, &media.scaledBuffer_[0], ffmpeg::AV_PIX_FMT_RGBA, scaledSize.width(), scaledSize.height(), align);
-
-                            }
-
-                            ffmpeg::sws_scale(media.swsContext_, frame->data, frame->linesize, 0, frame->height, media.frameRGB_->data, media.frameRGB_->linesize);
-
-                            QImage lastFrame(scaledSize.width(), scaledSize.height(), QImage::Format_RGBA8888);
-
-                            for (int32_t y = 0; y < scaledSize.height(); ++y)
+                            QImage scaledFrame;
+                            if (!scaleFrame(frame, media, scaledFrame))
                             {
-                                memcpy(lastFrame.scanLine(y), media.frameRGB_->data[0] + y*media.frameRGB_->linesize[0], scaledSize.width()*4);
+                                break;
                             }
 
-                            std::unique_ptr<QTransform> imageTransform;
+                            QImage lastFrame = scaledFrame;
 
                             if (ctx_.getRotation(media))
                             {
-                                imageTransform.reset(new QTransform());
-                                imageTransform->rotate(ctx_.getRotation(media));
-                            }
+                                QTransform imageTransform;
+                                imageTransform.rotate(ctx_.getRotation(media));
 
-                            if (imageTransform)
-                            {
-                                lastFrame = lastFrame.transformed(*imageTransform);
+                                lastFrame = lastFrame.transformed(imageTransform);
                             }
 
                             emit ctx_.nextframeReady(videoId, lastFrame, pts, false);
+
+                            framePool_.release(std::move(scaledFrame));
                         }
                         else if (videoData[videoId].eof_)
                         {
@@ -2648,6 +2761,8 @@ namespace Ui
             opengl_renderer_(nullptr),
             isFirstFrame_(true),
             updatePositonRate_(platform::is_apple() ? 1000 : 100),
+            cachedFramePos_(0),
+            framesCacheEnabled_(false),
             state_(decode_thread_state::dts_none),
             lastVideoPosition_(0),
             lastPostedPosition_(0),
@@ -2755,6 +2870,9 @@ namespace Ui
         {
             QPixmap frame = QPixmap::fromImage(_image);
 
+            if (recordedFrames_)
+                recordFrame(_image, frame, _pts);
+
             decodedFrames_.emplace_back(frame, _pts);
 
             if (!firstFrame_)
@@ -2766,12 +2884,104 @@ namespace Ui
         }
         else
         {
+            commitRecordedFrames();
+
             decodedFrames_.emplace_back(_eof);
 
             getMediaContainer()->postAudioThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_set_finished), false);
         }
     }
 
+    void FFMpegPlayer::recordFrame(const QImage& _image, const QPixmap& _frame, double _pts)
+    {
+        auto& frames = recordedFrames_->frames_;
+
+        // the stream was seeked or restarted, the sequence is not contiguous anymore
+        if (!frames.empty() && _pts <= frames.back().pts_)
+        {
+            recordedFrames_.reset();
+            return;
+        }
+
+        const auto maxSize = FramesCache::maxFrameSize();
+        const auto needsDownscale = (_image.width() > maxSize.width() || _image.height() > maxSize.height());
+
+        // the cache downscales the large frames off the gui thread
+        const auto cachedSize = needsDownscale ? _image.size().scaled(maxSize, Qt::KeepAspectRatio) : _image.size();
+
+        recordedFrames_->bytes_ += int64_t(cachedSize.width()) * cachedSize.height() * 4;
+
+        if (needsDownscale)
+            recordedFrames_->sourceBytes_ += _image.byteCount();
+
+        if (recordedFrames_->bytes_ > FramesCache::maxEntryBytes() || recordedFrames_->sourceBytes_ > FramesCache::maxSourceBytes())
+        {
+            recordedFrames_.reset();
+            return;
+        }
+
+        if (needsDownscale)
+            frames.emplace_back(_image, _pts);
+        else
+            frames.emplace_back(_frame, _pts);
+    }
+
+    void FFMpegPlayer::commitRecordedFrames()
+    {
+        if (!recordedFrames_)
+            return;
+
+        recordedFrames_->videoSize_ = getVideoSize();
+        recordedFrames_->rotation_ = getVideoRotation();
+        recordedFrames_->duration_ = getDuration();
+
+        getFramesCache().insert(cacheFile_, std::move(recordedFrames_));
+
+        recordedFrames_.reset();
+    }
+
+    void FFMpegPlayer::showCachedFrame()
+    {
+        if (state_ != decode_thread_state::dts_playing)
+            return;
+
+        if (dataReady_)
+        {
+            emit dataReady();
+            dataReady_ = false;
+        }
+
+        const auto& frames = cachedFrames_->frames_;
+
+        if (cachedFramePos_ >= frames.size())
+            cachedFramePos_ = 0;
+
+        const auto& frame = frames[cachedFramePos_];
+
+        if (!firstFrame_)
+        {
+            firstFrame_ = std::make_unique<DecodedFrame>(frame.image_, frame.pts_);
+
+            emit firstFrameReady();
+        }
+
+        active_renderer_->updateFrame(frame.image_);
+        active_renderer_->redraw();
+
+        ++cachedFramePos_;
+
+        double delay = 0.1;
+        if (cachedFramePos_ < frames.size())
+            delay = frames[cachedFramePos_].pts_ - frame.pts_;
+        else if (frames.size() > 1)
+            delay = frame.pts_ - frames[frames.size() - 2].pts_;
+
+        if (delay <= 0.0 || delay > 10.0)
+            delay = 0.1;
+
+        timer_->start((int)(delay * 1000.0 + 0.5));
+    }
+
     void FFMpegPlayer::onDataReady(uint32_t _videoId)
     {
         // TODO : use signal mapper
@@ -2853,6 +3063,14 @@ namespace Ui
         if (!continius_)
             stoped_ = true;
 
+        recordedFrames_.reset();
+
+        if (cachedFrames_)
+        {
+            cachedFrames_.reset();
+            return 0;
+        }
+
         getMediaContainer()->ctx_.setVideoQuit(mediaId_);
 
         const auto messsage = ThreadMessage(mediaId_, thread_message_type::tmt_quit);
@@ -2911,6 +3129,12 @@ namespace Ui
             return;
         }
 
+        if (cachedFrames_)
+        {
+            showCachedFrame();
+            return;
+        }
+
         auto media = getMediaContainer()->ctx_.getMediaData(mediaId_);
         if (!media)
         {
@@ -3034,6 +3258,38 @@ namespace Ui
         if (!continius_)
             stoped_ = false;
 
+        cacheFile_.clear();
+        cachedFrames_.reset();
+        recordedFrames_.reset();
+
+        // short animations shown in the history are decoded once and then replayed from the cache
+        if (framesCacheEnabled_ && !continius_ && !_isImage)
+        {
+            auto cached = getFramesCache().find(_mediaPath);
+            if (cached)
+            {
+                if (mediaId_ != 0)
+                {
+                    stop();
+                    stoped_ = false;
+                }
+
+                cachedFrames_ = std::move(cached);
+                cachedFramePos_ = 0;
+                state_ = decode_thread_state::dts_none;
+
+                QMetaObject::invokeMethod(this, "fileLoaded", Qt::QueuedConnection);
+
+                return true;
+            }
+
+            if (getFramesCache().isCacheable(_mediaPath))
+            {
+                cacheFile_ = _mediaPath;
+                recordedFrames_ = std::make_shared<CachedFrames>();
+            }
+        }
+
         uint32_t mediaId = getMediaContainer()->init(_id);
 
         openStreamsConnection_ = connect(&getMediaContainer()->ctx_, &VideoContext::streamsOpened, this, &FFMpegPlayer::onStreamsOpened, Qt::QueuedConnection);
@@ -3074,6 +3330,11 @@ namespace Ui
         getMediaContainer()->updateVideoScaleSize(getMedia(), _sz);
     }
 
+    void FFMpegPlayer::setFramesCacheEnabled(const bool _enabled)
+    {
+        framesCacheEnabled_ = _enabled;
+    }
+
     void FFMpegPlayer::onStreamsOpened(uint32_t _videoId)
     {
         if (_videoId != mediaId_ && !continius_)
@@ -3092,6 +3353,12 @@ namespace Ui
         if (!media || !media->videoStream_)
             return;
 
+        if (media->audioStream_ && _videoId == mediaId_)
+        {
+            cacheFile_.clear();
+            recordedFrames_.reset();
+        }
+
         getMediaContainer()->openFile(*media);
         emit fileLoaded();
     }
@@ -3106,6 +3373,26 @@ namespace Ui
             return;
         }
 
+        if (cachedFrames_)
+        {
+            setStarted(_init);
+
+            if (state_ == decode_thread_state::dts_none)
+            {
+                emit durationChanged(getDuration());
+                dataReady_ = true;
+            }
+
+            if (state_ != decode_thread_state::dts_playing)
+            {
+                state_ = decode_thread_state::dts_playing;
+                timer_->start(0);
+            }
+
+            emit played();
+            return;
+        }
+
         auto media_ptr = getMediaContainer()->ctx_.getMediaData(mediaId_);
 
         if (!media_ptr)
@@ -3172,9 +3459,12 @@ namespace Ui
 
         if (state_ == decode_thread_state::dts_playing && canPause())
         {
-            getMediaContainer()->postDemuxThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_pause), false);
-            getMediaContainer()->postVideoThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_pause), false);
-            getMediaContainer()->postAudioThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_pause), false);
+            if (!cachedFrames_)
+            {
+                getMediaContainer()->postDemuxThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_pause), false);
+                getMediaContainer()->postVideoThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_pause), false);
+                getMediaContainer()->postAudioThreadMessage(ThreadMessage(mediaId_, thread_message_type::tmt_pause), false);
+            }
 
             state_ = decode_thread_state::dts_paused;
         }
@@ -3184,6 +3474,20 @@ namespace Ui
 
     void FFMpegPlayer::setPosition(int64_t _position)
     {
+        if (cachedFrames_)
+        {
+            const auto& frames = cachedFrames_->frames_;
+
+            cachedFramePos_ = std::lower_bound(frames.begin(), frames.end(), _position / 1000.0, [](const CachedFrame& _frame, double _pts)
+            {
+                return _frame.pts_ < _pts;
+            }) - frames.begin();
+
+            return;
+        }
+
+        recordedFrames_.reset();
+
         ThreadMessage msg(mediaId_, thread_message_type::tmt_seek_position);
 
         msg.x_ = (int32_t) _position;
@@ -3260,6 +3564,9 @@ namespace Ui
 
     QSize FFMpegPlayer::getVideoSize() const
     {
+        if (cachedFrames_)
+            return cachedFrames_->videoSize_;
+
         auto media_ptr = getMediaContainer()->ctx_.getMediaData(mediaId_);
 
         if (!media_ptr)
@@ -3279,6 +3586,9 @@ namespace Ui
 
     int32_t FFMpegPlayer::getVideoRotation() const
     {
+        if (cachedFrames_)
+            return cachedFrames_->rotation_;
+
         auto media_ptr = getMediaContainer()->ctx_.getMediaData(mediaId_);
         if (!media_ptr)
             return 0;
@@ -3290,6 +3600,9 @@ namespace Ui
 
     int64_t FFMpegPlayer::getDuration() const
     {
+        if (cachedFrames_)
+            return cachedFrames_->duration_;
+
         auto media_ptr = getMediaContainer()->ctx_.getMediaData(mediaId_);
         if (!media_ptr)
             return -1;
@@ -3591,9 +3904,11 @@ namespace Ui
         : is_decods_inited_(false)
         , is_demux_inited_(false)
         , demuxThread_(ctx_)
-        , videoDecodeThread_(ctx_)
         , audioDecodeThread_(ctx_)
-    {}
+    {
+        for (int32_t i = 0; i < ctx_.getVideoWorkersCount(); ++i)
+            videoDecodeThreads_.push_back(std::make_unique<VideoDecodeThread>(ctx_, i));
+    }
 
     MediaContainer::~MediaContainer()
     {
@@ -3617,7 +3932,8 @@ namespace Ui
 
     void MediaContainer::VideoDecodeThreadStart(uint32_t _mediaId)
     {
-        videoDecodeThread_.start();
+        for (auto& thread : videoDecodeThreads_)
+            thread->start();
     }
 
     void MediaContainer::AudioDecodeThreadStart(uint32_t _mediaId)
@@ -3795,7 +4111,8 @@ namespace Ui
 
     void MediaContainer::VideoDecodeThreadWait()
     {
-        videoDecodeThread_.wait();
+        for (auto& thread : videoDecodeThreads_)
+            thread->wait();
     }
 
     void MediaContainer::AudioDecodeThreadWait()
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ffmpeg.h"
+#include "FramesCache.h"
 
 namespace Ui
 {
@@ -112,6 +113,26 @@ namespace Ui
     };
 
 
+    //////////////////////////////////////////////////////////////////////////
+    // VideoFramePool
+    //////////////////////////////////////////////////////////////////////////
+    class VideoFramePool
+    {
+        const int32_t maxFrames_;
+
+        std::list<QImage> frames_;
+
+    public:
+
+        explicit VideoFramePool(int32_t _maxFrames);
+
+        QImage acquire(const QSize& _size);
+        void release(QImage&& _frame);
+
+        void clear();
+    };
+
+
     //////////////////////////////////////////////////////////////////////////
     // DecodeAudioData
     //////////////////////////////////////////////////////////////////////////
@@ -187,8 +208,6 @@ namespace Ui
 
         bool needUpdateSwsContext_;
         ffmpeg::SwsContext* swsContext_;
-        std::vector<uint8_t> scaledBuffer_;
-        ffmpeg::AVFrame* frameRGB_;
         DecodeAudioData audioData_;
 
         std::map<int32_t, QImage> frames_;
@@ -292,7 +311,11 @@ namespace Ui
         mutable std::unordered_map<uint32_t, bool> activeVideos_;
         mutable std::mutex activeVideosMutex_;
 
-        ThreadMessagesQueue videoThreadMessagesQueue_;
+        std::vector<std::unique_ptr<ThreadMessagesQueue>> videoThreadMessagesQueues_;
+        std::unordered_map<uint32_t, int32_t> videoWorkers_;
+        std::vector<int32_t> videoWorkersLoad_;
+        mutable std::mutex videoWorkersMutex_;
+
         ThreadMessagesQueue demuxThreadMessageQueue_;
         ThreadMessagesQueue audioThreadMessageQueue_;
 
@@ -302,10 +325,18 @@ namespace Ui
         void closeStream(ffmpeg::AVStream* _stream);
         void SendCloseStreams(uint32_t _videoId);
 
+        // assigns the least loaded worker to a new video
+        int32_t getVideoWorker(uint32_t _videoId);
+        // -1 if the video has no worker
+        int32_t findVideoWorker(uint32_t _videoId) const;
+
     public:
 
         VideoContext();
 
+        int32_t getVideoWorkersCount() const;
+        void releaseVideoWorker(uint32_t _videoId);
+
         void init(MediaData& _media);
         uint32_t addVideo(uint32_t id = 0);
         void deleteVideo(uint32_t _videoId);
@@ -384,7 +415,7 @@ namespace Ui
         void updateScaledVideoSize(uint32_t _videoId, const QSize& _sz);
 
         void postVideoThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others = false);
-        bool getVideoThreadMessage(ThreadMessage& _message, int32_t _waitTimeout);
+        bool getVideoThreadMessage(int32_t _worker, ThreadMessage& _message, int32_t _waitTimeout);
 
         void postDemuxThreadMessage(const ThreadMessage& _message, bool _forward, bool _clear_others = false);
         bool getDemuxThreadMessage(ThreadMessage& _message, int32_t _waitTimeout);
@@ -452,13 +483,19 @@ namespace Ui
 
         VideoContext& ctx_;
 
+        const int32_t worker_;
+
+        VideoFramePool framePool_;
+
+        bool scaleFrame(ffmpeg::AVFrame* _frame, MediaData& _media, /*OUT*/QImage& _image);
+
     protected:
 
         virtual void run() override;
 
     public:
 
-        explicit VideoDecodeThread(VideoContext& _ctx);
+        VideoDecodeThread(VideoContext& _ctx, int32_t _worker);
 
         void prepareCtx(MediaData& _media);
     };
@@ -632,7 +669,7 @@ namespace Ui
         std::unordered_set<uint32_t> active_video_ids_;
 
         DemuxThread demuxThread_;
-        VideoDecodeThread videoDecodeThread_;
+        std::vector<std::unique_ptr<VideoDecodeThread>> videoDecodeThreads_;
         AudioDecodeThread audioDecodeThread_;
 
         void DemuxThreadWait();
@@ -688,6 +725,12 @@ namespace Ui
 
         std::list<DecodedFrame> decodedFrames_;
 
+        QString cacheFile_;
+        CachedFramesSptr cachedFrames_;
+        size_t cachedFramePos_;
+        std::shared_ptr<CachedFrames> recordedFrames_;
+        bool framesCacheEnabled_;
+
         double computeDelay();
 
         decode_thread_state state_;
@@ -721,6 +764,10 @@ namespace Ui
         void updateVideoPosition(const DecodedFrame& _frame);
         bool canPause() const;
 
+        void showCachedFrame();
+        void recordFrame(const QImage& _image, const QPixmap& _frame, double _pts);
+        void commitRecordedFrames();
+
         FrameRenderer* CreateRenderer(QWidget* _parent, bool _openGL);
 
     Q_SIGNALS:
@@ -762,6 +809,9 @@ namespace Ui
 
         bool openMedia(const QString& _mediaPath, bool isImage = false, uint32_t id = 0);
 
+        // only gif players may record and replay decoded frames: replay is silent and downscaled
+        void setFramesCacheEnabled(const bool _enabled);
+
         void play(bool _init);
         void pause();
 
@@ -0,0 +1,294 @@
+#include "stdafx.h"
+#include "FramesCache.h"
+
+#include <QCryptographicHash>
+
+namespace
+{
+    QString hashFile(const QString& _file)
+    {
+        QFile file(_file);
+        if (!file.open(QIODevice::ReadOnly))
+            return QString();
+
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        if (!hash.addData(&file))
+            return QString();
+
+        return QString::fromLatin1(hash.result().toHex());
+    }
+}
+
+namespace Ui
+{
+    const qint64 maxCachedFileSize = 4 * 1024 * 1024;
+    const int64_t maxCacheBytes = 64 * 1024 * 1024;
+    const int64_t maxCachedEntryBytes = 16 * 1024 * 1024;
+    const int64_t maxRecordedSourceBytes = 64 * 1024 * 1024;
+    const int32_t maxCachedFrameSide = 480;
+    const int32_t maxCachedKeys = 512;
+
+    FramesCache::FramesCache()
+        : bytes_(0)
+        , context_(std::make_unique<QObject>())
+    {
+    }
+
+    FramesCache::~FramesCache()
+    {
+        // the background work finishes into nothing
+        context_.reset();
+    }
+
+    bool FramesCache::isCacheable(const QString& _file) const
+    {
+        const QFileInfo info(_file);
+
+        return info.exists() && info.size() <= maxCachedFileSize;
+    }
+
+    QString FramesCache::findKey(const QString& _file)
+    {
+        const QFileInfo info(_file);
+
+        if (!info.exists() || info.size() > maxCachedFileSize)
+            return QString();
+
+        auto known = keys_.find(_file);
+        if (known != keys_.end())
+        {
+            if (known->size_ == info.size() && known->modified_ == info.lastModified())
+            {
+                keysOrder_.splice(keysOrder_.begin(), keysOrder_, known->order_);
+                return known->key_;
+            }
+
+            keysOrder_.erase(known->order_);
+            keys_.erase(known);
+        }
+
+        requestKey(_file, info);
+
+        return QString();
+    }
+
+    void FramesCache::requestKey(const QString& _file, const QFileInfo& _info)
+    {
+        if (hashing_.contains(_file))
+            return;
+
+        hashing_.insert(_file, nullptr);
+
+        KeyInfo keyInfo;
+        keyInfo.size_ = _info.size();
+        keyInfo.modified_ = _info.lastModified();
+
+        auto watcher = new QFutureWatcher<QString>(context_.get());
+
+        QObject::connect(watcher, &QFutureWatcher<QString>::finished, context_.get(), [this, watcher, _file, keyInfo]()
+        {
+            auto readyKey = keyInfo;
+            readyKey.key_ = watcher->result();
+
+            watcher->deleteLater();
+
+            onKeyReady(_file, readyKey);
+        });
+
+        watcher->setFuture(QtConcurrent::run(QThreadPool::globalInstance(), hashFile, _file));
+    }
+
+    void FramesCache::onKeyReady(const QString& _file, const KeyInfo& _keyInfo)
+    {
+        const auto waiting = hashing_.take(_file);
+
+        if (_keyInfo.key_.isEmpty())
+            return;
+
+        keysOrder_.push_front(_file);
+
+        auto keyInfo = _keyInfo;
+        keyInfo.order_ = keysOrder_.begin();
+
+        keys_[_file] = keyInfo;
+
+        while (keys_.size() > maxCachedKeys)
+        {
+            keys_.remove(keysOrder_.back());
+            keysOrder_.pop_back();
+        }
+
+        if (waiting)
+            insertEntry(keyInfo.key_, waiting);
+    }
+
+    CachedFramesSptr FramesCache::find(const QString& _file)
+    {
+        const auto key = findKey(_file);
+        if (key.isEmpty())
+            return nullptr;
+
+        auto iter = index_.find(key);
+        if (iter == index_.end())
+            return nullptr;
+
+        // move to the head of lru
+        entries_.splice(entries_.begin(), entries_, iter.value());
+
+        return iter.value()->second;
+    }
+
+    void FramesCache::insert(const QString& _file, std::shared_ptr<CachedFrames> _frames)
+    {
+        if (!_frames || _frames->frames_.empty() || _frames->bytes_ > maxCachedEntryBytes)
+            return;
+
+        if (_frames->sourceBytes_ > 0)
+            downscale(_file, std::move(_frames));
+        else
+            insertFrames(_file, std::move(_frames));
+    }
+
+    void FramesCache::downscale(const QString& _file, std::shared_ptr<CachedFrames> _frames)
+    {
+        std::vector<QImage> sources;
+        sources.reserve(_frames->frames_.size());
+
+        for (auto& frame : _frames->frames_)
+        {
+            sources.push_back(frame.source_);
+            frame.source_ = QImage();
+        }
+
+        _frames->sourceBytes_ = 0;
+
+        auto scale = [sources]()
+        {
+            std::vector<QImage> scaled;
+            scaled.reserve(sources.size());
+
+            for (const auto& source : sources)
+            {
+                if (source.isNull())
+                    scaled.emplace_back();
+                else
+                    scaled.push_back(source.scaled(FramesCache::maxFrameSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+            }
+
+            return scaled;
+        };
+
+        auto watcher = new QFutureWatcher<std::vector<QImage>>(context_.get());
+
+        QObject::connect(watcher, &QFutureWatcher<std::vector<QImage>>::finished, context_.get(), [this, watcher, _file, _frames]()
+        {
+            const auto scaled = watcher->result();
+
+            watcher->deleteLater();
+
+            assert(scaled.size() == _frames->frames_.size());
+
+            for (size_t i = 0; i < scaled.size() && i < _frames->frames_.size(); ++i)
+            {
+                if (!scaled[i].isNull())
+                    _frames->frames_[i].image_ = QPixmap::fromImage(scaled[i]);
+            }
+
+            insertFrames(_file, _frames);
+        });
+
+        watcher->setFuture(QtConcurrent::run(QThreadPool::globalInstance(), scale));
+    }
+
+    void FramesCache::insertFrames(const QString& _file, std::shared_ptr<CachedFrames> _frames)
+    {
+        const auto key = findKey(_file);
+        if (!key.isEmpty())
+        {
+            insertEntry(key, std::move(_frames));
+            return;
+        }
+
+        // inserted once the file is hashed, the newest recording wins
+        auto hashing = hashing_.find(_file);
+        if (hashing != hashing_.end())
+            hashing.value() = std::move(_frames);
+    }
+
+    void FramesCache::insertEntry(const QString& _key, CachedFramesSptr _frames)
+    {
+        auto iter = index_.find(_key);
+        if (iter != index_.end())
+        {
+            bytes_ -= iter.value()->second->bytes_;
+            entries_.erase(iter.value());
+            index_.erase(iter);
+        }
+
+        evict(maxCacheBytes - _frames->bytes_);
+
+        entries_.emplace_front(_key, std::move(_frames));
+        index_[_key] = entries_.begin();
+
+        bytes_ += entries_.front().second->bytes_;
+    }
+
+    void FramesCache::evict(int64_t _budget)
+    {
+        while (!entries_.empty() && bytes_ > _budget)
+        {
+            bytes_ -= entries_.back().second->bytes_;
+
+            index_.remove(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    QSize FramesCache::maxFrameSize()
+    {
+        return QSize(maxCachedFrameSide, maxCachedFrameSide);
+    }
+
+    int64_t FramesCache::maxEntryBytes()
+    {
+        return maxCachedEntryBytes;
+    }
+
+    int64_t FramesCache::maxSourceBytes()
+    {
+        return maxRecordedSourceBytes;
+    }
+
+    void FramesCache::clear()
+    {
+        entries_.clear();
+        index_.clear();
+        keys_.clear();
+        keysOrder_.clear();
+
+        // the background work started before is dropped
+        context_ = std::make_unique<QObject>();
+        hashing_.clear();
+
+        bytes_ = 0;
+    }
+
+    std::unique_ptr<FramesCache> g_frames_cache;
+
+    FramesCache& getFramesCache()
+    {
+        if (!g_frames_cache)
+        {
+            assert(qApp && QThread::currentThread() == qApp->thread());
+            g_frames_cache = std::make_unique<FramesCache>();
+        }
+
+        return *g_frames_cache;
+    }
+
+    void ResetFramesCache()
+    {
+        if (g_frames_cache)
+            g_frames_cache.reset();
+    }
+}
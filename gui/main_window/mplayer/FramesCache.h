@@ -0,0 +1,109 @@
+#pragma once
+
+namespace Ui
+{
+    //////////////////////////////////////////////////////////////////////////
+    // CachedFrames
+    //////////////////////////////////////////////////////////////////////////
+    struct CachedFrame
+    {
+        QPixmap image_;
+
+        // a frame above FramesCache::maxFrameSize() until it is downscaled off the gui thread
+        QImage source_;
+
+        double pts_;
+
+        CachedFrame(const QPixmap& _image, const double _pts) : image_(_image), pts_(_pts) {}
+        CachedFrame(const QImage& _source, const double _pts) : source_(_source), pts_(_pts) {}
+    };
+
+    struct CachedFrames
+    {
+        std::vector<CachedFrame> frames_;
+
+        QSize videoSize_;
+        int32_t rotation_;
+        int64_t duration_;
+
+        // of the frames as they are cached
+        int64_t bytes_;
+
+        // of the frames which are not downscaled yet
+        int64_t sourceBytes_;
+
+        CachedFrames() : rotation_(0), duration_(0), bytes_(0), sourceBytes_(0) {}
+    };
+
+    typedef std::shared_ptr<const CachedFrames> CachedFramesSptr;
+
+
+    //////////////////////////////////////////////////////////////////////////
+    // FramesCache
+    //
+    // Decoded and downscaled frames of short animations (gifs, stickers),
+    // keyed by the file content, so a gif posted in several chats is decoded
+    // once and then replayed by every player that shows it.
+    // Gui thread only, the files are hashed and the frames are downscaled
+    // by the thread pool.
+    //////////////////////////////////////////////////////////////////////////
+    class FramesCache
+    {
+        struct KeyInfo
+        {
+            qint64 size_;
+            QDateTime modified_;
+            QString key_;
+            std::list<QString>::iterator order_;
+        };
+
+        typedef std::pair<QString, CachedFramesSptr> Entry;
+
+        std::list<Entry> entries_;
+        QHash<QString, std::list<Entry>::iterator> index_;
+
+        // files by their last use, the oldest ones are forgotten
+        std::list<QString> keysOrder_;
+        QHash<QString, KeyInfo> keys_;
+
+        // the files being hashed and the frames which wait for their keys
+        QHash<QString, std::shared_ptr<CachedFrames>> hashing_;
+
+        int64_t bytes_;
+
+        // owns the watchers of the background work, destroyed first
+        std::unique_ptr<QObject> context_;
+
+        void evict(int64_t _budget);
+
+        QString findKey(const QString& _file);
+        void requestKey(const QString& _file, const QFileInfo& _info);
+        void onKeyReady(const QString& _file, const KeyInfo& _keyInfo);
+
+        void downscale(const QString& _file, std::shared_ptr<CachedFrames> _frames);
+        void insertFrames(const QString& _file, std::shared_ptr<CachedFrames> _frames);
+        void insertEntry(const QString& _key, CachedFramesSptr _frames);
+
+    public:
+
+        FramesCache();
+        ~FramesCache();
+
+        // false for the files which are never cached
+        bool isCacheable(const QString& _file) const;
+
+        // starts hashing an unknown file, so its frames are found next time
+        CachedFramesSptr find(const QString& _file);
+        void insert(const QString& _file, std::shared_ptr<CachedFrames> _frames);
+
+        static QSize maxFrameSize();
+        static int64_t maxEntryBytes();
+        static int64_t maxSourceBytes();
+
+        void clear();
+    };
+
+    FramesCache& getFramesCache();
+
+    void ResetFramesCache();
+}
@@ -677,6 +677,8 @@ namespace Ui
 
         init(_parent, (_flags &DialogPlayer::Flags::is_gif));
 
+        ffplayer_->setFramesCacheEnabled(isGif_ && !(_flags & DialogPlayer::Flags::as_window));
+
         isFullScreen_ = false;
 
         rootLayout_->addWidget(ffplayer_);
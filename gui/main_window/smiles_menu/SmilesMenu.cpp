@@ -119,7 +119,7 @@ namespace Ui
         spacing_ = _spacing;
     }
 
-    Emoji::EmojiRecordSptr EmojiViewItemModel::getEmoji(int _col, int _row) const
+    Emoji::EmojiRecordPtr EmojiViewItemModel::getEmoji(int _col, int _row) const
     {
         int index = _row * columnCount() + _col;
 
@@ -170,7 +170,7 @@ namespace Ui
 
     int EmojiViewItemModel::addCategory(const QString& _category)
     {
-        const Emoji::EmojiRecordSptrVec& emojisVector = Emoji::GetEmojiInfoByCategory(_category);
+        const Emoji::EmojiRecordPtrVec& emojisVector = Emoji::GetEmojiInfoByCategory(_category);
         emojiCategories_.emplace_back(_category, emojisVector);
 
         emojisCount_ += emojisVector.size();
@@ -315,7 +315,7 @@ namespace Ui
         return model_->getCategories();
     }
 
-    Emoji::EmojiRecordSptr EmojiTableView::getEmoji(int _col, int _row) const
+    Emoji::EmojiRecordPtr EmojiTableView::getEmoji(int _col, int _row) const
     {
         return model_->getEmoji(_col, _row);
     }
@@ -1266,7 +1266,7 @@ namespace Ui
         stickersView_->onStickerAdded();
     }
 
-    void RecentsWidget::addEmoji(Emoji::EmojiRecordSptr _emoji)
+    void RecentsWidget::addEmoji(Emoji::EmojiRecordPtr _emoji)
     {
         init();
 
@@ -1671,7 +1671,7 @@ namespace Ui
 
     void SmilesMenu::InitResents()
     {
-        connect(recentsView_, &RecentsWidget::emojiSelected, this, [this](Emoji::EmojiRecordSptr _emoji)
+        connect(recentsView_, &RecentsWidget::emojiSelected, this, [this](Emoji::EmojiRecordPtr _emoji)
         {
             emit emojiSelected(_emoji->Codepoint_, _emoji->ExtendedCodepoint_);
         });
@@ -1807,7 +1807,7 @@ namespace Ui
 
         emojiButton->toggle();
 
-        connect(emojiView_, &EmojisWidget::emojiSelected, this, [this](Emoji::EmojiRecordSptr _emoji)
+        connect(emojiView_, &EmojisWidget::emojiSelected, this, [this](Emoji::EmojiRecordPtr _emoji)
         {
             emit emojiSelected(_emoji->Codepoint_, _emoji->ExtendedCodepoint_);
 
@@ -226,7 +226,7 @@ namespace Ui
         if (CurPlay_.state() == AL_PLAYING)
             return;
 
-        if (get_gui_settings()->get_value<bool>(settings_sounds_enabled, true) && CanPlayIncoming_ && !CallInProgress_)
+        if (Ui::settings::sounds_enabled.get() && CanPlayIncoming_ && !CallInProgress_)
         {
             CanPlayIncoming_ = false;
             Incoming_.play();
@@ -239,7 +239,7 @@ namespace Ui
         if (CurPlay_.state() == AL_PLAYING)
             return;
 
-        if (get_gui_settings()->get_value<bool>(settings_sounds_enabled, true) && CanPlayIncoming_ && !CallInProgress_)
+        if (Ui::settings::sounds_enabled.get() && CanPlayIncoming_ && !CallInProgress_)
         {
             CanPlayIncoming_ = false;
             Mail_.play();
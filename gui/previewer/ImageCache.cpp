@@ -16,6 +16,7 @@ Previewer::ImageCache::ImageCache(const QString& _aimId)
     , aimId_(_aimId)
 {
     connect(Ui::GetDispatcher(), &Ui::core_dispatcher::getImagesResult, this, &Previewer::ImageCache::onGetImagesResult, Qt::QueuedConnection);
+    connect(Ui::GetDispatcher(), &Ui::core_dispatcher::imagesBuilt, this, &Previewer::ImageCache::onImagesBuilt, Qt::QueuedConnection);
 
     loadImages(-1);
 }
@@ -58,6 +59,20 @@ void Previewer::ImageCache::onGetImagesResult(Data::ImageListPtr _result)
     loadImages(from);
 }
 
+void Previewer::ImageCache::onImagesBuilt(const QString& _aimId)
+{
+    if (_aimId != aimId_)
+        return;
+
+    // what was got while the index was being built may lack the older images
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        images_.clear();
+    }
+
+    loadImages(-1);
+}
+
 void Previewer::ImageCache::loadImages(int64_t _from)
 {
     Ui::gui_coll_helper collection(Ui::GetDispatcher()->create_collection(), true);
@@ -20,6 +20,7 @@ namespace Previewer
 
     private slots:
         void onGetImagesResult(Data::ImageListPtr _result);
+        void onImagesBuilt(const QString& _aimId);
 
     private:
         void loadImages(int64_t _from);
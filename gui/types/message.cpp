@@ -27,6 +27,15 @@ namespace
         const qint64 theirs_last_read,
         Out Data::MessageBuddies &messages);
 
+    Data::MessageBuddySptr unserializeMessageData(
+        core::coll_helper &msgColl,
+        const QString &aimId,
+        const QString &myAimid,
+        const qint64 theirs_last_delivered,
+        const qint64 theirs_last_read);
+
+    void resolveFriendlyNames(Data::MessageBuddy& _message);
+
     bool containsSitePreviewUri(const QString &text, Out QStringRef &uri);
 
     bool containsPttAudio(const QString& text, Out int& duration);
@@ -664,6 +673,12 @@ namespace Data
         return { std::move(aimId), std::move(messages), std::move(introMessages), std::move(modifications), lastMsgId, havePending };
     }
 
+    void ResolveFriendlyNames(MessageBuddies& _messages)
+    {
+        for (auto& message : _messages)
+            resolveFriendlyNames(*message);
+    }
+
     Data::MessageBuddySptr unserializeMessage(
         core::coll_helper &msgColl,
         const QString &aimId,
@@ -671,135 +686,9 @@ namespace Data
         const qint64 theirs_last_delivered,
         const qint64 theirs_last_read)
     {
-        auto message = std::make_shared<Data::MessageBuddy>();
-
-        message->Id_ = msgColl.get_value_as_int64("id");
-        message->InternalId_ = QString::fromUtf8(msgColl.get_value_as_string("internal_id"));
-        message->Prev_ = msgColl.get_value_as_int64("prev_id");
-        message->AimId_ = aimId;
-        message->SetOutgoing(msgColl.get<bool>("outgoing"));
-        message->SetDeleted(msgColl.get<bool>("deleted"));
+        auto message = unserializeMessageData(msgColl, aimId, myAimid, theirs_last_delivered, theirs_last_read);
 
-        if (message->IsOutgoing() && (message->Id_ != -1))
-            message->Unread_ = (message->Id_ > theirs_last_read);
-
-        if (message->Id_ == -1 && !message->InternalId_.isEmpty())
-        {
-            int pendingPos = message->InternalId_.lastIndexOf(ql1c('-'));
-            const auto pendingId = message->InternalId_.rightRef(message->InternalId_.length() - pendingPos - 1);
-            message->PendingId_ = pendingId.toInt();
-        }
-
-        const auto timestamp = msgColl.get<int32_t>("time");
-
-        message->SetTime(timestamp);
-        if (msgColl->is_value_exist("text"))
-            message->SetText(QString::fromUtf8(msgColl.get_value_as_string("text")));
-        message->SetDate(QDateTime::fromTime_t(message->GetTime()).date());
-
-        __TRACE(
-            "delivery",
-            "unserialized message\n" <<
-            "	id=					<" << message->Id_ << ">\n" <<
-            "	last_delivered=		<" << theirs_last_delivered << ">\n" <<
-            "	outgoing=<" << logutils::yn(message->IsOutgoing()) << ">\n" <<
-            "	notification_key=<" << message->InternalId_ << ">\n" <<
-            "	delivered_to_client=<" << logutils::yn(message->IsDeliveredToClient()) << ">\n" <<
-            "	delivered_to_server=<" << logutils::yn(message->Id_ != -1) << ">");
-
-        if (msgColl.is_value_exist("chat"))
-        {
-            core::coll_helper chat(msgColl.get_value_as_collection("chat"), false);
-            if (!chat->empty())
-            {
-                message->Chat_ = true;
-                const QString sender = QString::fromUtf8(chat.get_value_as_string("sender"));
-                message->SetChatSender(sender);
-                message->ChatFriendly_ = chat.get_value_as_string("friendly");
-                if (message->ChatFriendly_.isEmpty() && sender != myAimid)
-                    message->ChatFriendly_ = sender;
-            }
-        }
-
-        if (msgColl.is_value_exist("file_sharing"))
-        {
-            core::coll_helper file_sharing(msgColl.get_value_as_collection("file_sharing"), false);
-
-            message->SetType(core::message_type::file_sharing);
-            message->SetFileSharing(std::make_shared<HistoryControl::FileSharingInfo>(file_sharing));
-        }
-
-        if (msgColl.is_value_exist("sticker"))
-        {
-            core::coll_helper sticker(msgColl.get_value_as_collection("sticker"), false);
-
-            message->SetType(core::message_type::sticker);
-            message->SetSticker(HistoryControl::StickerInfo::Make(sticker));
-        }
-
-        if (msgColl.is_value_exist("voip"))
-        {
-            core::coll_helper voip(msgColl.get_value_as_collection("voip"), false);
-
-            message->SetType(core::message_type::voip_event);
-            message->SetVoipEvent(
-                HistoryControl::VoipEventInfo::Make(voip, timestamp)
-            );
-        }
-
-        if (msgColl.is_value_exist("chat_event"))
-        {
-            assert(!message->IsChatEvent());
-
-            core::coll_helper chat_event(msgColl.get_value_as_collection("chat_event"), false);
-
-            message->SetType(core::message_type::chat_event);
-
-            message->SetChatEvent(
-                HistoryControl::ChatEventInfo::Make(
-                    chat_event,
-                    message->IsOutgoing(),
-                    myAimid
-                )
-            );
-        }
-
-        if (msgColl->is_value_exist("quotes"))
-        {
-            core::iarray* quotes = msgColl.get_value_as_array("quotes");
-            const auto size = quotes->size();
-            message->Quotes_.reserve(size);
-            for (auto i = 0; i < size; ++i)
-            {
-                Data::Quote q;
-                q.unserialize(quotes->get_at(i)->get_as_collection());
-                message->Quotes_.push_back(std::move(q));
-            }
-        }
-
-        if (msgColl->is_value_exist("mentions"))
-        {
-            core::iarray* ment = msgColl.get_value_as_array("mentions");
-            for (auto i = 0; i < ment->size(); ++i)
-            {
-                const auto coll = ment->get_at(i)->get_as_collection();
-                core::coll_helper ment_helper(coll, false);
-                auto currentAimId = QString::fromUtf8(ment_helper.get_value_as_string("sn"));
-
-                QString fr;
-                if (currentAimId == Ui::MyInfo()->aimId())
-                    fr = Ui::MyInfo()->friendlyName();
-                else if (Logic::getContactListModel()->contains(currentAimId))
-                    fr = Logic::getContactListModel()->getDisplayName(currentAimId);
-                else if (ment_helper->is_value_exist("friendly"))
-                    fr = QString::fromUtf8(ment_helper.get_value_as_string("friendly"));
-                else
-                    fr = currentAimId;
-
-                if (!currentAimId.isEmpty() && !fr.isEmpty())
-                    message->Mentions_.emplace(std::move(currentAimId), std::move(fr));
-            }
-        }
+        resolveFriendlyNames(*message);
 
         return message;
     }
@@ -975,11 +864,6 @@ namespace Data
 
         if (coll->is_value_exist("chatName"))
             chatName_ = QString::fromUtf8(coll.get_value_as_string("chatName"));
-
-        if (senderId_ == Ui::MyInfo()->aimId())
-            senderFriendly_ = Ui::MyInfo()->friendlyName();
-        else if (Logic::getContactListModel()->contains(senderId_))
-            senderFriendly_ = Logic::getContactListModel()->getDisplayName(senderId_);
     }
 }
 
@@ -1012,7 +896,7 @@ namespace
                 false
             );
 
-            auto message = Data::unserializeMessage(
+            auto message = unserializeMessageData(
                 value, aimId, myAimid, theirs_last_delivered, theirs_last_read
             );
 
@@ -1023,6 +907,167 @@ namespace
         }
     }
 
+    Data::MessageBuddySptr unserializeMessageData(
+        core::coll_helper &msgColl,
+        const QString &aimId,
+        const QString &myAimid,
+        const qint64 theirs_last_delivered,
+        const qint64 theirs_last_read)
+    {
+        auto message = std::make_shared<Data::MessageBuddy>();
+
+        message->Id_ = msgColl.get_value_as_int64("id");
+        message->InternalId_ = QString::fromUtf8(msgColl.get_value_as_string("internal_id"));
+        message->Prev_ = msgColl.get_value_as_int64("prev_id");
+        message->AimId_ = aimId;
+        message->SetOutgoing(msgColl.get<bool>("outgoing"));
+        message->SetDeleted(msgColl.get<bool>("deleted"));
+
+        if (message->IsOutgoing() && (message->Id_ != -1))
+            message->Unread_ = (message->Id_ > theirs_last_read);
+
+        if (message->Id_ == -1 && !message->InternalId_.isEmpty())
+        {
+            int pendingPos = message->InternalId_.lastIndexOf(ql1c('-'));
+            const auto pendingId = message->InternalId_.rightRef(message->InternalId_.length() - pendingPos - 1);
+            message->PendingId_ = pendingId.toInt();
+        }
+
+        const auto timestamp = msgColl.get<int32_t>("time");
+
+        message->SetTime(timestamp);
+        if (msgColl->is_value_exist("text"))
+            message->SetText(QString::fromUtf8(msgColl.get_value_as_string("text")));
+        message->SetDate(QDateTime::fromTime_t(message->GetTime()).date());
+
+        __TRACE(
+            "delivery",
+            "unserialized message\n" <<
+            "	id=					<" << message->Id_ << ">\n" <<
+            "	last_delivered=		<" << theirs_last_delivered << ">\n" <<
+            "	outgoing=<" << logutils::yn(message->IsOutgoing()) << ">\n" <<
+            "	notification_key=<" << message->InternalId_ << ">\n" <<
+            "	delivered_to_client=<" << logutils::yn(message->IsDeliveredToClient()) << ">\n" <<
+            "	delivered_to_server=<" << logutils::yn(message->Id_ != -1) << ">");
+
+        if (msgColl.is_value_exist("chat"))
+        {
+            core::coll_helper chat(msgColl.get_value_as_collection("chat"), false);
+            if (!chat->empty())
+            {
+                message->Chat_ = true;
+                const QString sender = QString::fromUtf8(chat.get_value_as_string("sender"));
+                message->SetChatSender(sender);
+                message->ChatFriendly_ = chat.get_value_as_string("friendly");
+                if (message->ChatFriendly_.isEmpty() && sender != myAimid)
+                    message->ChatFriendly_ = sender;
+            }
+        }
+
+        if (msgColl.is_value_exist("file_sharing"))
+        {
+            core::coll_helper file_sharing(msgColl.get_value_as_collection("file_sharing"), false);
+
+            message->SetType(core::message_type::file_sharing);
+            message->SetFileSharing(std::make_shared<HistoryControl::FileSharingInfo>(file_sharing));
+        }
+
+        if (msgColl.is_value_exist("sticker"))
+        {
+            core::coll_helper sticker(msgColl.get_value_as_collection("sticker"), false);
+
+            message->SetType(core::message_type::sticker);
+            message->SetSticker(HistoryControl::StickerInfo::Make(sticker));
+        }
+
+        if (msgColl.is_value_exist("voip"))
+        {
+            core::coll_helper voip(msgColl.get_value_as_collection("voip"), false);
+
+            message->SetType(core::message_type::voip_event);
+            message->SetVoipEvent(
+                HistoryControl::VoipEventInfo::Make(voip, timestamp)
+            );
+        }
+
+        if (msgColl.is_value_exist("chat_event"))
+        {
+            assert(!message->IsChatEvent());
+
+            core::coll_helper chat_event(msgColl.get_value_as_collection("chat_event"), false);
+
+            message->SetType(core::message_type::chat_event);
+
+            message->SetChatEvent(
+                HistoryControl::ChatEventInfo::Make(
+                    chat_event,
+                    message->IsOutgoing(),
+                    myAimid
+                )
+            );
+        }
+
+        if (msgColl->is_value_exist("quotes"))
+        {
+            core::iarray* quotes = msgColl.get_value_as_array("quotes");
+            const auto size = quotes->size();
+            message->Quotes_.reserve(size);
+            for (auto i = 0; i < size; ++i)
+            {
+                Data::Quote q;
+                q.unserialize(quotes->get_at(i)->get_as_collection());
+                message->Quotes_.push_back(std::move(q));
+            }
+        }
+
+        if (msgColl->is_value_exist("mentions"))
+        {
+            core::iarray* ment = msgColl.get_value_as_array("mentions");
+            for (auto i = 0; i < ment->size(); ++i)
+            {
+                const auto coll = ment->get_at(i)->get_as_collection();
+                core::coll_helper ment_helper(coll, false);
+                auto currentAimId = QString::fromUtf8(ment_helper.get_value_as_string("sn"));
+                if (currentAimId.isEmpty())
+                    continue;
+
+                // the names known to the gui are put over this one by resolveFriendlyNames
+                auto fr = ment_helper->is_value_exist("friendly") ? QString::fromUtf8(ment_helper.get_value_as_string("friendly")) : currentAimId;
+
+                message->Mentions_.emplace(std::move(currentAimId), std::move(fr));
+            }
+        }
+
+        return message;
+    }
+
+    void resolveFriendlyNames(Data::MessageBuddy& _message)
+    {
+        const auto myAimId = Ui::MyInfo()->aimId();
+        const auto contactList = Logic::getContactListModel();
+
+        for (auto it = _message.Mentions_.begin(); it != _message.Mentions_.end();)
+        {
+            if (it->first == myAimId)
+                it->second = Ui::MyInfo()->friendlyName();
+            else if (contactList->contains(it->first))
+                it->second = contactList->getDisplayName(it->first);
+
+            if (it->second.isEmpty())
+                it = _message.Mentions_.erase(it);
+            else
+                ++it;
+        }
+
+        for (auto& quote : _message.Quotes_)
+        {
+            if (quote.senderId_ == myAimId)
+                quote.senderFriendly_ = Ui::MyInfo()->friendlyName();
+            else if (contactList->contains(quote.senderId_))
+                quote.senderFriendly_ = contactList->getDisplayName(quote.senderId_);
+        }
+    }
+
     bool containsSitePreviewUri(const QString &text, Out QStringRef &uri)
     {
         Out uri = QStringRef();
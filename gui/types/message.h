@@ -349,8 +349,14 @@ namespace Data
         bool havePending;
     };
 
+    // does not touch gui singletons and can be called from any thread,
+    // the friendly names of mentions and quotes are left as core sent them
     MessagesResult UnserializeMessageBuddies(core::coll_helper* helper, const QString &myAimid);
 
+    // puts the names known to the gui over the sent ones, gui thread only
+    void ResolveFriendlyNames(MessageBuddies& _messages);
+
+    // unserializes and resolves the friendly names, gui thread only
     Data::MessageBuddySptr unserializeMessage(
         core::coll_helper &msgColl,
         const QString &aimId,
@@ -365,6 +371,7 @@ namespace Data
         QVector<int64_t> DeletedIds_;
         Data::MessageBuddies UpdatedMessages_;
     };
+    // can be called from any thread, see UnserializeMessageBuddies
     ServerMessagesIds UnserializeServerMessagesIds(const core::coll_helper& helper);
 
 	void SerializeDlgState(core::coll_helper* helper, const DlgState& state);
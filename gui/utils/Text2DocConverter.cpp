@@ -12,6 +12,80 @@ namespace
 {
     using namespace Logic;
 
+    struct Text2DocToken
+    {
+        enum class Type
+        {
+            Html,
+            Text,
+            Emoji,
+            Uri
+        };
+
+        Type Type_;
+
+        QString Text_;
+
+        uint32_t Main_;
+
+        uint32_t Ext_;
+    };
+
+    typedef std::vector<Text2DocToken> Text2DocTokens;
+
+    // Remembers what the converter wrote for recently converted texts.
+    // Message widgets are recreated on every scroll and chat switch, replaying
+    // the tokens skips the mention, url and emoji parsing of the same text.
+    // Emoji are stored as codepoints, so the size and alignment are not part of the key.
+    class Text2DocCache
+    {
+    public:
+        struct Key
+        {
+            QString Text_;
+
+            Text2DocHtmlMode HtmlMode_;
+
+            bool ConvertLinks_;
+
+            bool BreakDocument_;
+
+            Data::MentionMap Mentions_;
+
+            bool operator==(const Key& _other) const;
+        };
+
+        Text2DocCache();
+
+        const Text2DocTokens* find(const Key& _key);
+
+        void insert(Key _key, Text2DocTokens _tokens);
+
+        static bool isCacheable(const QString& _text);
+
+    private:
+        struct Entry
+        {
+            Key Key_;
+
+            Text2DocTokens Tokens_;
+
+            int Size_;
+        };
+
+        typedef std::list<Entry> EntriesList;
+
+        static uint hashKey(const Key& _key);
+
+        EntriesList Entries_;
+
+        QHash<uint, EntriesList::iterator> Index_;
+
+        int Size_;
+    };
+
+    Text2DocCache& GetText2DocCache();
+
     class Text2DocConverter
     {
     public:
@@ -68,6 +142,10 @@ namespace
 
         void ConvertMention(const QStringRef& _sn, const QString & _friendly);
 
+        void Record(const Text2DocToken::Type _type, const QString& _text, const uint32_t _main = 0, const uint32_t _ext = 0);
+
+        void Replay(const Text2DocTokens& _tokens, const Emoji::EmojiSizePx _emojiSize, const QTextCharFormat::VerticalAlignment _aligment);
+
         QTextStream Input_;
 
         QTextCursor Writer_;
@@ -91,6 +169,8 @@ namespace
 
         bool MakeUniqResources_;
 
+        Text2DocTokens* Tokens_;
+
         common::tools::url_parser parser_;
     };
 
@@ -311,9 +391,16 @@ namespace
 {
     const auto WORD_WRAP_LIMIT = 15;
 
+    // longer texts are rare and their token streams would evict everything else
+    const auto MAX_CACHED_TEXT_LENGTH = 4096;
+
+    // in characters, html of the tokens is a few times larger than the source text
+    const auto MAX_CACHE_SIZE = 4 * 1024 * 1024;
+
     Text2DocConverter::Text2DocConverter()
         : HtmlMode_(Text2DocHtmlMode::Pass)
         , MakeUniqResources_(false)
+        , Tokens_(nullptr)
     {
         // allow downsizing without reallocation
         const auto DEFAULT_SIZE = 1024;
@@ -337,6 +424,26 @@ namespace
         UriCallback_ = uriCallback;
         HtmlMode_ = htmlMode;
 
+        const auto cacheable = Text2DocCache::isCacheable(text);
+
+        Text2DocCache::Key key;
+        Text2DocTokens tokens;
+
+        if (cacheable)
+        {
+            key = Text2DocCache::Key{ text, htmlMode, convertLinks, breakDocument, mentions_ };
+
+            if (const auto cached = GetText2DocCache().find(key))
+            {
+                Replay(*cached, _emojiSize, _aligment);
+
+                UriCallback_ = nullptr;
+                return;
+            }
+
+            Tokens_ = &tokens;
+        }
+
         while (!IsEos())
         {
             InputCursorStack_.resize(0);
@@ -367,6 +474,12 @@ namespace
 
         FlushBuffers();
 
+        if (Tokens_)
+        {
+            GetText2DocCache().insert(std::move(key), std::move(tokens));
+            Tokens_ = nullptr;
+        }
+
         InputCursorStack_.resize(0);
         TmpBuf_.resize(0);
         LastWord_.resize(0);
@@ -789,10 +902,12 @@ namespace
         if (IsHtmlEscapingEnabled())
         {
             Writer_.insertHtml(Buffer_);
+            Record(Text2DocToken::Type::Html, Buffer_);
         }
         else
         {
             Writer_.insertText(Buffer_);
+            Record(Text2DocToken::Type::Text, Buffer_);
         }
 
         Buffer_.resize(0);
@@ -844,6 +959,8 @@ namespace
 
         FlushBuffers();
 
+        Record(Text2DocToken::Type::Emoji, QString(), _main, _ext);
+
         const auto charFormat = Writer_.charFormat();
 
         auto make_from_code = [](int _code)->QString
@@ -913,9 +1030,19 @@ namespace
 
         const auto bufferPos2 = Buffer_.length();
 
+        if (!UriCallback_ && !Tokens_)
+        {
+            return;
+        }
+
+        const auto uri = Buffer_.mid(bufferPos1, bufferPos2 - bufferPos1);
+
+        // the callback gets the position before the buffer is flushed, the replay keeps it
+        Record(Text2DocToken::Type::Uri, uri);
+
         if (UriCallback_)
         {
-            UriCallback_(Buffer_.mid(bufferPos1, bufferPos2 - bufferPos1), Writer_.position());
+            UriCallback_(uri, Writer_.position());
         }
     }
 
@@ -924,6 +1051,51 @@ namespace
         Buffer_ += ql1s("<a href=\"@[") % _sn % ql1s("]\">@") % _friendly % ql1s("</a>");
     }
 
+    void Text2DocConverter::Record(const Text2DocToken::Type _type, const QString& _text, const uint32_t _main, const uint32_t _ext)
+    {
+        if (!Tokens_)
+        {
+            return;
+        }
+
+        Tokens_->push_back(Text2DocToken{ _type, _text, _main, _ext });
+    }
+
+    void Text2DocConverter::Replay(const Text2DocTokens& _tokens, const Emoji::EmojiSizePx _emojiSize, const QTextCharFormat::VerticalAlignment _aligment)
+    {
+        assert(!Tokens_);
+
+        for (const auto& token : _tokens)
+        {
+            switch (token.Type_)
+            {
+                case Text2DocToken::Type::Html:
+                    Writer_.insertHtml(token.Text_);
+                    break;
+
+                case Text2DocToken::Type::Text:
+                    Writer_.insertText(token.Text_);
+                    break;
+
+                case Text2DocToken::Type::Emoji:
+                    // resources are added again, unique names must not repeat between documents
+                    ReplaceEmoji(Utils::SChar(token.Main_, token.Ext_), _emojiSize, _aligment);
+                    break;
+
+                case Text2DocToken::Type::Uri:
+                    if (UriCallback_)
+                    {
+                        UriCallback_(token.Text_, Writer_.position());
+                    }
+                    break;
+
+                default:
+                    assert(!"unknown token type");
+                    break;
+            }
+        }
+    }
+
     void Text2DocConverter::MakeUniqueResources(const bool _make)
     {
         MakeUniqResources_ = _make;
@@ -933,6 +1105,105 @@ namespace
     {
         return Resources_;
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Text2DocCache
+    //////////////////////////////////////////////////////////////////////////
+
+    bool Text2DocCache::Key::operator==(const Key& _other) const
+    {
+        return HtmlMode_ == _other.HtmlMode_ &&
+            ConvertLinks_ == _other.ConvertLinks_ &&
+            BreakDocument_ == _other.BreakDocument_ &&
+            Text_ == _other.Text_ &&
+            Mentions_ == _other.Mentions_;
+    }
+
+    Text2DocCache::Text2DocCache()
+        : Size_(0)
+    {
+    }
+
+    const Text2DocTokens* Text2DocCache::find(const Key& _key)
+    {
+        const auto iterIndex = Index_.constFind(hashKey(_key));
+        if (iterIndex == Index_.cend())
+        {
+            return nullptr;
+        }
+
+        const auto iterEntry = iterIndex.value();
+        if (!(iterEntry->Key_ == _key))
+        {
+            return nullptr;
+        }
+
+        Entries_.splice(Entries_.begin(), Entries_, iterEntry);
+
+        return &iterEntry->Tokens_;
+    }
+
+    void Text2DocCache::insert(Key _key, Text2DocTokens _tokens)
+    {
+        auto size = _key.Text_.size();
+        for (const auto& token : _tokens)
+        {
+            size += token.Text_.size();
+        }
+
+        if (size > MAX_CACHE_SIZE / 16)
+        {
+            return;
+        }
+
+        const auto hash = hashKey(_key);
+
+        const auto iterIndex = Index_.find(hash);
+        if (iterIndex != Index_.end())
+        {
+            Size_ -= iterIndex.value()->Size_;
+            Entries_.erase(iterIndex.value());
+            Index_.erase(iterIndex);
+        }
+
+        Entries_.push_front(Entry{ std::move(_key), std::move(_tokens), size });
+        Index_.insert(hash, Entries_.begin());
+        Size_ += size;
+
+        while (Size_ > MAX_CACHE_SIZE && !Entries_.empty())
+        {
+            const auto& last = Entries_.back();
+            Size_ -= last.Size_;
+            Index_.remove(hashKey(last.Key_));
+            Entries_.pop_back();
+        }
+    }
+
+    bool Text2DocCache::isCacheable(const QString& _text)
+    {
+        return !_text.isEmpty() && _text.size() <= MAX_CACHED_TEXT_LENGTH;
+    }
+
+    uint Text2DocCache::hashKey(const Key& _key)
+    {
+        auto hash = qHash(_key.Text_);
+        hash = hash * 31 + (uint)_key.HtmlMode_;
+        hash = hash * 31 + (_key.ConvertLinks_ ? 1 : 0);
+        hash = hash * 31 + (_key.BreakDocument_ ? 1 : 0);
+
+        for (const auto& mention : _key.Mentions_)
+        {
+            hash ^= qHash(mention.first) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+
+        return hash;
+    }
+
+    Text2DocCache& GetText2DocCache()
+    {
+        static Text2DocCache cache;
+        return cache;
+    }
 }
 
 namespace
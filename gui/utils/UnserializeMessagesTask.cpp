@@ -0,0 +1,67 @@
+#include "stdafx.h"
+
+#include "gui_coll_helper.h"
+#include "../core_dispatcher.h"
+
+#include "UnserializeMessagesTask.h"
+
+namespace Utils
+{
+    UnserializeMessagesJob::UnserializeMessagesJob(core::coll_helper _params, const bool _serverIds, const Ui::MessagesBuddiesOpt _type, const int64_t _seq)
+        : Params_(std::move(_params))
+        , ServerIds_(_serverIds)
+        , Type_(_type)
+        , Seq_(_seq)
+        , Ready_(false)
+    {
+    }
+
+    UnserializeMessagesJob::UnserializeMessagesJob(std::function<void()> _signal)
+        : Params_(nullptr, false)
+        , ServerIds_(false)
+        , Type_(Ui::MessagesBuddiesOpt::Min)
+        , Seq_(0)
+        , Signal_(std::move(_signal))
+        , Ready_(true)
+    {
+        assert(Signal_);
+    }
+
+    UnserializeMessagesTask::UnserializeMessagesTask(std::shared_ptr<UnserializeMessagesJob> _job)
+        : Job_(std::move(_job))
+    {
+        assert(Job_);
+    }
+
+    UnserializeMessagesTask::~UnserializeMessagesTask()
+    {
+    }
+
+    void UnserializeMessagesTask::run()
+    {
+        auto& params = Job_->Params_;
+
+        if (Job_->ServerIds_)
+        {
+            Job_->ServerMessagesIds_ = Data::UnserializeServerMessagesIds(params);
+        }
+        else
+        {
+            Job_->Messages_ = Data::UnserializeMessageBuddies(&params, params.get<QString>("my_aimid"));
+
+            if (params.is_value_exist("deleted"))
+            {
+                const auto deletedIdsArray = params.get_value_as_array("deleted");
+                assert(!deletedIdsArray->empty());
+                const auto size = deletedIdsArray->size();
+                Job_->DeletedIds_.reserve(size);
+                for (auto i = 0; i < size; ++i)
+                    Job_->DeletedIds_.push_back(deletedIdsArray->get_at(i)->get_as_int64());
+            }
+        }
+
+        Job_->Ready_ = true;
+
+        emit unserializedSignal();
+    }
+}
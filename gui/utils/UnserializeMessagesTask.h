@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../../corelib/collection_helper.h"
+#include "../types/message.h"
+
+namespace Ui
+{
+    enum class MessagesBuddiesOpt;
+}
+
+namespace Utils
+{
+    // one messages collection sent by core, the decoded part is filled on a pool thread
+    // and may be read on the gui thread once Ready_ is set;
+    // a job made of a signal only keeps it in order with the collections of the contact
+    struct UnserializeMessagesJob
+    {
+        UnserializeMessagesJob(core::coll_helper _params, const bool _serverIds, const Ui::MessagesBuddiesOpt _type, const int64_t _seq);
+
+        explicit UnserializeMessagesJob(std::function<void()> _signal);
+
+        core::coll_helper Params_;
+
+        const bool ServerIds_;
+
+        const Ui::MessagesBuddiesOpt Type_;
+
+        const int64_t Seq_;
+
+        Data::MessagesResult Messages_;
+
+        QVector<int64_t> DeletedIds_;
+
+        Data::ServerMessagesIds ServerMessagesIds_;
+
+        const std::function<void()> Signal_;
+
+        std::atomic<bool> Ready_;
+    };
+
+    class UnserializeMessagesTask
+        : public QObject
+        , public QRunnable
+    {
+        Q_OBJECT
+
+    Q_SIGNALS:
+        void unserializedSignal();
+
+    public:
+        UnserializeMessagesTask(std::shared_ptr<UnserializeMessagesJob> _job);
+
+        virtual ~UnserializeMessagesTask();
+
+        void run();
+
+    private:
+        std::shared_ptr<UnserializeMessagesJob> Job_;
+
+    };
+
+}
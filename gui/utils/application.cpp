@@ -141,6 +141,7 @@ namespace Utils
 #endif
 
         Ui::ResetMediaContainer();
+        Ui::ResetFramesCache();
 
         Logic::ResetRecentsModel();
         Logic::ResetUnknownsModel();
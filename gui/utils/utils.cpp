@@ -734,7 +734,7 @@ namespace Utils
         return result;
     }
 
-    QPixmap roundImage(const QPixmap& _img, const QString& _state, bool /*isDefault*/, bool _miniIcons)
+    QImage roundImage(const QImage& _img, const QString& _state, bool _miniIcons)
     {
         int scale = std::min(_img.height(), _img.width());
         QImage imageOut(QSize(scale, scale), QImage::Format_ARGB32);
@@ -785,7 +785,7 @@ namespace Utils
         auto addedRadius = Utils::scale_value(8);
         if (_state == ql1s("photo enter") || _state == ql1s("photo leave"))
         {
-            QPixmap p(Utils::parse_image_name(qsl(":/resources/content_addphoto_100.png")));
+            QImage p(Utils::parse_image_name(qsl(":/resources/content_addphoto_100.png")));
             int x = (scale - p.width());
             int y = (scale - p.height());
             QPainterPath stPath(QPointF(0, 0));
@@ -794,7 +794,7 @@ namespace Utils
         }
 
         painter.setClipPath(path);
-        painter.drawPixmap(0, 0, _img);
+        painter.drawImage(0, 0, _img);
 
         if (_state == ql1s("photo enter"))
         {
@@ -817,32 +817,32 @@ namespace Utils
             QPainterPath stPath(QPointF(0,0));
             stPath.addRect(0, 0, scale, scale);
             painter.setClipPath(stPath);
-            QPixmap p;
+            QImage p;
             if (_state == ql1s("online_active"))
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/online_mini_100_active") : qsl(":/cl_status/online_100_active")));
+                p = QImage(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/online_mini_100_active") : qsl(":/cl_status/online_100_active")));
             else
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/online_mini_100") : qsl(":/cl_status/online_100")));
+                p = QImage(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/online_mini_100") : qsl(":/cl_status/online_100")));
             int x = (scale - p.width());
             int y = (scale - p.height());
-            painter.drawPixmap(x, y, p);
+            painter.drawImage(x, y, p);
         }
         else if (_state == ql1s("mobile") || _state == ql1s("mobile_active"))
         {
             QPainterPath stPath(QPointF(0,0));
             stPath.addRect(0, 0, scale, scale);
             painter.setClipPath(stPath);
-            QPixmap p;
+            QImage p;
             if (_state == ql1s("mobile"))
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/mobile_mini_100") : qsl(":/cl_status/mobile_100")));
+                p = QImage(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/mobile_mini_100") : qsl(":/cl_status/mobile_100")));
             else
-                p = QPixmap(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/mobile_mini_100_active") : qsl(":/cl_status/mobile_100_active")));
+                p = QImage(Utils::parse_image_name(_miniIcons ? qsl(":/cl_status/mobile_mini_100_active") : qsl(":/cl_status/mobile_100_active")));
             int x = (scale - p.width());
             int y = (scale - p.height());
-            painter.drawPixmap(x, y, p);
+            painter.drawImage(x, y, p);
         }
         else if (_state == ql1s("photo enter") || _state == ql1s("photo leave"))
         {
-            QPixmap p(Utils::parse_image_name(qsl(":/resources/content_addphoto_100.png")));
+            QImage p(Utils::parse_image_name(qsl(":/resources/content_addphoto_100.png")));
             int x = (scale - p.width());
             int y = (scale - p.height());
 
@@ -854,10 +854,15 @@ namespace Utils
 
             painter.setBrush(Qt::transparent);
             painter.drawEllipse(x - addedRadius / 2, y - addedRadius / 2, p.width() + addedRadius, p.height() + addedRadius);
-            painter.drawPixmap(x, y, p);
+            painter.drawImage(x, y, p);
         }
 
-        QPixmap pixmap = QPixmap::fromImage(std::move(imageOut));
+        return imageOut;
+    }
+
+    QPixmap roundImage(const QPixmap& _img, const QString& _state, bool /*isDefault*/, bool _miniIcons)
+    {
+        QPixmap pixmap = QPixmap::fromImage(roundImage(_img.toImage(), _state, _miniIcons));
         Utils::check_pixel_ratio(pixmap);
         return pixmap;
     }
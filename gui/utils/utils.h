@@ -108,6 +108,8 @@ namespace Utils
     std::vector<QStringList> GetPossibleStrings(const QString& _text, unsigned& _count);
 
     QPixmap roundImage(const QPixmap& _img, const QString& _state, bool _isDefault, bool _miniIcons);
+    // does not touch QPixmap, safe to call outside of the gui thread
+    QImage roundImage(const QImage& _img, const QString& _state, bool _miniIcons);
 
     void addShadowToWidget(QWidget* _target);
     void addShadowToWindow(QWidget* _target, bool _enabled = true);
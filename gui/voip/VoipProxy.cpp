@@ -1144,7 +1144,7 @@ void voip_proxy::VoipController::setAPlaybackMute(bool _mute)
 
 void voip_proxy::VoipController::loadPlaybackVolumeFromSettings()
 {
-    bool soundEnabled = Ui::get_gui_settings()->get_value<bool>(settings_sounds_enabled, true);
+    bool soundEnabled = Ui::settings::sounds_enabled.get();
     setAPlaybackMute(!soundEnabled);
 }
 
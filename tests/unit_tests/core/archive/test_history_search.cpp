@@ -0,0 +1,107 @@
+#include <boost/test/unit_test.hpp>
+
+#include <core/archive/history_search.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(archive)
+
+BOOST_AUTO_TEST_SUITE(test_history_search)
+
+namespace
+{
+    std::shared_ptr<core::archive::searched_msg> make_result(const std::string& _contact, int64_t _id)
+    {
+        auto result = std::make_shared<core::archive::searched_msg>();
+        result->contact = _contact;
+        result->id = _id;
+
+        return result;
+    }
+
+    std::vector<int64_t> get_ids(const core::archive::searched_msgs& _results)
+    {
+        std::vector<int64_t> ids;
+        for (const auto& result : _results)
+            ids.push_back(result->id);
+
+        return ids;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_top)
+{
+    core::archive::search_context context(std::make_shared<core::archive::coded_term>(), 3);
+
+    BOOST_CHECK_EQUAL(-1, context.get_min_id());
+
+    BOOST_CHECK(context.add_result(make_result("a", 10)));
+    BOOST_CHECK(context.add_result(make_result("a", 20)));
+    BOOST_CHECK(!context.add_result(make_result("b", 20)));
+    BOOST_CHECK(context.add_result(make_result("b", 5)));
+
+    BOOST_CHECK_EQUAL(5, context.get_min_id());
+
+    const std::vector<int64_t> taken = { 10, 20, 5 };
+    const auto results = get_ids(context.take_results());
+    BOOST_CHECK_EQUAL_COLLECTIONS(taken.begin(), taken.end(), results.begin(), results.end());
+
+    BOOST_CHECK(!context.add_result(make_result("b", 4)));
+    BOOST_CHECK(context.add_result(make_result("b", 30)));
+    BOOST_CHECK(context.add_result(make_result("c", 40)));
+
+    // 30 is pushed out before it is taken
+    BOOST_CHECK(context.add_result(make_result("c", 50)));
+    BOOST_CHECK_EQUAL(30, context.get_min_id());
+
+    BOOST_CHECK(context.add_result(make_result("c", 60)));
+    BOOST_CHECK_EQUAL(40, context.get_min_id());
+
+    const std::vector<int64_t> left = { 40, 50, 60 };
+    const auto new_results = get_ids(context.take_results());
+    BOOST_CHECK_EQUAL_COLLECTIONS(left.begin(), left.end(), new_results.begin(), new_results.end());
+
+    BOOST_CHECK(context.take_results().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_contacts_order)
+{
+    core::archive::search_context context(std::make_shared<core::archive::coded_term>(), 2);
+
+    context.add_contact("old", 100);
+    context.add_contact("new", 300);
+    context.add_contact("middle", 200);
+    context.add_contact("oldest", 50);
+
+    std::string contact;
+
+    BOOST_REQUIRE(context.pop_contact(contact));
+    BOOST_CHECK_EQUAL("new", contact);
+
+    context.add_result(make_result("new", 290));
+    context.add_result(make_result("new", 150));
+
+    // the top is full and only "middle" can have a newer message
+    BOOST_REQUIRE(context.pop_contact(contact));
+    BOOST_CHECK_EQUAL("middle", contact);
+
+    BOOST_CHECK(!context.pop_contact(contact));
+}
+
+BOOST_AUTO_TEST_CASE(test_cancel)
+{
+    core::archive::search_context context(std::make_shared<core::archive::coded_term>(), 10);
+
+    context.add_contact("a", 1);
+    context.cancel();
+
+    std::string contact;
+    BOOST_CHECK(context.is_cancelled());
+    BOOST_CHECK(!context.pop_contact(contact));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
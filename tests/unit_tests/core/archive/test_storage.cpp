@@ -0,0 +1,103 @@
+#include <boost/test/unit_test.hpp>
+
+#include <boost/crc.hpp>
+
+#include <core/tools/binary_stream.h>
+#include <core/archive/storage.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(archive)
+
+BOOST_AUTO_TEST_SUITE(test_storage)
+
+namespace
+{
+    void write_block(core::tools::binary_stream& _bs, const std::string& _data, bool _with_checksum)
+    {
+        const auto size = static_cast<uint32_t>(_data.size()) | (_with_checksum ? 0x80000000 : 0);
+
+        _bs.write<uint32_t>(size);
+        _bs.write<uint32_t>(size);
+        _bs.write(_data.c_str(), static_cast<uint32_t>(_data.size()));
+
+        if (_with_checksum)
+        {
+            boost::crc_32_type crc;
+            crc.process_bytes(_data.c_str(), _data.size());
+            _bs.write<uint32_t>(crc.checksum());
+        }
+
+        _bs.write<uint32_t>(size);
+        _bs.write<uint32_t>(size);
+    }
+
+    std::vector<std::string> read_blocks(core::tools::binary_stream& _bs, int64_t _end, int64_t& _pos)
+    {
+        std::vector<std::string> result;
+
+        int64_t begin = 0;
+        while (core::archive::storage::fast_read_data_block(_bs, _pos, begin, _end))
+        {
+            const auto size = _bs.available();
+            result.emplace_back(_bs.read(size), size);
+        }
+
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_skip_garbage)
+{
+    core::tools::binary_stream bs;
+
+    write_block(bs, "first", false);
+    bs.write("\x01\x02\x03\x04\x05\x06\x07\x08\x09", 9);
+    write_block(bs, "second", true);
+
+    // a block with a broken checksum is skipped entirely
+    const auto damaged = bs.available();
+    write_block(bs, "third", true);
+    bs.get_data()[damaged + 8] ^= 1;
+
+    write_block(bs, "fourth block", true);
+
+    const int64_t end = bs.available();
+
+    // the last block is cut and must be left for the next read
+    write_block(bs, "cut", false);
+
+    int64_t pos = 0;
+    const auto blocks = read_blocks(bs, end + 8, pos);
+
+    BOOST_REQUIRE_EQUAL(3u, blocks.size());
+    BOOST_CHECK_EQUAL("first", blocks[0]);
+    BOOST_CHECK_EQUAL("second", blocks[1]);
+    BOOST_CHECK_EQUAL("fourth block", blocks[2]);
+    BOOST_CHECK_EQUAL(end, pos);
+}
+
+BOOST_AUTO_TEST_CASE(test_long_scan)
+{
+    core::tools::binary_stream bs;
+
+    std::string noise(1024 * 64, '\0');
+    for (size_t i = 0; i < noise.size(); ++i)
+        noise[i] = static_cast<char>((i * 7919) % 251);
+
+    bs.write(noise.c_str(), static_cast<uint32_t>(noise.size()));
+    write_block(bs, "found", true);
+    bs.write(noise.c_str(), 13);
+
+    int64_t pos = 0;
+    const auto blocks = read_blocks(bs, bs.available(), pos);
+
+    BOOST_REQUIRE_EQUAL(1u, blocks.size());
+    BOOST_CHECK_EQUAL("found", blocks[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
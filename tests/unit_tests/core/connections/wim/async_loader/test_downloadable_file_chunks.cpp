@@ -0,0 +1,267 @@
+#include <boost/test/unit_test.hpp>
+
+#include <core/connections/wim/async_loader/downloadable_file_chunks.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(wim)
+
+BOOST_AUTO_TEST_SUITE(test_downloadable_file_chunks)
+
+namespace
+{
+    const int64_t block_size = core::wim::downloadable_file_chunks::block_size;
+
+    struct temp_file
+    {
+        temp_file()
+            : file_name_((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).wstring())
+        {
+        }
+
+        ~temp_file()
+        {
+            boost::system::error_code error;
+            boost::filesystem::remove(file_name_ + L".tmp", error);
+            boost::filesystem::remove(file_name_ + L".tmp.blocks", error);
+        }
+
+        std::shared_ptr<core::wim::downloadable_file_chunks> open(int64_t _total_size) const
+        {
+            auto chunks = std::make_shared<core::wim::downloadable_file_chunks>(core::default_priority, "contact", "url", file_name_, _total_size);
+            BOOST_REQUIRE(chunks->open_tmp_file());
+
+            return chunks;
+        }
+
+        const std::wstring file_name_;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(test_take_range)
+{
+    temp_file file;
+    auto chunks = file.open(10 * block_size);
+
+    int64_t id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(0, begin);
+    BOOST_CHECK_EQUAL(4 * block_size, end);
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(4 * block_size, begin);
+    BOOST_CHECK_EQUAL(8 * block_size, end);
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(8 * block_size, begin);
+    BOOST_CHECK_EQUAL(10 * block_size, end);
+
+    // nothing is free, the second half of the slowest range is taken
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(2 * block_size, begin);
+    BOOST_CHECK_EQUAL(4 * block_size, end);
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(6 * block_size, begin);
+    BOOST_CHECK_EQUAL(8 * block_size, end);
+
+    // the halves would be smaller than worth a request
+    BOOST_CHECK(!chunks->take_range(4 * block_size, id, begin, end));
+}
+
+BOOST_AUTO_TEST_CASE(test_take_stalled_range)
+{
+    temp_file file;
+    auto chunks = file.open(4 * block_size);
+
+    const auto now = std::chrono::steady_clock::now();
+
+    int64_t id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end, now));
+    BOOST_CHECK_EQUAL(block_size * 3 / 2, chunks->advance_range(id, block_size * 3 / 2));
+
+    BOOST_CHECK(!chunks->take_range(4 * block_size, id, begin, end, now));
+    BOOST_CHECK(!chunks->take_range(4 * block_size, id, begin, end, now + std::chrono::seconds(3)));
+
+    // the rest of a stalled range is given away from the block after the written data,
+    // before the idle timeout of its request fails it
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end, now + std::chrono::seconds(5)));
+    BOOST_CHECK_EQUAL(2 * block_size, begin);
+    BOOST_CHECK_EQUAL(4 * block_size, end);
+}
+
+BOOST_AUTO_TEST_CASE(test_stalled_range_goes_first)
+{
+    temp_file file;
+    auto chunks = file.open(8 * block_size);
+
+    const auto now = std::chrono::steady_clock::now();
+
+    int64_t stalled_id = 0;
+    int64_t running_id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    BOOST_REQUIRE(chunks->take_range(2 * block_size, stalled_id, begin, end, now - std::chrono::seconds(20)));
+    BOOST_REQUIRE(chunks->take_range(6 * block_size, running_id, begin, end, now));
+
+    // the running range has more left, but the stalled one is taken over
+    int64_t id = 0;
+    BOOST_REQUIRE(chunks->take_range(8 * block_size, id, begin, end, now));
+    BOOST_CHECK_EQUAL(0, begin);
+    BOOST_CHECK_EQUAL(2 * block_size, end);
+
+    BOOST_CHECK(chunks->is_range_over(stalled_id));
+    BOOST_CHECK(!chunks->is_range_over(running_id));
+}
+
+BOOST_AUTO_TEST_CASE(test_advance_range)
+{
+    temp_file file;
+    auto chunks = file.open(2 * block_size + 100);
+
+    int64_t id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    BOOST_REQUIRE(chunks->take_range(8 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(2 * block_size + 100, end);
+
+    BOOST_CHECK_EQUAL(100, chunks->advance_range(id, 100));
+    BOOST_CHECK_EQUAL(100, chunks->get_downloaded());
+
+    BOOST_CHECK_EQUAL(2 * block_size - 100, chunks->advance_range(id, 2 * block_size - 100));
+    BOOST_CHECK_EQUAL(2 * block_size, chunks->get_downloaded());
+    BOOST_CHECK(!chunks->is_range_over(id));
+
+    // the data past the end of the range doesn't belong to it
+    BOOST_CHECK_EQUAL(100, chunks->advance_range(id, block_size));
+    BOOST_CHECK(chunks->is_range_over(id));
+    BOOST_CHECK_EQUAL(0, chunks->advance_range(id, 1));
+
+    BOOST_CHECK(chunks->is_completed());
+    BOOST_CHECK(chunks->finish_range(id));
+    BOOST_CHECK_EQUAL(0, chunks->advance_range(id, 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_invalidate_range)
+{
+    temp_file file;
+    auto chunks = file.open(4 * block_size);
+
+    int64_t id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    chunks->advance_range(id, block_size * 5 / 2);
+    BOOST_CHECK_EQUAL(block_size * 5 / 2, chunks->get_downloaded());
+
+    chunks->invalidate_range(id);
+    BOOST_CHECK_EQUAL(0, chunks->get_downloaded());
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(0, begin);
+    BOOST_CHECK_EQUAL(4 * block_size, end);
+}
+
+BOOST_AUTO_TEST_CASE(test_retry_unfinished_range)
+{
+    temp_file file;
+    auto chunks = file.open(4 * block_size);
+
+    int64_t id = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    // a request timed out in the middle of its range, the new one goes on from the unwritten block
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    chunks->advance_range(id, block_size * 3 / 2);
+    BOOST_CHECK(!chunks->finish_range(id));
+    BOOST_CHECK(chunks->can_retry());
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    BOOST_CHECK_EQUAL(block_size, begin);
+    BOOST_CHECK_EQUAL(4 * block_size, end);
+
+    // requests which get nothing are not replaced for ever
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        BOOST_CHECK(chunks->can_retry());
+        BOOST_CHECK(!chunks->finish_range(id));
+        BOOST_REQUIRE(chunks->take_range(4 * block_size, id, begin, end));
+    }
+
+    BOOST_CHECK(!chunks->can_retry());
+
+    // some data is back, so is the connection
+    chunks->advance_range(id, block_size);
+    BOOST_CHECK(!chunks->finish_range(id));
+    BOOST_CHECK(chunks->can_retry());
+}
+
+BOOST_AUTO_TEST_CASE(test_save_blocks)
+{
+    temp_file file;
+
+    int64_t first = 0;
+    int64_t second = 0;
+    int64_t begin = 0;
+    int64_t end = 0;
+
+    {
+        auto chunks = file.open(4 * block_size);
+
+        BOOST_REQUIRE(chunks->take_range(2 * block_size, first, begin, end));
+        BOOST_REQUIRE(chunks->take_range(2 * block_size, second, begin, end));
+
+        chunks->advance_range(first, 2 * block_size);
+        chunks->advance_range(second, block_size);
+
+        // written, but the streams are still open
+        BOOST_REQUIRE(chunks->save_blocks());
+        BOOST_CHECK_EQUAL(0, file.open(4 * block_size)->get_downloaded());
+
+        BOOST_CHECK(chunks->finish_range(first));
+        BOOST_CHECK(!chunks->finish_range(second));
+        BOOST_REQUIRE(chunks->save_blocks());
+    }
+
+    auto chunks = file.open(4 * block_size);
+    BOOST_CHECK_EQUAL(3 * block_size, chunks->get_downloaded());
+
+    BOOST_REQUIRE(chunks->take_range(4 * block_size, first, begin, end));
+    BOOST_CHECK_EQUAL(3 * block_size, begin);
+    BOOST_CHECK_EQUAL(4 * block_size, end);
+}
+
+BOOST_AUTO_TEST_CASE(test_legacy_prefix)
+{
+    temp_file file;
+
+    {
+        boost::filesystem::ofstream tmp(boost::filesystem::wpath(file.file_name_ + L".tmp"), std::ios::binary);
+        const std::string data(static_cast<size_t>(block_size * 5 / 2), 'x');
+        tmp.write(data.c_str(), data.size());
+    }
+
+    // the whole blocks of a file left by the sequential download are kept
+    auto chunks = file.open(4 * block_size);
+    BOOST_CHECK_EQUAL(2 * block_size, chunks->get_downloaded());
+    BOOST_CHECK_EQUAL(4 * block_size, static_cast<int64_t>(boost::filesystem::file_size(boost::filesystem::wpath(file.file_name_ + L".tmp"))));
+
+    // the full size file is known by its blocks file from now on
+    BOOST_CHECK_EQUAL(2 * block_size, file.open(4 * block_size)->get_downloaded());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+#include <boost/test/unit_test.hpp>
+
+#include <core/connections/wim/dialog_holes.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(wim)
+
+BOOST_AUTO_TEST_SUITE(test_dialog_holes)
+
+namespace
+{
+    core::wim::holes::scheduler::job make_job(const std::string& _contact)
+    {
+        return core::wim::holes::scheduler::job(core::wim::holes::request(_contact, -1, -1, 0), [](int64_t) {});
+    }
+
+    std::string pop_contact(core::wim::holes::scheduler& _scheduler)
+    {
+        auto job = _scheduler.pop();
+
+        return (job ? job->request_.get_contact() : std::string());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_limit)
+{
+    core::wim::holes::scheduler scheduler(2);
+
+    scheduler.push(make_job("a"), false);
+    scheduler.push(make_job("a"), false);
+    scheduler.push(make_job("b"), false);
+    scheduler.push(make_job("c"), false);
+
+    BOOST_CHECK_EQUAL("a", pop_contact(scheduler));
+    BOOST_CHECK_EQUAL("b", pop_contact(scheduler));
+    BOOST_CHECK_EQUAL("", pop_contact(scheduler));
+
+    scheduler.finish("a");
+
+    BOOST_CHECK_EQUAL("a", pop_contact(scheduler));
+    BOOST_CHECK_EQUAL("", pop_contact(scheduler));
+
+    scheduler.finish("b");
+
+    BOOST_CHECK_EQUAL("c", pop_contact(scheduler));
+}
+
+BOOST_AUTO_TEST_CASE(test_opened_dialog_bypasses_limit)
+{
+    core::wim::holes::scheduler scheduler(1);
+
+    scheduler.push(make_job("a"), false);
+    scheduler.push(make_job("b"), false);
+
+    BOOST_CHECK_EQUAL("a", pop_contact(scheduler));
+    BOOST_CHECK_EQUAL("", pop_contact(scheduler));
+
+    scheduler.push(make_job("c"), true);
+
+    BOOST_CHECK_EQUAL("c", pop_contact(scheduler));
+    BOOST_CHECK_EQUAL("", pop_contact(scheduler));
+
+    scheduler.prioritize("b");
+
+    BOOST_CHECK_EQUAL("b", pop_contact(scheduler));
+}
+
+BOOST_AUTO_TEST_CASE(test_opened_dialog_waits_for_its_chain)
+{
+    core::wim::holes::scheduler scheduler(1);
+
+    scheduler.push(make_job("a"), false);
+
+    BOOST_CHECK_EQUAL("a", pop_contact(scheduler));
+
+    scheduler.push(make_job("a"), true);
+
+    BOOST_CHECK_EQUAL("", pop_contact(scheduler));
+
+    scheduler.finish("a");
+
+    BOOST_CHECK_EQUAL("a", pop_contact(scheduler));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,218 @@
+#include <boost/test/unit_test.hpp>
+
+#include <core/curl_scheduler.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(test_curl_scheduler)
+
+namespace
+{
+    std::vector<core::curl_scheduler::job_id> pop_all(core::curl_scheduler& _scheduler)
+    {
+        std::vector<core::curl_scheduler::job_id> ids;
+
+        core::curl_scheduler::job_id id = 0;
+        while (_scheduler.pop(id))
+            ids.push_back(id);
+
+        return ids;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_limits)
+{
+    core::curl_scheduler scheduler;
+
+    BOOST_CHECK_EQUAL(-1, scheduler.get_limit(core::top_priority));
+    BOOST_CHECK_EQUAL(8, scheduler.get_limit(core::highest_priority));
+    BOOST_CHECK_EQUAL(6, scheduler.get_limit(core::high_priority));
+    BOOST_CHECK_EQUAL(4, scheduler.get_limit(core::default_priority));
+
+    for (core::curl_scheduler::job_id id = 1; id <= 10; ++id)
+        scheduler.push(id, core::default_priority, "files");
+
+    BOOST_CHECK_EQUAL(4u, pop_all(scheduler).size());
+
+    scheduler.push(100, core::high_priority, "api");
+    scheduler.push(200, core::top_priority, "api");
+
+    const std::vector<core::curl_scheduler::job_id> started = { 200, 100 };
+    const auto ids = pop_all(scheduler);
+    BOOST_CHECK_EQUAL_COLLECTIONS(started.begin(), started.end(), ids.begin(), ids.end());
+
+    // the transfers of all the priorities count
+    scheduler.finish(100, false, std::chrono::milliseconds(100));
+    scheduler.finish(200, false, std::chrono::milliseconds(100));
+    BOOST_CHECK(pop_all(scheduler).empty());
+
+    scheduler.finish(1, false, std::chrono::milliseconds(100));
+    BOOST_CHECK_EQUAL(1u, pop_all(scheduler).size());
+}
+
+BOOST_AUTO_TEST_CASE(test_hosts_take_turns)
+{
+    core::curl_scheduler scheduler;
+
+    for (core::curl_scheduler::job_id id = 1; id <= 3; ++id)
+        scheduler.push(id, core::high_priority, "files");
+
+    for (core::curl_scheduler::job_id id = 11; id <= 13; ++id)
+        scheduler.push(id, core::high_priority + 10, "api");
+
+    scheduler.push(21, core::low_priority, "api");
+    scheduler.push(22, core::highest_priority, "api");
+
+    const std::vector<core::curl_scheduler::job_id> started = { 22, 1, 11, 2, 12, 3 };
+    const auto ids = pop_all(scheduler);
+    BOOST_CHECK_EQUAL_COLLECTIONS(started.begin(), started.end(), ids.begin(), ids.end());
+}
+
+BOOST_AUTO_TEST_CASE(test_host_limit)
+{
+    core::curl_scheduler scheduler;
+
+    for (core::curl_scheduler::job_id id = 1; id <= 10; ++id)
+        scheduler.push(id, core::highest_priority, "files");
+
+    BOOST_CHECK_EQUAL(scheduler.get_host_limit(), static_cast<int32_t>(pop_all(scheduler).size()));
+
+    scheduler.push(100, core::highest_priority, "api");
+    BOOST_CHECK_EQUAL(1u, pop_all(scheduler).size());
+}
+
+BOOST_AUTO_TEST_CASE(test_errors)
+{
+    core::curl_scheduler scheduler;
+
+    for (core::curl_scheduler::job_id id = 1; id <= 3; ++id)
+        scheduler.push(id, core::highest_priority, "api");
+
+    BOOST_CHECK_EQUAL(3u, pop_all(scheduler).size());
+
+    scheduler.finish(1, true, std::chrono::milliseconds(0));
+    BOOST_CHECK_EQUAL(6, scheduler.get_limit(core::highest_priority));
+
+    // started before the limit was decreased
+    scheduler.finish(2, true, std::chrono::milliseconds(0));
+    BOOST_CHECK_EQUAL(6, scheduler.get_limit(core::highest_priority));
+
+    scheduler.push(4, core::highest_priority, "api");
+    BOOST_CHECK_EQUAL(1u, pop_all(scheduler).size());
+
+    scheduler.finish(4, true, std::chrono::milliseconds(0));
+    BOOST_CHECK_EQUAL(5, scheduler.get_limit(core::highest_priority));
+
+    // the long-poll doesn't change the limits
+    scheduler.push(5, core::top_priority, "api");
+    BOOST_CHECK_EQUAL(1u, pop_all(scheduler).size());
+
+    scheduler.finish(5, true, std::chrono::milliseconds(0));
+    BOOST_CHECK_EQUAL(2, scheduler.get_statistics().decreases_);
+}
+
+BOOST_AUTO_TEST_CASE(test_latency)
+{
+    core::curl_scheduler scheduler;
+
+    core::curl_scheduler::job_id next_id = 1;
+    for (int i = 0; i < 1000; ++i)
+        scheduler.push(next_id++, core::highest_priority, (i % 2) ? "a" : "b");
+
+    // the queue is never empty and the latency is stable
+    for (int i = 0; i < 20; ++i)
+    {
+        for (auto id : pop_all(scheduler))
+            scheduler.finish(id, false, std::chrono::milliseconds(100));
+    }
+
+    const auto grown = scheduler.get_limit(core::highest_priority);
+    BOOST_CHECK(grown > 8);
+
+    // the transfers started together decrease the limit once
+    for (auto id : pop_all(scheduler))
+        scheduler.finish(id, false, std::chrono::milliseconds(1000));
+
+    BOOST_CHECK(scheduler.get_limit(core::highest_priority) < grown);
+    BOOST_CHECK_EQUAL(1, scheduler.get_statistics().decreases_);
+}
+
+BOOST_AUTO_TEST_CASE(test_cancelled)
+{
+    core::curl_scheduler scheduler;
+
+    for (core::curl_scheduler::job_id id = 1; id <= 4; ++id)
+        scheduler.push(id, core::highest_priority, "api");
+
+    BOOST_CHECK_EQUAL(4u, pop_all(scheduler).size());
+
+    scheduler.finish(1, false, std::chrono::milliseconds(100));
+    scheduler.finish(2, false, std::chrono::milliseconds(100));
+
+    const auto before = scheduler.get_statistics();
+
+    // aborted before the first byte, neither the latency nor the capacity change
+    scheduler.finish(3, false, std::chrono::milliseconds(0));
+
+    const auto after = scheduler.get_statistics();
+    BOOST_CHECK(after.min_latency_ == before.min_latency_);
+    BOOST_CHECK(after.latency_ == before.latency_);
+    BOOST_CHECK_EQUAL(before.capacity_, after.capacity_);
+    BOOST_CHECK_EQUAL(0, after.decreases_);
+    BOOST_CHECK_EQUAL(1, after.in_flight_);
+
+    // a slow transfer is still compared with the minimum of the real ones
+    scheduler.finish(4, false, std::chrono::milliseconds(1000));
+    BOOST_CHECK(scheduler.get_statistics().min_latency_ == std::chrono::milliseconds(100));
+}
+
+BOOST_AUTO_TEST_CASE(test_mixed_hosts)
+{
+    core::curl_scheduler scheduler;
+
+    core::curl_scheduler::job_id next_id = 1;
+    for (int i = 0; i < 1000; ++i)
+        scheduler.push(next_id++, core::highest_priority, (i % 2) ? "cdn" : "api");
+
+    // a fast cdn and a slow api, each of them is steady
+    for (int i = 0; i < 20; ++i)
+    {
+        for (auto id : pop_all(scheduler))
+            scheduler.finish(id, false, std::chrono::milliseconds((id % 2) ? 20 : 400));
+    }
+
+    BOOST_CHECK_EQUAL(0, scheduler.get_statistics().decreases_);
+    BOOST_CHECK(scheduler.get_limit(core::highest_priority) > 8);
+}
+
+BOOST_AUTO_TEST_CASE(test_latency_floor)
+{
+    core::curl_scheduler scheduler;
+
+    core::curl_scheduler::job_id next_id = 1;
+    for (int i = 0; i < 1000; ++i)
+        scheduler.push(next_id++, core::highest_priority, "api");
+
+    scheduler.finish(pop_all(scheduler).front(), false, std::chrono::milliseconds(100));
+
+    // the latency keeps growing, the limits stay at the former fixed ones
+    for (int i = 1; i <= 20; ++i)
+    {
+        for (auto id : pop_all(scheduler))
+            scheduler.finish(id, false, std::chrono::milliseconds(100 * (i + 2)));
+    }
+
+    BOOST_CHECK_EQUAL(8, scheduler.get_limit(core::highest_priority));
+    BOOST_CHECK_EQUAL(6, scheduler.get_limit(core::high_priority));
+    BOOST_CHECK_EQUAL(4, scheduler.get_limit(core::default_priority));
+
+    // unlike the network errors
+    for (auto id : pop_all(scheduler))
+        scheduler.finish(id, true, std::chrono::milliseconds(0));
+
+    BOOST_CHECK_EQUAL(6, scheduler.get_limit(core::highest_priority));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+#include <core/tools/case_fold.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(tools)
+
+BOOST_AUTO_TEST_SUITE(test_case_fold)
+
+namespace
+{
+    template <typename F>
+    double measure_ms(size_t _iterations, F _f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < _iterations; ++i)
+            _f();
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_ascii)
+{
+    using namespace core::tools;
+
+    BOOST_CHECK_EQUAL("HELLO, WORLD! [@`{~]", case_fold::to_upper(std::string("Hello, World! [@`{~]").c_str(), 20));
+
+    std::string text = "The Quick Brown Fox Jumps Over The Lazy Dog 0123456789";
+    case_fold::to_lower(text);
+    BOOST_CHECK_EQUAL("the quick brown fox jumps over the lazy dog 0123456789", text);
+
+    BOOST_CHECK(case_fold::is_ascii(text.c_str(), text.size()));
+    BOOST_CHECK(!case_fold::is_ascii("abcdefghij\xD0\x96", 12));
+}
+
+BOOST_AUTO_TEST_CASE(test_cyrillic)
+{
+    using namespace core::tools;
+
+    std::string text = "Съешь же ещё этих мягких французских булок, да выпей чаю. Ёлка";
+    case_fold::to_upper(text);
+    BOOST_CHECK_EQUAL("СЪЕШЬ ЖЕ ЕЩЁ ЭТИХ МЯГКИХ ФРАНЦУЗСКИХ БУЛОК, ДА ВЫПЕЙ ЧАЮ. ЁЛКА", text);
+
+    case_fold::to_lower(text);
+    BOOST_CHECK_EQUAL("съешь же ещё этих мягких французских булок, да выпей чаю. ёлка", text);
+
+    BOOST_CHECK_EQUAL(0x0404u, case_fold::to_upper(0x0454u));
+    BOOST_CHECK_EQUAL(0x04D1u, case_fold::to_lower(0x04D0u));
+}
+
+BOOST_AUTO_TEST_CASE(test_other_scripts)
+{
+    using namespace core::tools;
+
+    std::string greek = "Αλφάβητο";
+    case_fold::to_upper(greek);
+    BOOST_CHECK_EQUAL("ΑΛΦΆΒΗΤΟ", greek);
+
+    std::string latin = "Łódź Ÿ ÿ";
+    case_fold::to_lower(latin);
+    BOOST_CHECK_EQUAL("łódź ÿ ÿ", latin);
+
+    // dotless i becomes shorter in upper case
+    std::string turkish = "ılık";
+    case_fold::to_upper(turkish);
+    BOOST_CHECK_EQUAL("ILIK", turkish);
+}
+
+BOOST_AUTO_TEST_CASE(test_three_byte_letters)
+{
+    using namespace core::tools;
+
+    BOOST_CHECK_EQUAL(0x1EA0u, case_fold::to_upper(0x1EA1u));
+    BOOST_CHECK_EQUAL(0x1F00u, case_fold::to_lower(0x1F08u));
+    BOOST_CHECK_EQUAL(0xFF41u, case_fold::to_lower(0xFF21u));
+
+    std::string vietnamese = "Tiếng Việt có dấu";
+    case_fold::to_upper(vietnamese);
+    BOOST_CHECK_EQUAL("TIẾNG VIỆT CÓ DẤU", vietnamese);
+
+    case_fold::to_lower(vietnamese);
+    BOOST_CHECK_EQUAL("tiếng việt có dấu", vietnamese);
+
+    std::string fullwidth = "Ｆｕｌｌ ｗｉｄｔｈ";
+    case_fold::to_upper(fullwidth);
+    BOOST_CHECK_EQUAL("ＦＵＬＬ ＷＩＤＴＨ", fullwidth);
+
+    // the letters which change their encoded length
+    std::string sharp_s = "STRAẞE";
+    case_fold::to_lower(sharp_s);
+    BOOST_CHECK_EQUAL("straße", sharp_s);
+
+    std::string turned_a = "ɐɑɫ";
+    case_fold::to_upper(turned_a);
+    BOOST_CHECK_EQUAL("ⱯⱭⱢ", turned_a);
+}
+
+BOOST_AUTO_TEST_CASE(test_broken_utf8)
+{
+    using namespace core::tools;
+
+    std::string text = "ab\xD0" "cd\xFF" "ef\xE2\x82";
+    case_fold::to_upper(text);
+    BOOST_CHECK_EQUAL("AB\xD0" "CD\xFF" "EF\xE2\x82", text);
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_case_fold)
+{
+    using namespace core::tools;
+
+    const std::string ascii = "john.smith@example.com John Smith, Example Inc. ";
+    const std::string cyrillic = "Иван Петрович Сидоров, ООО Пример. ";
+
+    std::string ascii_text;
+    std::string cyrillic_text;
+    for (auto i = 0; i < 64; ++i)
+    {
+        ascii_text += ascii;
+        cyrillic_text += cyrillic;
+    }
+
+    const size_t iterations = 2000;
+    size_t checksum = 0;
+
+    const auto ascii_ms = measure_ms(iterations, [&ascii_text, &checksum]()
+    {
+        checksum += case_fold::to_upper(ascii_text.c_str(), ascii_text.size()).size();
+    });
+
+    const auto cyrillic_ms = measure_ms(iterations, [&cyrillic_text, &checksum]()
+    {
+        checksum += case_fold::to_upper(cyrillic_text.c_str(), cyrillic_text.size()).size();
+    });
+
+    BOOST_CHECK_EQUAL(iterations * (ascii_text.size() + cyrillic_text.size()), checksum);
+
+    BOOST_TEST_MESSAGE("case_fold::to_upper, ascii: " << ascii_ms << " ms for " << iterations << " x " << ascii_text.size() << " bytes");
+    BOOST_TEST_MESSAGE("case_fold::to_upper, cyrillic: " << cyrillic_ms << " ms for " << iterations << " x " << cyrillic_text.size() << " bytes");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+#include <boost/test/unit_test.hpp>
+
+#include <core/tools/metrics.h>
+
+BOOST_AUTO_TEST_SUITE(core)
+
+BOOST_AUTO_TEST_SUITE(tools)
+
+BOOST_AUTO_TEST_SUITE(test_metrics)
+
+BOOST_AUTO_TEST_CASE(test_buckets)
+{
+    using core::metrics::histogram;
+
+    for (uint64_t value = 0; value < 100000; value += 7)
+    {
+        const auto index = histogram::get_bucket_index(value);
+        BOOST_REQUIRE(index < histogram::buckets_count);
+
+        const auto high = histogram::get_bucket_high(index);
+        BOOST_REQUIRE(value <= high);
+        BOOST_REQUIRE(high - value <= value / histogram::sub_bucket_count);
+
+        if (index > 0)
+            BOOST_REQUIRE(value > histogram::get_bucket_high(index - 1));
+    }
+
+    BOOST_CHECK_EQUAL(histogram::buckets_count - 1, histogram::get_bucket_index(uint64_t(-1)));
+}
+
+BOOST_AUTO_TEST_CASE(test_percentiles)
+{
+    core::metrics::histogram h;
+
+    for (uint64_t value = 1; value <= 1000; ++value)
+        h.record(value);
+
+    const auto snapshot = h.get_snapshot();
+
+    BOOST_CHECK_EQUAL(1000u, snapshot.count_);
+    BOOST_CHECK_EQUAL(1000u, snapshot.max_);
+    BOOST_CHECK_EQUAL(500u, snapshot.get_mean());
+
+    BOOST_CHECK(snapshot.get_percentile(50) >= 500 && snapshot.get_percentile(50) <= 500 + 500 / 16);
+    BOOST_CHECK(snapshot.get_percentile(99) >= 990 && snapshot.get_percentile(99) <= 1000);
+    BOOST_CHECK_EQUAL(1000u, snapshot.get_percentile(100));
+}
+
+BOOST_AUTO_TEST_CASE(test_registry)
+{
+    auto& c = core::metrics::get_counter("test.counter");
+    c.add();
+    c.add(2);
+
+    BOOST_CHECK_EQUAL(&c, &core::metrics::get_counter("test.counter"));
+    BOOST_CHECK_EQUAL(3, c.get());
+
+    core::metrics::get_histogram("test.histogram").record(42);
+
+    const auto report = core::metrics::dump();
+    BOOST_CHECK(report.find("test.counter: 3") != std::string::npos);
+    BOOST_CHECK(report.find("test.histogram (us): count=1") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()